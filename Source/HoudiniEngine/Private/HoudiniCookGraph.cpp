@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "HoudiniCookGraph.h"
+
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+
+FHoudiniCookGraph::FHoudiniCookGraph(const TArray<TArray<int32>>& InUpstreamNodes)
+	: UpstreamNodes(InUpstreamNodes)
+{
+}
+
+TArray<int32>
+FHoudiniCookGraph::GetDependencyOrder() const
+{
+	enum class EVisitState : uint8 { NotVisited, Visiting, Visited };
+	TArray<EVisitState> VisitStates;
+	VisitStates.Init(EVisitState::NotVisited, UpstreamNodes.Num());
+
+	TArray<int32> Order;
+	Order.Reserve(UpstreamNodes.Num());
+
+	// Depth first: a node's upstream nodes are added right before it.
+	// A node that is already being visited is part of a cycle, that dependency is ignored.
+	TFunction<void(int32)> Visit = [&](int32 NodeIdx)
+	{
+		if (VisitStates[NodeIdx] != EVisitState::NotVisited)
+			return;
+
+		VisitStates[NodeIdx] = EVisitState::Visiting;
+		for (const int32& UpstreamIdx : UpstreamNodes[NodeIdx])
+		{
+			if (UpstreamNodes.IsValidIndex(UpstreamIdx))
+				Visit(UpstreamIdx);
+		}
+
+		VisitStates[NodeIdx] = EVisitState::Visited;
+		Order.Add(NodeIdx);
+	};
+
+	for (int32 NodeIdx = 0; NodeIdx < UpstreamNodes.Num(); NodeIdx++)
+		Visit(NodeIdx);
+
+	return Order;
+}
+
+void
+FHoudiniCookGraph::SortComponents(TArray<UHoudiniAssetComponent*>& InOutHACs)
+{
+	TMap<UHoudiniAssetComponent*, int32> ComponentIndices;
+	for (int32 Idx = 0; Idx < InOutHACs.Num(); Idx++)
+		ComponentIndices.Add(InOutHACs[Idx], Idx);
+
+	bool bHasDependencies = false;
+	TArray<TArray<int32>> UpstreamNodes;
+	UpstreamNodes.SetNum(InOutHACs.Num());
+	for (int32 Idx = 0; Idx < InOutHACs.Num(); Idx++)
+	{
+		TArray<UHoudiniAssetComponent*> UpstreamHACs;
+		GetUpstreamComponents(InOutHACs[Idx], UpstreamHACs);
+		for (UHoudiniAssetComponent* UpstreamHAC : UpstreamHACs)
+		{
+			// Only the dependencies between the given components matter
+			const int32* UpstreamIdx = ComponentIndices.Find(UpstreamHAC);
+			if (!UpstreamIdx || *UpstreamIdx == Idx)
+				continue;
+
+			UpstreamNodes[Idx].AddUnique(*UpstreamIdx);
+			bHasDependencies = true;
+		}
+	}
+
+	if (!bHasDependencies)
+		return;
+
+	const TArray<int32> Order = FHoudiniCookGraph(UpstreamNodes).GetDependencyOrder();
+	TArray<UHoudiniAssetComponent*> SortedHACs;
+	SortedHACs.Reserve(InOutHACs.Num());
+	for (const int32& Idx : Order)
+		SortedHACs.Add(InOutHACs[Idx]);
+
+	InOutHACs = MoveTemp(SortedHACs);
+}
+
+void
+FHoudiniCookGraph::GetUpstreamComponents(UHoudiniAssetComponent* HAC, TArray<UHoudiniAssetComponent*>& OutUpstreamHACs)
+{
+	OutUpstreamHACs.Empty();
+	if (!IsValid(HAC))
+		return;
+
+	for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+	{
+		if (!IsValid(CurrentInput) || !CurrentInput->IsAssetInput())
+			continue;
+
+		const TArray<UHoudiniInputObject*>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInput->GetInputType());
+		if (!ObjectArray)
+			continue;
+
+		for (UHoudiniInputObject* CurrentInputObject : *ObjectArray)
+		{
+			UHoudiniAssetComponent* InputHAC = IsValid(CurrentInputObject)
+				? Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject())
+				: nullptr;
+
+			if (IsValid(InputHAC))
+				OutUpstreamHACs.AddUnique(InputHAC);
+		}
+	}
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Containers/Array.h"
+
+class UHoudiniAssetComponent;
+
+// Dependency graph of the Houdini Asset Components connected through asset inputs.
+// Nodes are identified by their index, and each node lists the nodes it depends on.
+class FHoudiniCookGraph
+{
+public:
+
+	FHoudiniCookGraph(const TArray<TArray<int32>>& InUpstreamNodes);
+
+	// Returns the nodes in their original order, except that every node is moved after the nodes it depends on.
+	// Dependencies that form a cycle are ignored.
+	TArray<int32> GetDependencyOrder() const;
+
+	// Sorts the components so that upstream components come before the components that use them as asset inputs.
+	// Components that don't depend on each other keep their relative order.
+	static void SortComponents(TArray<UHoudiniAssetComponent*>& InOutHACs);
+
+	// Returns the components used by the asset inputs of a component.
+	static void GetUpstreamComponents(UHoudiniAssetComponent* HAC, TArray<UHoudiniAssetComponent*>& OutUpstreamHACs);
+
+private:
+
+	TArray<TArray<int32>> UpstreamNodes;
+};
@@ -205,39 +205,61 @@ FHoudiniDataLayerUtils::GetDataLayerInfoForActor(AActor* Actor)
 
 }
 
-HAPI_NodeId
-FHoudiniDataLayerUtils::AddGroupsFromDataLayers(AActor* Actor, HAPI_NodeId ParentNodeId, HAPI_NodeId InputNodeId)
+TArray<FString>
+FHoudiniDataLayerUtils::GetHoudiniGroupNames(AActor* Actor)
 {
-	HAPI_NodeId VexNodeId;
+	TArray<FString> GroupNames;
 
-	// Create a group node.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(),
-			ParentNodeId,
-			"attribwrangle",
-			"data_layers",
-			false,
-			&VexNodeId),
-		-1);
+	auto DataLayers = FHoudiniDataLayerUtils::GetDataLayerInfoForActor(Actor);
+	GroupNames.Reserve(DataLayers.Num());
+	for (auto& DataLayer : DataLayers)
+	{
+		GroupNames.Add(FString(HOUDINI_DATA_LAYER_PREFIX) + DataLayer.Name);
+	}
 
-	// Hook the new node up to the input node.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(FHoudiniEngine::Get().GetSession(), VexNodeId, 0, InputNodeId, 0), false);
+	return GroupNames;
+}
 
-	SetVexCode(VexNodeId, Actor);
+bool
+FHoudiniDataLayerUtils::AddGroupsFromDataLayers(AActor* Actor, HAPI_NodeId NodeId, HAPI_PartId PartId, int32 NumPrims)
+{
+	if (!IsValid(Actor) || NumPrims <= 0)
+		return false;
 
-	return VexNodeId;
+	// Every primitive of the part belongs to all of the actor's data layers.
+	return AddGroups(GetHoudiniGroupNames(Actor), NodeId, PartId, NumPrims);
 }
 
 bool
-FHoudiniDataLayerUtils::SetVexCode(HAPI_NodeId VexNodeId, AActor* Actor)
+FHoudiniDataLayerUtils::AddGroups(const TArray<FString>& GroupNames, HAPI_NodeId NodeId, HAPI_PartId PartId, int32 NumPrims)
 {
-	auto DataLayers = FHoudiniDataLayerUtils::GetDataLayerInfoForActor(Actor);
+	if (GroupNames.Num() == 0 || NumPrims <= 0)
+		return true;
 
-	FString VexCode;
+	TArray<int32> GroupMembership;
+	GroupMembership.Init(1, NumPrims);
 
-	for (auto& DataLayer : DataLayers)
+	for (const FString& GroupName : GroupNames)
 	{
-		FString PrefixedName = FString(HOUDINI_DATA_LAYER_PREFIX) + DataLayer.Name;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddGroup(
+			FHoudiniEngine::Get().GetSession(),
+			NodeId, PartId, HAPI_GROUPTYPE_PRIM, TCHAR_TO_UTF8(*GroupName)), false);
 
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetGroupMembership(
+			FHoudiniEngine::Get().GetSession(),
+			NodeId, PartId, HAPI_GROUPTYPE_PRIM, TCHAR_TO_UTF8(*GroupName), GroupMembership.GetData(), 0, NumPrims), false);
+	}
+
+	return true;
+}
+
+bool
+FHoudiniDataLayerUtils::SetVexCode(HAPI_NodeId VexNodeId, AActor* Actor)
+{
+	FString VexCode;
+
+	for (const FString& PrefixedName : GetHoudiniGroupNames(Actor))
+	{
 		const FString VexLine = FString::Format(TEXT("setprimgroup(0,\"{0}\", @primnum,1);\n"), { PrefixedName });
 		VexCode += VexLine;
 	}
@@ -63,11 +63,16 @@ public:
 
 	static TArray<FHoudiniDataLayer> GetDataLayers(HAPI_NodeId NodeId, HAPI_PartId PartId);
 
-	// Using this cache, create Houdini Groups for this Actor.
-	static HAPI_NodeId AddGroupsFromDataLayers(AActor* Actor, HAPI_NodeId ParentNodeId, HAPI_NodeId InputNodeId);
+	// Adds a primitive group, containing all NumPrims primitives, to the given part for each of the
+	// actor's data layers. Must be called before the part's geo is committed.
+	static bool AddGroupsFromDataLayers(AActor* Actor, HAPI_NodeId NodeId, HAPI_PartId PartId, int32 NumPrims);
+
+	// Adds a primitive group, containing all NumPrims primitives, to the given part for each group name.
+	static bool AddGroups(const TArray<FString>& GroupNames, HAPI_NodeId NodeId, HAPI_PartId PartId, int32 NumPrims);
 
 	static HAPI_NodeId CreateGroupNode(HAPI_NodeId ParentNode, HAPI_NodeId InputNode, const FString & GorupName);
 
+	// Returns the names of the Houdini groups matching the actor's data layers.
 	static TArray<FString> GetHoudiniGroupNames(AActor* Actor);
 
 	static TArray<FHoudiniUnrealDataLayerInfo> GetDataLayerInfoForActor(AActor* Actor);
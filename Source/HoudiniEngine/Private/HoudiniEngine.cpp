@@ -35,12 +35,14 @@
 #include "HoudiniEngineScheduler.h"
 #include "HoudiniEngineManager.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniSessionSnapshot.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputManagerImpl.h"
+#include "UnrealSplineTranslator.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -253,6 +255,9 @@ FHoudiniEngine::ShutdownModule()
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Shutting down the Houdini Engine module."));
 
+	// Stop listening to the asset registry
+	PackageNameAllocator.Reset();
+
 	// We no longer need the Houdini logo static mesh.
 	if (HoudiniLogoStaticMesh.IsValid())
 	{
@@ -319,6 +324,9 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineSchedulerThread = nullptr;
 	}
 
+	// The session snapshot can't be restored by another editor, delete its file
+	SetSessionSnapshot(nullptr);
+
 	if ( HoudiniEngineScheduler )
 	{
 		delete HoudiniEngineScheduler;
@@ -362,6 +370,15 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+bool
+FHoudiniEngine::CancelTask(const FGuid& InHapiGUID)
+{
+	if (!HoudiniEngineScheduler)
+		return false;
+
+	return HoudiniEngineScheduler->CancelTask(InHapiGUID);
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -390,6 +407,247 @@ FHoudiniEngine::RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo
 	return false;
 }
 
+bool
+FHoudiniEngine::FindLoadedAssetLibrary(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const HAPI_AssetLibraryId* FoundLibraryId = LoadedAssetLibraries.Find(InLibraryKey);
+	if (!FoundLibraryId)
+		return false;
+
+	OutAssetLibraryId = *FoundLibraryId;
+	return true;
+}
+
+bool
+FHoudiniEngine::QueueAssetLibraryLoad(const FString& InLibraryKey)
+{
+	if (InLibraryKey.IsEmpty())
+		return false;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	if (LoadedAssetLibraries.Contains(InLibraryKey) || LoadingAssetLibraries.Contains(InLibraryKey))
+		return false;
+
+	bool bAlreadyQueued = false;
+	QueuedAssetLibraries.Add(InLibraryKey, &bAlreadyQueued);
+	return !bAlreadyQueued;
+}
+
+EHoudiniAssetLibraryLoadState
+FHoudiniEngine::BeginAssetLibraryLoad(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (const HAPI_AssetLibraryId* FoundLibraryId = LoadedAssetLibraries.Find(InLibraryKey))
+	{
+		OutAssetLibraryId = *FoundLibraryId;
+		return EHoudiniAssetLibraryLoadState::Loaded;
+	}
+
+	if (LoadingAssetLibraries.Contains(InLibraryKey))
+		return EHoudiniAssetLibraryLoadState::Loading;
+
+	QueuedAssetLibraries.Remove(InLibraryKey);
+	LoadingAssetLibraries.Add(InLibraryKey);
+	return EHoudiniAssetLibraryLoadState::Claimed;
+}
+
+void
+FHoudiniEngine::EndAssetLibraryLoad(const FString& InLibraryKey, const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	// The registry has been cleared while the library was loading, it belongs to the previous session
+	if (LoadingAssetLibraries.Remove(InLibraryKey) <= 0)
+		return;
+
+	if (InAssetLibraryId >= 0)
+		LoadedAssetLibraries.Add(InLibraryKey, InAssetLibraryId);
+}
+
+void
+FHoudiniEngine::ClearLoadedAssetLibraries()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	LoadedAssetLibraries.Empty();
+	QueuedAssetLibraries.Empty();
+	LoadingAssetLibraries.Empty();
+}
+
+// Deletes nodes that have been removed from the prewarmed node pools.
+// This is done outside of the engine's lock, so that HAPI calls don't block the other threads using it.
+static void
+DeletePrewarmedNodes(const TArray<HAPI_NodeId>& InNodeIds)
+{
+	for (const HAPI_NodeId& NodeId : InNodeIds)
+	{
+		if (FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+			FHoudiniEngineUtils::DeleteHoudiniNode(NodeId);
+	}
+}
+
+bool
+FHoudiniEngine::ClaimPrewarmedNode(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId, HAPI_NodeId& OutNodeId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	FHoudiniPrewarmedNodePool* Pool = PrewarmedNodePools.Find(InAssetName);
+	if (!Pool || Pool->AssetLibraryId != InAssetLibraryId || Pool->NodeIds.Num() <= 0)
+		return false;
+
+	// Hand out the nodes in the order they were prewarmed
+	OutNodeId = Pool->NodeIds[0];
+	Pool->NodeIds.RemoveAt(0, 1, false);
+	return true;
+}
+
+void
+FHoudiniEngine::AddPrewarmedNode(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId, const HAPI_NodeId& InNodeId)
+{
+	if (InAssetName.IsEmpty() || InNodeId < 0)
+		return;
+
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		// The pool has been discarded or the HDA's library reloaded while the node was being prewarmed
+		FHoudiniPrewarmedNodePool* Pool = PrewarmedNodePools.Find(InAssetName);
+		if (Pool && Pool->AssetLibraryId == InAssetLibraryId)
+		{
+			Pool->NodeIds.Add(InNodeId);
+			return;
+		}
+	}
+
+	DeletePrewarmedNodes({ InNodeId });
+}
+
+int32
+FHoudiniEngine::GetNumPrewarmedNodes(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const FHoudiniPrewarmedNodePool* Pool = PrewarmedNodePools.Find(InAssetName);
+	return Pool && Pool->AssetLibraryId == InAssetLibraryId ? Pool->NodeIds.Num() : 0;
+}
+
+int32
+FHoudiniEngine::GetNumPrewarmedNodes()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	int32 NumNodes = 0;
+	for (const auto& Pool : PrewarmedNodePools)
+		NumNodes += Pool.Value.NodeIds.Num();
+
+	return NumNodes;
+}
+
+int32
+FHoudiniEngine::AddAssetInstantiation(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	TArray<HAPI_NodeId> NodeIdsToDelete;
+	int32 NumInstantiations = 0;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		FHoudiniPrewarmedNodePool& Pool = PrewarmedNodePools.FindOrAdd(InAssetName);
+		if (Pool.AssetLibraryId != InAssetLibraryId)
+		{
+			// The HDA's library has been reloaded, its previous nodes must not be reused
+			NodeIdsToDelete = MoveTemp(Pool.NodeIds);
+			Pool = FHoudiniPrewarmedNodePool();
+			Pool.AssetLibraryId = InAssetLibraryId;
+		}
+
+		Pool.LastInstantiationTime = FPlatformTime::Seconds();
+		NumInstantiations = ++Pool.NumInstantiations;
+	}
+
+	DeletePrewarmedNodes(NodeIdsToDelete);
+	return NumInstantiations;
+}
+
+void
+FHoudiniEngine::DiscardPrewarmedNodes(const FString& InAssetName)
+{
+	FHoudiniPrewarmedNodePool Pool;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		if (!PrewarmedNodePools.RemoveAndCopyValue(InAssetName, Pool))
+			return;
+	}
+
+	DeletePrewarmedNodes(Pool.NodeIds);
+}
+
+void
+FHoudiniEngine::DiscardUnusedPrewarmedNodes(const double& InMaxIdleTime)
+{
+	TArray<HAPI_NodeId> NodeIdsToDelete;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		const double Now = FPlatformTime::Seconds();
+		for (auto It = PrewarmedNodePools.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().LastInstantiationTime < InMaxIdleTime)
+				continue;
+
+			NodeIdsToDelete.Append(It.Value().NodeIds);
+			It.RemoveCurrent();
+		}
+	}
+
+	DeletePrewarmedNodes(NodeIdsToDelete);
+}
+
+void
+FHoudiniEngine::ClearPrewarmedNodes(const bool& bInDeleteNodes)
+{
+	TArray<HAPI_NodeId> NodeIdsToDelete;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+
+		if (bInDeleteNodes)
+		{
+			for (const auto& Pool : PrewarmedNodePools)
+				NodeIdsToDelete.Append(Pool.Value.NodeIds);
+		}
+
+		PrewarmedNodePools.Empty();
+	}
+
+	DeletePrewarmedNodes(NodeIdsToDelete);
+}
+
+TSharedPtr<FHoudiniSessionSnapshot>
+FHoudiniEngine::GetSessionSnapshot()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return SessionSnapshot;
+}
+
+void
+FHoudiniEngine::SetSessionSnapshot(const TSharedPtr<FHoudiniSessionSnapshot>& InSessionSnapshot)
+{
+	TSharedPtr<FHoudiniSessionSnapshot> PreviousSessionSnapshot;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		PreviousSessionSnapshot = SessionSnapshot;
+		SessionSnapshot = InSessionSnapshot;
+	}
+
+	// Snapshots alternate between two files, a new snapshot can reuse the file of the previous one
+	if (PreviousSessionSnapshot.IsValid() && PreviousSessionSnapshot != InSessionSnapshot
+		&& (!InSessionSnapshot.IsValid() || PreviousSessionSnapshot->GetHIPFilePath() != InSessionSnapshot->GetHIPFilePath()))
+	{
+		PreviousSessionSnapshot->DeleteHIPFile();
+	}
+}
+
 /*
 void
 FHoudiniEngine::AddHoudiniAssetComponent(UHoudiniAssetComponent* HAC)
@@ -928,6 +1186,11 @@ FHoudiniEngine::InitializeHAPISession()
 		return false;
 	}
 
+	// Libraries loaded in a previous session are not available in this one
+	ClearLoadedAssetLibraries();
+	FUnrealSplineTranslator::ClearSplineSamplesCache();
+	ClearPrewarmedNodes(false);
+
 	// Let HAPI know we are running inside UE4
 	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
 
@@ -953,6 +1216,9 @@ FHoudiniEngine::OnSessionLost()
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
+	ClearLoadedAssetLibraries();
+	FUnrealSplineTranslator::ClearSplineSamplesCache();
+	ClearPrewarmedNodes(false);
 
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -968,7 +1234,12 @@ bool
 FHoudiniEngine::StopSession()
 {
 	HAPI_Session* SessionPtr = &Session;
-	return StopSession(SessionPtr);
+	const bool bStopped = StopSession(SessionPtr);
+
+	// Only restarts restore the session snapshot, it isn't needed once the session has been stopped
+	SetSessionSnapshot(nullptr);
+
+	return bStopped;
 }
 
 bool
@@ -980,6 +1251,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(SessionPtr))
 	{
+		// Delete the prewarmed nodes while the session can still be used
+		ClearPrewarmedNodes(true);
+
 		// SessionPtr is valid, clean up and close the session
 		FHoudiniApi::Cleanup(SessionPtr);
 		FHoudiniApi::CloseSession(SessionPtr);
@@ -988,6 +1262,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
+	ClearLoadedAssetLibraries();
+	FUnrealSplineTranslator::ClearSplineSamplesCache();
+	ClearPrewarmedNodes(false);
 	bEnableSessionSync = false;
 
 	HoudiniEngineManager->StopHoudiniTicking();
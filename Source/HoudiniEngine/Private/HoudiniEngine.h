@@ -30,18 +30,42 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniPackageNameAllocator.h"
 
 #include "Modules/ModuleInterface.h"
 
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 class FHoudiniEngineManager;
+class FHoudiniSessionSnapshot;
 class UHoudiniAssetComponent;
 class UStaticMesh;
 class UMaterial;
 
 struct FSlateDynamicImageBrush;
 
+// Prewarmed nodes of an HDA, and number of times it has been instantiated in the current session.
+struct FHoudiniPrewarmedNodePool
+{
+	// Library the nodes were instantiated from, nodes of an older definition of the HDA are not reused.
+	HAPI_AssetLibraryId AssetLibraryId = -1;
+	TArray<HAPI_NodeId> NodeIds;
+	int32 NumInstantiations = 0;
+	// Last time the HDA was instantiated, used to discard the pools of the HDAs that are no longer placed.
+	double LastInstantiationTime = 0.0;
+};
+
+// State of a library in the session's asset library registry, returned when starting to load it.
+enum class EHoudiniAssetLibraryLoadState : uint8
+{
+	// The library is already loaded and can be reused
+	Loaded,
+	// Another thread is loading the library
+	Loading,
+	// The caller now owns the load and must call EndAssetLibraryLoad()
+	Claimed
+};
+
 enum class EHoudiniBGEOCommandletStatus : uint8;
 
 UENUM()
@@ -155,12 +179,61 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Cancel a pending task, or interrupt it if it is a cook currently running.
+		virtual bool CancelTask(const FGuid& InHapiGUID);
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
 		virtual void RemoveTaskInfo(const FGuid& InHapiGUID);
 		// Remove task info.
 		virtual bool RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo & OutTaskInfo);
+
+		// Asset library registry: keeps track of the HDA libraries loaded in the current session,
+		// so that each distinct HDA is only loaded once and shared by all the HACs using it.
+		// Returns true if a library with the given key has already been loaded in this session.
+		bool FindLoadedAssetLibrary(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId);
+		// Marks a library as queued for a background load.
+		// Returns false if it is already loaded, queued or being loaded.
+		bool QueueAssetLibraryLoad(const FString& InLibraryKey);
+		// Starts loading a library. A queued background load that hasn't started yet is taken over by the caller.
+		// OutAssetLibraryId is only set if the library is already loaded.
+		EHoudiniAssetLibraryLoadState BeginAssetLibraryLoad(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId);
+		// Ends a load claimed with BeginAssetLibraryLoad(), the library is registered if its id is valid.
+		void EndAssetLibraryLoad(const FString& InLibraryKey, const HAPI_AssetLibraryId& InAssetLibraryId);
+		// Clears the registry, needs to be called whenever the session changes.
+		void ClearLoadedAssetLibraries();
+
+		// Prewarmed node pool: nodes of the HDAs that are placed repeatedly are instantiated and cooked in advance,
+		// so that the next instantiation of the same HDA can claim one instead of creating and cooking a new node.
+		// Pools are keyed by asset name, and only hold the nodes of the library the HDA was last instantiated from.
+		// Removes a prewarmed node from the pool of the given HDA, returns false if the pool is empty.
+		bool ClaimPrewarmedNode(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId, HAPI_NodeId& OutNodeId);
+		// Adds a node that has been instantiated and cooked to the pool of the given HDA.
+		// The node is deleted instead if the HDA has since been instantiated from another library.
+		void AddPrewarmedNode(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId, const HAPI_NodeId& InNodeId);
+		// Returns the number of prewarmed nodes available for the given HDA.
+		int32 GetNumPrewarmedNodes(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId);
+		// Returns the number of prewarmed nodes available for all the HDAs.
+		int32 GetNumPrewarmedNodes();
+		// Records an instantiation of the given HDA, returns the number of instantiations in the current session.
+		// If the HDA's library has been reloaded, the nodes prewarmed from the previous library are deleted.
+		int32 AddAssetInstantiation(const FString& InAssetName, const HAPI_AssetLibraryId& InAssetLibraryId);
+		// Removes the pool of the given HDA and deletes its nodes.
+		void DiscardPrewarmedNodes(const FString& InAssetName);
+		// Removes the pools of the HDAs that haven't been instantiated for the given time, and deletes their nodes.
+		void DiscardUnusedPrewarmedNodes(const double& InMaxIdleTime);
+		// Clears the pools, needs to be called whenever the session changes.
+		// The pooled nodes are only deleted if bInDeleteNodes is true, pass false once the session is gone.
+		void ClearPrewarmedNodes(const bool& bInDeleteNodes);
+
+		// Last saved snapshot of the session, used to restore the components after the session is restarted.
+		// Unlike the other session data, it is kept when the session is restarted or lost.
+		// Replacing the snapshot deletes the file of the previous one.
+		TSharedPtr<FHoudiniSessionSnapshot> GetSessionSnapshot();
+		void SetSessionSnapshot(const TSharedPtr<FHoudiniSessionSnapshot>& InSessionSnapshot);
+
+		// Allocator used to find free names for the packages created by cooks and bakes.
+		FHoudiniPackageNameAllocator& GetPackageNameAllocator() { return PackageNameAllocator; };
 		// Register asset to the manager
 		//virtual void AddHoudiniAssetComponent(UHoudiniAssetComponent* HAC);
 
@@ -272,6 +345,20 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Map of task statuses.
 		TMap<FGuid, FHoudiniEngineTaskInfo> TaskInfos;
 
+		// Asset libraries loaded in the current session, keyed by content.
+		TMap<FString, HAPI_AssetLibraryId> LoadedAssetLibraries;
+		// Asset libraries queued for a background load, and being loaded.
+		TSet<FString> QueuedAssetLibraries;
+		TSet<FString> LoadingAssetLibraries;
+
+		// Prewarmed node pools of the HDAs instantiated in the current session, keyed by asset name.
+		TMap<FString, FHoudiniPrewarmedNodePool> PrewarmedNodePools;
+
+		TSharedPtr<FHoudiniSessionSnapshot> SessionSnapshot;
+
+		// Package names used in the cook / bake folders.
+		FHoudiniPackageNameAllocator PackageNameAllocator;
+
 		// Thread used to execute the scheduler.
 		FRunnableThread * HoudiniEngineSchedulerThread;
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
@@ -31,15 +31,19 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniCookGraph.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
+#include "HoudiniInput.h"
 #include "HoudiniInputTranslator.h"
 #include "HoudiniNodeSyncComponent.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
+#include "HoudiniLandscapeTranslator.h"
+#include "HoudiniSessionSnapshot.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -49,6 +53,7 @@
 #if WITH_EDITOR
 	#include "Editor.h"
 	#include "EditorViewportClient.h"
+	#include "Engine/Selection.h"
 	#include "Kismet/KismetMathLibrary.h"
 
 	//#include "UnrealEd.h"
@@ -65,6 +70,48 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineEventDrivenTick(
+	TEXT("HoudiniEngine.EventDrivenTick"),
+	1,
+	TEXT("When enabled, the manager only looks at the HDAs that have been modified, are selected, have world inputs or are being processed on each tick, instead of all of them.\n")
+	TEXT("0: Disabled, check every HDA on every tick\n")
+	TEXT("1: Enabled (Default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInterruptObsoleteCooks(
+	TEXT("HoudiniEngine.InterruptObsoleteCooks"),
+	1,
+	TEXT("When enabled, a running cook is interrupted if the HDA's parameters are modified before it finishes, and the HDA is recooked with the new values.\n")
+	TEXT("0: Disabled, cooks always run to completion\n")
+	TEXT("1: Enabled (Default)\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineSessionSnapshotInterval(
+	TEXT("HoudiniEngine.SessionSnapshotInterval"),
+	0.0,
+	TEXT("Minimum time in seconds between two snapshots of the Houdini Engine session.\n")
+	TEXT("After restarting the session, the HDAs that were not modified since the last snapshot are restored from it instead of being instantiated, uploading their inputs and cooking again.\n")
+	TEXT("The HDAs are not processed while a snapshot is being saved.\n")
+	TEXT("<= 0.0: Disabled (Default)\n")
+	TEXT("120.0: Snapshot every two minutes\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEnginePrewarmedNodePoolTimeout(
+	TEXT("HoudiniEngine.PrewarmedNodePoolTimeout"),
+	300.0,
+	TEXT("Time in seconds after which the prewarmed nodes of an HDA that hasn't been instantiated again are deleted.\n")
+	TEXT("<= 0.0: Disabled, prewarmed nodes are kept until the session is stopped\n")
+	TEXT("300.0: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookingTickDeferral(
+	TEXT("HoudiniEngine.CookingTickDeferral"),
+	0.25,
+	TEXT("Time in seconds by which the HDAs waiting on a cook are pushed back in the processing order, so that other cooks can be dispatched before them.\n")
+	TEXT("<= 0.0: Disabled, HDAs are only processed in the order they were last ticked\n")
+	TEXT("0.25: Default\n")
+);
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -77,6 +124,9 @@ FHoudiniEngineManager::FHoudiniEngineManager()
 	, SyncedUnrealViewportLookatPosition(FVector::ZeroVector)
 	, ZeroOffsetValue(0.f)
 	, bOffsetZeroed(false)
+	, LastSessionSnapshotTime(0.0)
+	, LastSessionSnapshotHash(0)
+	, NumSessionSnapshots(0)
 {
 
 }
@@ -113,6 +163,14 @@ FHoudiniEngineManager::StopHoudiniTicking()
 			// Reset time for delayed notification.
 			FHoudiniEngine::Get().SetHapiNotificationStartedTime(0.0);
 
+			// A snapshot that hasn't been saved yet would save the scene of the next session
+			if (SessionSnapshotTaskGUID.IsValid())
+			{
+				FHoudiniEngine::Get().CancelTask(SessionSnapshotTaskGUID);
+				FHoudiniEngine::Get().RemoveTaskInfo(SessionSnapshotTaskGUID);
+				SessionSnapshotTaskGUID.Invalidate();
+			}
+
 			bMustStopTicking = false;
 		}
 		else
@@ -130,85 +188,144 @@ bool FHoudiniEngineManager::IsTicking() const
 	return TickerHandle.IsValid();
 }
 
-bool
-FHoudiniEngineManager::Tick(float DeltaTime)
+void
+FHoudiniEngineManager::GatherComponentsToProcess(
+	FHoudiniEngineRuntime& InRuntime,
+	bool bInEventDrivenTick,
+	TArray<UHoudiniAssetComponent*>& OutComponentsToProcess,
+	TArray<UHoudiniAssetComponent*>& OutComponentsToRevisit)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::Tick);
+	InRuntime.CleanUpRegisteredHoudiniComponents();
 
-	EnableEditorAutoSave(nullptr);
+	//FScopeLock ScopeLock(&CriticalSection);
+	ComponentCount = InRuntime.GetRegisteredHoudiniComponentCount();
 
-	FHoudiniEngine::Get().TickPersistentNotification(DeltaTime);
-
-	if (bMustStopTicking)
-	{
-		// Ticking should be stopped immediately
-		StopHoudiniTicking();
-		return true;
-	}
+	// Wrap around if needed
+	if (CurrentIndex >= ComponentCount)
+		CurrentIndex = 0;
 
-	// Build a set of components that need to be processed
-	// 1 - selected HACs
-	// 2 - "Active" HACs
-	// 3 - The "next" inactive HAC
-	TArray<UHoudiniAssetComponent*> ComponentsToProcess;
-	if (FHoudiniEngineRuntime::IsInitialized())
+	// Returns true if the component can be processed on this tick
+	auto CanProcessComponent = [&InRuntime, &OutComponentsToRevisit](UHoudiniAssetComponent* CurrentComponent)
 	{
-		FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
-
-		//FScopeLock ScopeLock(&CriticalSection);
-		ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
-
-		// Wrap around if needed
-		if (CurrentIndex >= ComponentCount)
-			CurrentIndex = 0;
-
-		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
+		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+		{
+			// Invalid component, do not process
+			return false;
+		}
+		else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
 		{
-			UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
-			if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+			// Component being deleted, do not process
+			return false;
+		}
+		
+		{
+			UWorld* World = CurrentComponent->GetHACWorld();
+			if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
 			{
-				// Invalid component, do not process
-				continue;
+				if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
+				{
+					// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
+					OutComponentsToRevisit.Add(CurrentComponent);
+					return false;
+				}
 			}
-			else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+		}
+
+		if (!CurrentComponent->IsFullyLoaded())
+		{
+			// Let the component figure out whether it's fully loaded or not.
+			CurrentComponent->HoudiniEngineTick();
+			if (!CurrentComponent->IsFullyLoaded())
 			{
-				// Component being deleted, do not process
-				continue;
+				// We need to wait some more.
+				OutComponentsToRevisit.Add(CurrentComponent);
+				return false;
 			}
-			
+		}
+
+		if (!CurrentComponent->IsValidComponent())
+		{
+			// This component is no longer valid. Prevent it from being processed, and remove it.
+			InRuntime.UnRegisterHoudiniComponent(CurrentComponent);
+			return false;
+		}
+
+		return true;
+	};
+
+	if (bInEventDrivenTick)
+	{
+		// Only look at the dirty HACs, the selected HACs and the "current" HAC, instead of going through all of them.
+		// Active HACs stay dirty until they are back to an inactive state.
+		TSet<UHoudiniAssetComponent*> Candidates;
+		Candidates.Append(InRuntime.ConsumeDirtyHoudiniComponents());
+#if WITH_EDITOR
+		if (GEditor)
+		{
+			for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
 			{
-				UWorld* World = CurrentComponent->GetHACWorld();
-				if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
+				AActor* SelectedActor = Cast<AActor>(*It);
+				if (!IsValid(SelectedActor))
+					continue;
+
+				TInlineComponentArray<UHoudiniAssetComponent*> SelectedHACs(SelectedActor);
+				for (UHoudiniAssetComponent* SelectedHAC : SelectedHACs)
 				{
-					if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
-					{
-						// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
-						continue;
-					}
+					if (InRuntime.IsComponentRegistered(SelectedHAC))
+						Candidates.Add(SelectedHAC);
 				}
 			}
+		}
+#endif
+		// Changes to world inputs (moved actors, edited landscapes...) and to the nodes of a Session Sync session are not
+		// notified: the HACs with world inputs, or all HACs when syncing with Houdini cooks, are polled on every tick.
+		const bool bPollAllComponents = FHoudiniEngine::IsInitialized()
+			&& FHoudiniEngine::Get().IsSessionSyncEnabled()
+			&& FHoudiniEngine::Get().IsSyncWithHoudiniCookEnabled();
+		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
+		{
+			UHoudiniAssetComponent* CurrentComponent = InRuntime.GetRegisteredHoudiniComponentAt(nIdx);
+			if (!IsValid(CurrentComponent))
+				continue;
 
-			if (!CurrentComponent->IsFullyLoaded())
+			const bool bHasWorldInput = CurrentComponent->GetInputs().ContainsByPredicate([](const UHoudiniInput* Input)
 			{
-				// Let the component figure out whether it's fully loaded or not.
-				CurrentComponent->HoudiniEngineTick();
-				if (!CurrentComponent->IsFullyLoaded())
-					continue; // We need to wait some more.
-			}
+				return IsValid(Input) && Input->GetInputType() == EHoudiniInputType::World;
+			});
 
-			if (!CurrentComponent->IsValidComponent())
-			{
-				// This component is no longer valid. Prevent it from being processed, and remove it.
-				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+			if (bPollAllComponents || bHasWorldInput)
+				Candidates.Add(CurrentComponent);
+		}
+
+		// The "current" HAC is still polled, for changes that are not notified.
+		UHoudiniAssetComponent* CurrentIndexComponent = InRuntime.GetRegisteredHoudiniComponentAt(CurrentIndex);
+		if (CurrentIndexComponent)
+		{
+			Candidates.Add(CurrentIndexComponent);
+			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
+			CurrentIndexComponent->LastTickTime = 0.0;
+		}
+
+		for (UHoudiniAssetComponent* CurrentComponent : Candidates)
+		{
+			if (CanProcessComponent(CurrentComponent))
+				OutComponentsToProcess.Add(CurrentComponent);
+		}
+	}
+	else
+	{
+		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
+		{
+			UHoudiniAssetComponent * CurrentComponent = InRuntime.GetRegisteredHoudiniComponentAt(nIdx);
+			if (!CanProcessComponent(CurrentComponent))
 				continue;
-			}
 
 			AActor* Owner = CurrentComponent->GetOwner();
 			if (Owner && Owner->IsSelectedInEditor())
 			{
 				// 1. Add selected HACs
 				// If the component's owner is selected, add it to the set
-				ComponentsToProcess.Add(CurrentComponent);
+				OutComponentsToProcess.Add(CurrentComponent);
 			}
 			else if (CurrentComponent->GetAssetState() != EHoudiniAssetState::NeedInstantiation
 				&& CurrentComponent->GetAssetState() != EHoudiniAssetState::None)
@@ -216,12 +333,12 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				// 2. Add "Active" HACs, the only two non-active states are:
 				// NeedInstantiation (loaded, not instantiated in H yet, not modified)
 				// None (no processing currently)
-				ComponentsToProcess.Add(CurrentComponent);
+				OutComponentsToProcess.Add(CurrentComponent);
 			}
 			else if(nIdx == CurrentIndex)
 			{
 				// 3. Add the "Current" HAC
-				ComponentsToProcess.Add(CurrentComponent);
+				OutComponentsToProcess.Add(CurrentComponent);
 			}
 
 			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
@@ -230,19 +347,71 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				CurrentComponent->LastTickTime = 0.0;
 			}
 		}
+	}
+
+	// Increment the current index for the next tick
+	CurrentIndex++;
+}
 
-		// Increment the current index for the next tick
-		CurrentIndex++;
+bool
+FHoudiniEngineManager::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::Tick);
+
+	EnableEditorAutoSave(nullptr);
+
+	FHoudiniEngine::Get().TickPersistentNotification(DeltaTime);
+
+	if (bMustStopTicking)
+	{
+		// Ticking should be stopped immediately
+		StopHoudiniTicking();
+		return true;
 	}
 
-	// Sort the components by last tick time
-	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B) { return A.LastTickTime < B.LastTickTime; });
+	if (IsSavingSessionSnapshot())
+		return true;
+
+	// Build a set of components that need to be processed
+	// 1 - selected HACs
+	// 2 - "Active" HACs
+	// 3 - The "next" inactive HAC
+	// 4 - HACs that have been modified (parameters, inputs, curves, state...) since the last tick
+	TArray<UHoudiniAssetComponent*> ComponentsToProcess;
+	TArray<UHoudiniAssetComponent*> ComponentsToRevisit;
+	const bool bEventDrivenTick = CVarHoudiniEngineEventDrivenTick.GetValueOnAnyThread() > 0;
+	if (FHoudiniEngineRuntime::IsInitialized())
+		GatherComponentsToProcess(FHoudiniEngineRuntime::Get(), bEventDrivenTick, ComponentsToProcess, ComponentsToRevisit);
+
+	// Sort the components by last tick time.
+	// Components waiting on a cook are sorted as if they had been ticked a bit later, so that other cooks
+	// can be dispatched first and Houdini keeps cooking while we process the outputs of the finished ones.
+	// The deferral is bounded: the components ticked in the meantime eventually go after them.
+	// The "current" HAC (LastTickTime at 0) is still treated first.
+	const double CookingTickDeferral = FMath::Max(0.0, (double)CVarHoudiniEngineCookingTickDeferral.GetValueOnAnyThread());
+	auto GetSortTickTime = [CookingTickDeferral](const UHoudiniAssetComponent& InHAC)
+	{
+		if (InHAC.LastTickTime <= 0.0 || InHAC.GetAssetState() != EHoudiniAssetState::Cooking)
+			return InHAC.LastTickTime;
+
+		return InHAC.LastTickTime + CookingTickDeferral;
+	};
+	ComponentsToProcess.Sort([&GetSortTickTime](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B)
+	{
+		return GetSortTickTime(A) < GetSortTickTime(B);
+	});
+
+	// Upstream HDAs are processed before the HDAs using them as asset inputs, so that each link of a chain of
+	// dependent HDAs progresses as soon as its inputs are ready, instead of waiting for another tick. Cooking is
+	// asynchronous: a downstream HDA only gets the results of its upstream HDAs once their cook has finished.
+	FHoudiniCookGraph::SortComponents(ComponentsToProcess);
 
 	// Time limit for processing
 	double dProcessTimeLimit = CVarHoudiniEngineTickTimeLimit.GetValueOnAnyThread();
 	double dProcessStartTime = FPlatformTime::Seconds();
 
 	// Process all the components in the list
+	int32 NumComponentsProcessed = 0;
 	for(UHoudiniAssetComponent* CurrentComponent : ComponentsToProcess)
 	{
 		// Tick the notification manager
@@ -258,6 +427,7 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 
 		// Update the tick time for this component
 		CurrentComponent->LastTickTime = dNow;
+		NumComponentsProcessed++;
 
 		// Handle template processing (for BP) first
 		// We don't want to the template component processing to trigger session creation
@@ -354,6 +524,29 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		}
 	}
 
+	// Components that are still active, were not processed because of the time limit, or could not be processed yet
+	// need to be looked at again on the next tick.
+	if (bEventDrivenTick && FHoudiniEngineRuntime::IsInitialized())
+	{
+		const bool bCookingEnabled = FHoudiniEngine::Get().IsCookingEnabled();
+		for (int32 Idx = 0; Idx < ComponentsToProcess.Num(); Idx++)
+		{
+			UHoudiniAssetComponent* CurrentComponent = ComponentsToProcess[Idx];
+			if (!IsValid(CurrentComponent))
+				continue;
+
+			const EHoudiniAssetState State = CurrentComponent->GetAssetState();
+			if (Idx >= NumComponentsProcessed || !bCookingEnabled
+				|| (State != EHoudiniAssetState::None && State != EHoudiniAssetState::NeedInstantiation))
+			{
+				ComponentsToRevisit.Add(CurrentComponent);
+			}
+		}
+
+		for (UHoudiniAssetComponent* CurrentComponent : ComponentsToRevisit)
+			FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(CurrentComponent);
+	}
+
 	// Handle Asset delete
 	if (FHoudiniEngineRuntime::IsInitialized())
 	{
@@ -375,6 +568,13 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	// Update PDG Contexts and asset link if needed
 	PDGManager.Update();
 
+	UpdateSessionSnapshot();
+
+	// Delete the prewarmed nodes of the HDAs that are no longer being placed
+	const float PrewarmedNodePoolTimeout = CVarHoudiniEnginePrewarmedNodePoolTimeout.GetValueOnAnyThread();
+	if (PrewarmedNodePoolTimeout > 0.0f)
+		FHoudiniEngine::Get().DiscardUnusedPrewarmedNodes(PrewarmedNodePoolTimeout);
+
 	// Session Sync Updates
 	if (FHoudiniEngine::Get().IsSessionSyncEnabled())
 	{
@@ -455,6 +655,94 @@ FHoudiniEngineManager::AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InC
 	}
 }
 
+void
+FHoudiniEngineManager::UpdateSessionSnapshot()
+{
+	const float SnapshotInterval = CVarHoudiniEngineSessionSnapshotInterval.GetValueOnAnyThread();
+	if (SnapshotInterval <= 0.0f || !FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	// Session sync sessions are shared with the user's Houdini scene and are never restored
+	if (!FHoudiniEngine::Get().GetSession() || FHoudiniEngine::Get().IsSessionSyncEnabled())
+		return;
+
+	if (IsSavingSessionSnapshot())
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastSessionSnapshotTime < SnapshotInterval)
+		return;
+
+	// Only take a snapshot when all the components are idle, and if they have changed since the last one
+	TArray<UHoudiniAssetComponent*> HACs;
+	uint32 Hash = 0;
+	const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 Idx = 0; Idx < NumComponents; Idx++)
+	{
+		UHoudiniAssetComponent* HAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(Idx);
+		if (!IsValid(HAC))
+			continue;
+
+		const EHoudiniAssetState State = HAC->GetAssetState();
+		if (State == EHoudiniAssetState::NeedInstantiation || State == EHoudiniAssetState::ProcessTemplate)
+			continue;
+
+		if (State != EHoudiniAssetState::None)
+			return;
+
+		if (HAC->GetAssetId() < 0)
+			continue;
+
+		HACs.Add(HAC);
+		Hash = HashCombine(Hash, GetTypeHash(HAC));
+		Hash = HashCombine(Hash, GetTypeHash(HAC->GetAssetId()));
+		Hash = HashCombine(Hash, GetTypeHash(HAC->GetAssetCookCount()));
+	}
+
+	LastSessionSnapshotTime = Now;
+	if (HACs.Num() <= 0 || Hash == LastSessionSnapshotHash)
+		return;
+
+	TSharedPtr<FHoudiniSessionSnapshot> Snapshot = MakeShared<FHoudiniSessionSnapshot>();
+	if (Snapshot->CaptureComponents(HACs) <= 0)
+		return;
+
+	LastSessionSnapshotHash = Hash;
+
+	// Alternate between two files, so that the previous snapshot stays valid if the session is lost while saving
+	const FString HIPFilePath = FPaths::Combine(
+		FPlatformProcess::UserTempDir(),
+		FString::Printf(TEXT("HoudiniEngine_SessionSnapshot_%u_%d.hip"), FPlatformProcess::GetCurrentProcessId(), NumSessionSnapshots++ % 2));
+
+	// Saving the scene can take a while, do it in the background
+	SessionSnapshotTaskGUID = FGuid::NewGuid();
+	FHoudiniEngineTask Task(EHoudiniEngineTaskType::SessionSnapshotSave, SessionSnapshotTaskGUID);
+	Task.ActorName = TEXT("Session Snapshot");
+	Task.SessionSnapshot = Snapshot;
+	Task.SessionSnapshotFileName = HIPFilePath;
+	FHoudiniEngine::Get().AddTask(Task);
+}
+
+bool
+FHoudiniEngineManager::IsSavingSessionSnapshot()
+{
+	if (!SessionSnapshotTaskGUID.IsValid())
+		return false;
+
+	// The task info only exists once the scheduler has started the task
+	FHoudiniEngineTaskInfo TaskInfo;
+	if (!FHoudiniEngine::Get().RetrieveTaskInfo(SessionSnapshotTaskGUID, TaskInfo)
+		|| TaskInfo.TaskState == EHoudiniEngineTaskState::None
+		|| TaskInfo.TaskState == EHoudiniEngineTaskState::Working)
+	{
+		return true;
+	}
+
+	FHoudiniEngine::Get().RemoveTaskInfo(SessionSnapshotTaskGUID);
+	SessionSnapshotTaskGUID.Invalidate();
+	return false;
+}
+
 void
 FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 {
@@ -641,6 +929,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					HAC->GetDisplayName(),
 					HAC->bUseOutputNodes,
 					HAC->bOutputTemplateGeos,
+					GetCookPriority(HAC),
 					TaskGUID) )
 				{
 					// Updates the HAC's state
@@ -663,6 +952,11 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// If the parameters have been modified since the cook started, its results are already obsolete.
+			// Cancel it so we can recook with the latest values instead of waiting for it to finish.
+			if (CVarHoudiniEngineInterruptObsoleteCooks.GetValueOnAnyThread() > 0 && HAC->NeedUpdateParameters())
+				FHoudiniEngine::Get().CancelTask(HAC->HapiGUID);
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
@@ -1069,6 +1363,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	const FString& DisplayName,
 	bool bUseOutputNodes,
 	bool bOutputTemplateGeos,
+	const int32& Priority,
 	FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
@@ -1096,12 +1391,31 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 
 	Task.bUseOutputNodes = bUseOutputNodes;
 	Task.bOutputTemplateGeos = bOutputTemplateGeos;
+	Task.Priority = Priority;
 
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
 }
 
+int32
+FHoudiniEngineManager::GetCookPriority(UHoudiniAssetComponent* HAC)
+{
+	if (!IsValid(HAC))
+		return 0;
+
+	// Selected HACs are the ones being edited, cook them first
+	if (HAC->IsOwnerSelected())
+		return 2;
+
+	// Then HACs that are visible in a viewport
+	AActor* Owner = HAC->GetOwner();
+	if (IsValid(Owner) && Owner->WasRecentlyRendered())
+		return 1;
+
+	return 0;
+}
+
 bool
 FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetState& NewState)
 {
@@ -1149,6 +1463,15 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 		break;
 
 		case EHoudiniEngineTaskState::Aborted:
+		{
+			// The cook was interrupted because the HDA was modified while cooking,
+			// skip output processing and go back to PreCook to upload the changes and recook.
+			HOUDINI_LOG_MESSAGE(TEXT("   %s Cooking interrupted - recooking with the latest changes."), *DisplayName);
+			NewState = EHoudiniAssetState::PreCook;
+			return true;
+		}
+		break;
+
 		case EHoudiniEngineTaskState::FinishedWithFatalError:
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("   %s FinishedCooking with fatal errors - aborting."), *DisplayName);
@@ -1196,10 +1519,14 @@ FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::PreCook);
 
 	// Remove all Cooked (layers) before cooking so we don't received cooked data in Houdini
-	// if a landscape is input back to the HDA.
+	// if a landscape is input back to the HDA. Temporary edit layers on other landscapes are kept
+	// until the outputs are processed, so that only their modified regions are rewritten.
+	TArray<ALandscapeProxy*> AllInputLandscapes;
+	FHoudiniEngineUtils::GatherLandscapeInputs(HAC, AllInputLandscapes);
 	for (int Output = 0; Output < HAC->Outputs.Num(); Output++)
 	{
-		FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(HAC->Outputs[Output]);
+		TSet<FString> EditLayersToKeep = FHoudiniLandscapeTranslator::GetEditLayersToKeepBeforeCook(HAC->Outputs[Output], AllInputLandscapes);
+		FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(HAC->Outputs[Output], &EditLayersToKeep, true);
 	}
 
 	// Handle duplicated HAC
@@ -1226,6 +1553,9 @@ FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 		// // Handle loaded parameters
 		// FHoudiniParameterTranslator::UpdateLoadedParameters(HAC);
 
+		// Only upload the loaded parameter values that differ from the freshly instantiated node's
+		FHoudiniParameterTranslator::UploadLoadedParameters(HAC);
+
 		// Handle loaded inputs
 		FHoudiniInputTranslator::UpdateLoadedInputs(HAC);
 
@@ -29,6 +29,7 @@
 #include "HAPI/HAPI_Common.h"
 #include "TimerManager.h"
 #include "Containers/Ticker.h"
+#include "Misc/Guid.h"
 
 //#include "HAL/Runnable.h"
 //#include "HAL/RunnableThread.h"
@@ -38,6 +39,7 @@
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
+class FHoudiniEngineRuntime;
 
 struct FHoudiniEngineTaskInfo;
 struct FGuid;
@@ -57,6 +59,14 @@ public:
 	
 	bool Tick(float DeltaTime);
 
+	// Gathers the components of InRuntime that need to be processed on this tick.
+	// With an event driven tick, only the dirty HACs, the selected HACs and the "current" HAC are looked at.
+	void GatherComponentsToProcess(
+		FHoudiniEngineRuntime& InRuntime,
+		bool bInEventDrivenTick,
+		TArray<UHoudiniAssetComponent*>& OutComponentsToProcess,
+		TArray<UHoudiniAssetComponent*>& OutComponentsToRevisit);
+
 	// Updates / Process a component
 	void ProcessComponent(UHoudiniAssetComponent* HAC);
 
@@ -115,8 +125,13 @@ protected:
 		const FString& DisplayName,
 		bool bUseOutputNodes,
 		bool bOutputTemplateGeos,
+		const int32& Priority,
 		FGuid& OutTaskGUID);
 
+	// Returns the scheduling priority for a HAC's cook.
+	// Selected and visible HACs are cooked before background ones.
+	static int32 GetCookPriority(UHoudiniAssetComponent* HAC);
+
 	// Updates progress of the cooking task
 	// Returns true if a state change should be made
 	bool UpdateCooking(
@@ -170,6 +185,13 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Periodically saves a snapshot of the session in the background, when all the components are idle
+	void UpdateSessionSnapshot();
+
+	// Returns true while the scheduler is saving a session snapshot. The components must not be processed
+	// until it has finished, as their nodes would be modified while the scene is being saved.
+	bool IsSavingSessionSnapshot();
+
 private:
 
 	// Ticker handle, used for processing HAC.
@@ -206,4 +228,11 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<TWeakObjectPtr<const UHoudiniAssetComponent>> DisableAutoSavingHACs;
+
+	// Task saving the session snapshot, time of the last snapshot,
+	// and hash of the components' states at that time
+	FGuid SessionSnapshotTaskGUID;
+	double LastSessionSnapshotTime;
+	uint32 LastSessionSnapshotHash;
+	int32 NumSessionSnapshots;
 };
\ No newline at end of file
@@ -30,6 +30,18 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
+#include "HoudiniAsset.h"
+#include "HoudiniSessionSnapshot.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePrewarmedNodePoolSize(
+	TEXT("HoudiniEngine.PrewarmedNodePoolSize"),
+	2,
+	TEXT("Number of nodes instantiated and cooked in advance for each HDA that is placed more than once in a session.\n")
+	TEXT("Placing another copy of the HDA claims one of these nodes instead of instantiating a new one.\n")
+	TEXT("0: Disabled\n")
+);
 
 const uint32
 FHoudiniEngineScheduler::InitialTaskSize = 256u;
@@ -38,34 +50,18 @@ const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
 FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+	: CurrentTaskType(EHoudiniEngineTaskType::None)
+	, CurrentTaskPriority(0)
+	, bCurrentTaskCancelled(false)
 	, bStopping(false)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+	Tasks.Reserve(FHoudiniEngineScheduler::InitialTaskSize);
+	CurrentTaskGUID.Invalidate();
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
-	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
-	}
+	Tasks.Empty();
 }
 
 void
@@ -162,6 +158,27 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	// Translate asset name into Unreal string.
 	FString AssetName = ANSI_TO_TCHAR(AssetNameString.c_str());
 
+	// Use a prewarmed node if one is available, it has already been instantiated and cooked.
+	HAPI_NodeId PrewarmedNodeId = -1;
+	while (FHoudiniEngine::Get().ClaimPrewarmedNode(AssetName, Task.AssetLibraryId, PrewarmedNodeId))
+	{
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(PrewarmedNodeId))
+			continue;
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("HAPI Asynchronous Instantiation for %s: using prewarmed node %d."),
+			*Task.ActorName, PrewarmedNodeId);
+
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetInstantiation,
+			EHoudiniEngineTaskState::Success, PrewarmedNodeId, Task,
+			TEXT("Finished Instantiation."));
+
+		RefillPrewarmedNodePool(Task, AssetName);
+		return;
+	}
+
 	// Initialize last update time.
 	LastUpdateTime = FPlatformTime::Seconds();
 
@@ -205,6 +222,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 				EHoudiniEngineTaskState::Success, AssetId, Task,
 				TEXT("Finished Instantiation."));
 
+			RefillPrewarmedNodePool(Task, AssetName);
 			break;
 		}
 		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
@@ -305,6 +323,10 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	EHoudiniEngineTaskState GlobalTaskResult = EHoudiniEngineTaskState::Success;
 	for (auto& CurrentNodeId : NodesToCook)
 	{
+		// Don't start cooking the remaining nodes if the cook has been cancelled/superseded
+		if (GlobalTaskResult == EHoudiniEngineTaskState::Aborted)
+			break;
+
 		Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentNodeId, &CookOptions);
 		if (Result != HAPI_RESULT_SUCCESS)
 		{
@@ -329,14 +351,32 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		// Initialize last update time.
 		double LastUpdateTime = FPlatformTime::Seconds();
 
+		// Indicates we've asked HAPI to interrupt this cook
+		bool bInterrupted = false;
+
 		// We need to spin until cooking is finished.
 		while (true)
 		{
+			// If a newer cook has been requested for this node, this one is obsolete:
+			// interrupt it so the new one can start as soon as possible.
+			if (!bInterrupted && IsCurrentTaskCancelled())
+			{
+				HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Cooking Interrupted for %s., AssetId = %d"), *Task.ActorName, AssetId);
+				FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession());
+				bInterrupted = true;
+			}
+
 			int32 Status = HAPI_STATE_STARTING_COOK;
 			HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
 				FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
-			if (Status == HAPI_STATE_READY)
+			if (bInterrupted && Status <= HAPI_STATE_MAX_READY_STATE)
+			{
+				// The interrupted cook has stopped, no need to report its errors
+				GlobalTaskResult = EHoudiniEngineTaskState::Aborted;
+				break;
+			}
+			else if (Status == HAPI_STATE_READY)
 			{
 				// Cooking has been successful.
 				// Break to process the next node
@@ -401,8 +441,20 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		}
 		break;
 
-		case EHoudiniEngineTaskState::FinishedWithFatalError:
 		case EHoudiniEngineTaskState::Aborted:
+		{
+			// The cook was cancelled or superseded by a newer one
+			AddResponseMessageTaskInfo(
+				HAPI_RESULT_SUCCESS,
+				EHoudiniEngineTaskType::AssetCooking,
+				EHoudiniEngineTaskState::Aborted,
+				AssetId,
+				Task,
+				TEXT("Cooking Interrupted"));
+		}
+		break;
+
+		case EHoudiniEngineTaskState::FinishedWithFatalError:
 		case EHoudiniEngineTaskState::None:
 		case EHoudiniEngineTaskState::Working:
 		{
@@ -434,6 +486,185 @@ FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 	// At this point component most likely does not exist.
 }
 
+void
+FHoudiniEngineScheduler::TaskPreloadAssetLibrary(const FHoudiniEngineTask & Task)
+{
+	// We do not insert task info as this is a fire and forget operation.
+	// If the preload fails, the library will simply be loaded when the HDA is instantiated.
+	if (!FHoudiniEngineUtils::IsInitialized() || Task.AssetLibraryKey.IsEmpty())
+		return;
+
+	// The library might have been loaded since this task was queued, or a regular load might have taken over
+	HAPI_AssetLibraryId AssetLibraryId = -1;
+	if (FHoudiniEngine::Get().BeginAssetLibraryLoad(Task.AssetLibraryKey, AssetLibraryId) != EHoudiniAssetLibraryLoadState::Claimed)
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Library Preload Started for %s."), *Task.ActorName);
+
+	HAPI_Result Result = HAPI_RESULT_FAILURE;
+	const UHoudiniAsset* HoudiniAsset = Task.Asset.Get();
+	if (!Task.AssetLibraryFileName.IsEmpty())
+	{
+		std::string AssetFileNamePlain;
+		FHoudiniEngineUtils::ConvertUnrealString(Task.AssetLibraryFileName, AssetFileNamePlain);
+		Result = FHoudiniApi::LoadAssetLibraryFromFile(
+			FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &AssetLibraryId);
+	}
+	else if (HoudiniAsset && HoudiniAsset->GetAssetBytesCount() > 0)
+	{
+		Result = FHoudiniApi::LoadAssetLibraryFromMemory(
+			FHoudiniEngine::Get().GetSession(),
+			reinterpret_cast<const char *>(HoudiniAsset->GetAssetBytes()),
+			HoudiniAsset->GetAssetBytesCount(),
+			true,
+			&AssetLibraryId);
+	}
+
+	if (Result != HAPI_RESULT_SUCCESS)
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("HAPI Asynchronous Library Preload failed for %s: %s"),
+			*Task.ActorName, *FHoudiniEngineUtils::GetErrorDescription(Result));
+		AssetLibraryId = -1;
+	}
+
+	// Releases the regular loads waiting on this one
+	FHoudiniEngine::Get().EndAssetLibraryLoad(Task.AssetLibraryKey, AssetLibraryId);
+}
+
+void
+FHoudiniEngineScheduler::TaskSaveSessionSnapshot(const FHoudiniEngineTask & Task)
+{
+	// The manager waits for this task before processing the components again, always report its result.
+	if (!FHoudiniEngineUtils::IsInitialized() || !Task.SessionSnapshot.IsValid() || Task.SessionSnapshotFileName.IsEmpty())
+	{
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_FAILURE,
+			EHoudiniEngineTaskType::SessionSnapshotSave,
+			EHoudiniEngineTaskState::FinishedWithFatalError,
+			-1, Task, TEXT("Session snapshot can't be saved."));
+
+		return;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Session Snapshot Started: %s."), *Task.SessionSnapshotFileName);
+
+	if (!Task.SessionSnapshot->SaveHIPFile(Task.SessionSnapshotFileName))
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI Asynchronous Session Snapshot failed: %s."), *Task.SessionSnapshotFileName);
+
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_FAILURE,
+			EHoudiniEngineTaskType::SessionSnapshotSave,
+			EHoudiniEngineTaskState::FinishedWithFatalError,
+			-1, Task, TEXT("Error saving the session snapshot."));
+
+		return;
+	}
+
+	FHoudiniEngine::Get().SetSessionSnapshot(Task.SessionSnapshot);
+
+	AddResponseMessageTaskInfo(
+		HAPI_RESULT_SUCCESS,
+		EHoudiniEngineTaskType::SessionSnapshotSave,
+		EHoudiniEngineTaskState::Success,
+		-1, Task, TEXT("Finished Session Snapshot."));
+}
+
+void
+FHoudiniEngineScheduler::RefillPrewarmedNodePool(const FHoudiniEngineTask & Task, const FString & AssetName)
+{
+	const int32 PoolSize = CVarHoudiniEnginePrewarmedNodePoolSize.GetValueOnAnyThread();
+	if (PoolSize <= 0)
+		return;
+
+	// Only prewarm nodes for the HDAs that are placed repeatedly
+	if (FHoudiniEngine::Get().AddAssetInstantiation(AssetName, Task.AssetLibraryId) < 2)
+		return;
+
+	const int32 NumMissingNodes = PoolSize - FHoudiniEngine::Get().GetNumPrewarmedNodes(AssetName, Task.AssetLibraryId);
+	for (int32 Idx = 0; Idx < NumMissingNodes; Idx++)
+	{
+		// This is a fire and forget task, no need to keep its GUID.
+		// Use a lower priority than any cook, so that prewarming never delays the HACs being edited.
+		FHoudiniEngineTask PrewarmTask(EHoudiniEngineTaskType::AssetPrewarm, FGuid::NewGuid());
+		PrewarmTask.Asset = Task.Asset;
+		PrewarmTask.ActorName = Task.ActorName;
+		PrewarmTask.AssetLibraryId = Task.AssetLibraryId;
+		PrewarmTask.AssetHapiName = Task.AssetHapiName;
+		PrewarmTask.Priority = -1;
+		AddTask(PrewarmTask);
+	}
+}
+
+void
+FHoudiniEngineScheduler::TaskPrewarmAsset(const FHoudiniEngineTask & Task)
+{
+	// We do not insert task info as this is a fire and forget operation.
+	// If the prewarm fails, the next instantiation will simply create its own node.
+	if (!FHoudiniEngineUtils::IsInitialized() || Task.AssetHapiName < 0)
+		return;
+
+	std::string AssetNameString;
+	if (!FHoudiniEngineString(Task.AssetHapiName).ToStdString(AssetNameString))
+		return;
+
+	// The pool might have been refilled since this task was queued
+	const FString AssetName = ANSI_TO_TCHAR(AssetNameString.c_str());
+	if (FHoudiniEngine::Get().GetNumPrewarmedNodes(AssetName, Task.AssetLibraryId) >= CVarHoudiniEnginePrewarmedNodePoolSize.GetValueOnAnyThread())
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Prewarm Started for %s."), *Task.ActorName);
+
+	// Instantiate the node and cook it
+	HAPI_NodeId NodeId = -1;
+	HAPI_Result Result = FHoudiniApi::CreateNode(
+		FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[0], nullptr, true, &NodeId);
+	if (Result != HAPI_RESULT_SUCCESS)
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("HAPI Asynchronous Prewarm failed for %s: %s"),
+			*Task.ActorName, *FHoudiniEngineUtils::GetErrorDescription(Result));
+		return;
+	}
+
+	// Indicates we've asked HAPI to interrupt this cook
+	bool bInterrupted = false;
+
+	while (true)
+	{
+		// Prewarming must not hold the scheduler: give up as soon as a task with a higher priority is queued.
+		if (!bInterrupted && (IsCurrentTaskCancelled() || bStopping))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Prewarm Interrupted for %s."), *Task.ActorName);
+			FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession());
+			bInterrupted = true;
+		}
+
+		int Status = HAPI_STATE_STARTING_COOK;
+		Result = FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status);
+
+		if (Result == HAPI_RESULT_SUCCESS && Status == HAPI_STATE_READY && !bInterrupted)
+			break;
+
+		if (Result != HAPI_RESULT_SUCCESS
+			|| (bInterrupted && Status <= HAPI_STATE_MAX_READY_STATE)
+			|| Status == HAPI_STATE_READY_WITH_FATAL_ERRORS
+			|| Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+		{
+			// Don't keep nodes that failed to cook or were interrupted,
+			// the instantiation will create its own node and report the errors
+			FHoudiniEngineUtils::DeleteHoudiniNode(NodeId);
+			return;
+		}
+
+		// We want to yield.
+		FPlatformProcess::SleepNoStats(UpdateFrequency);
+	}
+
+	FHoudiniEngine::Get().AddPrewarmedNode(AssetName, Task.AssetLibraryId, NodeId);
+}
+
 void
 FHoudiniEngineScheduler::AddResponseTaskInfo(
 	HAPI_Result Result, EHoudiniEngineTaskType TaskType, EHoudiniEngineTaskState TaskState,
@@ -469,21 +700,8 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 		while (true)
 		{
 			FHoudiniEngineTask Task;
-
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
-
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
-
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+			if (!DequeueTask(Task))
+				break;
 
 			bool bTaskProcessed = true;
 
@@ -513,6 +731,24 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 					break;
 				}
 
+				case EHoudiniEngineTaskType::AssetLibraryPreload:
+				{
+					TaskPreloadAssetLibrary(Task);
+					break;
+				}
+
+				case EHoudiniEngineTaskType::AssetPrewarm:
+				{
+					TaskPrewarmAsset(Task);
+					break;
+				}
+
+				case EHoudiniEngineTaskType::SessionSnapshotSave:
+				{
+					TaskSaveSessionSnapshot(Task);
+					break;
+				}
+
 				default:
 				{
 					bTaskProcessed = false;
@@ -520,6 +756,14 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 				}
 			}
 
+			{
+				FScopeLock ScopeLock(&CriticalSection);
+				CurrentTaskGUID.Invalidate();
+				CurrentTaskType = EHoudiniEngineTaskType::None;
+				CurrentTaskPriority = 0;
+				bCurrentTaskCancelled = false;
+			}
+
 			if (!bTaskProcessed)
 				break;
 		}
@@ -592,7 +836,14 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 bool FHoudiniEngineScheduler::HasPendingTasks()
 {
 	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	return Tasks.Num() > 0;
+}
+
+int32
+FHoudiniEngineScheduler::GetPendingTaskCount()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return Tasks.Num();
 }
 
 void
@@ -600,55 +851,85 @@ FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
 	FScopeLock ScopeLock(&CriticalSection);
 
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
+	// A running prewarm only uses the scheduler while nothing more important needs it
+	if (CurrentTaskType == EHoudiniEngineTaskType::AssetPrewarm && Task.Priority > CurrentTaskPriority)
+		bCurrentTaskCancelled = true;
 
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
+	// Store task.
+	Tasks.Add(Task);
+}
 
-		if (!Buffer)
-			return;
+bool
+FHoudiniEngineScheduler::CancelTask(const FGuid & InHapiGUID)
+{
+	if (!InHapiGUID.IsValid())
+		return false;
 
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
+	FHoudiniEngineTask CancelledTask;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
 
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
+		if (CurrentTaskGUID == InHapiGUID)
 		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
+			// Only cooks and prewarms can be interrupted, other tasks are left to finish
+			if (CurrentTaskType == EHoudiniEngineTaskType::AssetCooking || CurrentTaskType == EHoudiniEngineTaskType::AssetPrewarm)
+				bCurrentTaskCancelled = true;
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
+			return true;
 		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
+		const int32 Idx = Tasks.IndexOfByPredicate([&InHapiGUID](const FHoudiniEngineTask& InTask) { return InTask.HapiGUID == InHapiGUID; });
+		if (Idx == INDEX_NONE)
+			return false;
 
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
+		CancelledTask = Tasks[Idx];
+		Tasks.RemoveAt(Idx);
+	}
+
+	// The task info is posted outside of the scheduler lock, the engine has its own
+	AddResponseMessageTaskInfo(
+		HAPI_RESULT_SUCCESS,
+		CancelledTask.TaskType,
+		EHoudiniEngineTaskState::Aborted,
+		CancelledTask.AssetId, CancelledTask, TEXT("Cancelled"));
+
+	return true;
+}
 
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
+bool
+FHoudiniEngineScheduler::DequeueTask(FHoudiniEngineTask & OutTask)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	// We have no tasks left.
+	if (Tasks.Num() <= 0)
+		return false;
+
+	// Find the oldest task with the highest priority
+	int32 NextIdx = 0;
+	for (int32 Idx = 1; Idx < Tasks.Num(); Idx++)
+	{
+		if (Tasks[Idx].Priority > Tasks[NextIdx].Priority)
+			NextIdx = Idx;
 	}
 
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
+	// Retrieve task.
+	OutTask = Tasks[NextIdx];
+	Tasks.RemoveAt(NextIdx);
 
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	CurrentTaskGUID = OutTask.HapiGUID;
+	CurrentTaskType = OutTask.TaskType;
+	CurrentTaskPriority = OutTask.Priority;
+	bCurrentTaskCancelled = false;
+
+	return true;
+}
+
+bool
+FHoudiniEngineScheduler::IsCurrentTaskCancelled()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	return bCurrentTaskCancelled;
 }
 
 uint32
@@ -49,9 +49,23 @@ public:
 
 	bool HasPendingTasks();
 
+	// Returns the number of tasks waiting to be processed.
+	int32 GetPendingTaskCount();
+
 	// Adds a task.
+	// A running prewarm is interrupted by any task with a higher priority.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Cancels the task with the given GUID.
+	// Pending tasks are removed from the queue, a running cook or prewarm is interrupted.
+	// In both cases, the task will report an Aborted state.
+	// Returns true if the task was found.
+	bool CancelTask(const FGuid & InHapiGUID);
+
+	// Removes the next task to process from the queue (the oldest task with the highest priority).
+	// Returns false if there are no pending tasks.
+	bool DequeueTask(FHoudiniEngineTask & OutTask);
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -91,9 +105,25 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
+	// Task : load an asset library in the session's library registry. 
+	void TaskPreloadAssetLibrary(const FHoudiniEngineTask & Task);
+
+	// Task : save a session snapshot, and make it the session's current snapshot.
+	void TaskSaveSessionSnapshot(const FHoudiniEngineTask & Task);
+
+	// Task : instantiate and cook a node, and add it to the asset's prewarmed node pool.
+	void TaskPrewarmAsset(const FHoudiniEngineTask & Task);
+
+	// Queues prewarm tasks for an asset that has just been instantiated, if it is placed repeatedly
+	// and its prewarmed node pool isn't full.
+	void RefillPrewarmedNodePool(const FHoudiniEngineTask & Task, const FString & AssetName);
+
+	// Returns true if the task currently being processed has been cancelled or superseded.
+	bool IsCurrentTaskCancelled();
+
 private:
 
-	// Initial number of tasks in our circular queue. 
+	// Initial number of tasks reserved in our queue. 
 	static const uint32 InitialTaskSize;
 
 	// Frequency update (sleep time between each update)
@@ -102,17 +132,16 @@ private:
 	// Synchronization primitive. 
 	FCriticalSection CriticalSection;
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
-
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// List of scheduled tasks, in the order they were added. 
+	TArray<FHoudiniEngineTask> Tasks;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Task currently being processed by the scheduler.
+	FGuid CurrentTaskGUID;
+	EHoudiniEngineTaskType CurrentTaskType;
+	int32 CurrentTaskPriority;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Indicates the current task has been cancelled or superseded and should stop asap.
+	bool bCurrentTaskCancelled;
 
 	// Stopping flag. 
 	bool bStopping;
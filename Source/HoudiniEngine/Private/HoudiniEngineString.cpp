@@ -308,6 +308,14 @@ void FHoudiniEngineIndexedStringMap::SetString(int Index, const FString& Value)
     Ids[Index] = Id;
 }
 
+void FHoudiniEngineIndexedStringMap::SetStrings(const TArray<FString>& Values)
+{
+    // Most attribute arrays only hold a handful of distinct values (empty strings, layer names, asset paths)
+    Reset(FMath::Min(Values.Num(), 64), Values.Num());
+    for (int Index = 0; Index < Values.Num(); Index++)
+        SetString(Index, Values[Index]);
+}
+
 
 FHoudiniEngineRawStrings FHoudiniEngineIndexedStringMap::GetRawStrings() const
 {
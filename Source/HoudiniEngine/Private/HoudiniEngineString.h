@@ -106,6 +106,11 @@ public:
     const FString& GetStringForIndex(int index) const;
     void SetString(int Index, const FString & value);
 
+    // Replaces the contents of the map with Values, Values[i] being stored at index i.
+    void SetStrings(const TArray<FString> & Values);
+
+    int GetNumUniqueStrings() const { return Strings.Num(); }
+
     FHoudiniEngineRawStrings GetRawStrings() const;
 
     const TArray<StringId> & GetIds() const { return Ids; }
@@ -31,6 +31,8 @@
 #include "Misc/Guid.h"
 #include "UObject/WeakObjectPtr.h"
 
+class FHoudiniSessionSnapshot;
+
 /*
 namespace EHoudiniEngineTaskType
 {
@@ -66,6 +68,15 @@ enum class EHoudiniEngineTaskType : uint8
 
 	// This type is used when processing the results of a sucessful cook
 	AssetProcess,
+
+	// This type is used to load an HDA library in the background, before it is needed.
+	AssetLibraryPreload,
+
+	// This type is used to instantiate and cook a node in advance, for the HDAs that are placed repeatedly.
+	AssetPrewarm,
+
+	// This type is used to save a snapshot of the session in the background.
+	SessionSnapshotSave,
 };
 
 struct HOUDINIENGINE_API FHoudiniEngineTask
@@ -104,6 +115,20 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Key of the asset library in the session's library registry.
+	FString AssetLibraryKey;
+
+	// File to load the asset library from, if empty the Asset's memory copy is used.
+	FString AssetLibraryFileName;
+
+	// Session snapshot to save, and the file to save it to.
+	TSharedPtr<FHoudiniSessionSnapshot> SessionSnapshot;
+	FString SessionSnapshotFileName;
+
+	// Priority of the task, tasks with a higher priority are processed first.
+	// Tasks with the same priority are processed in the order they were added.
+	int32 Priority;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
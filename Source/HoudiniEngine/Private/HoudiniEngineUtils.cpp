@@ -52,9 +52,11 @@
 #include "HoudiniEngineTimers.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniHapiInfoCache.h"
 #include "HoudiniInput.h"
 #include "HoudiniParameter.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniSessionSnapshot.h"
 
 #if WITH_EDITOR
 	#include "SAssetSelectionWidget.h"
@@ -80,6 +82,7 @@
 #include "Interfaces/IPluginManager.h"
 #include "LandscapeStreamingProxy.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/StringFormatArg.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
@@ -402,7 +405,7 @@ FHoudiniEngineUtils::GetConnectionError()
 }
 
 void
-FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation()
+FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation(const TSet<UHoudiniAssetComponent*>& InRestoredHACs)
 {	
 	// Notify all the HoudiniAssetComponents that they need to re instantiate themselves in the new Houdini engine session.
 	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
@@ -411,10 +414,75 @@ FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation()
 		if (!IsValid(HoudiniAssetComponent))
 			continue;
 
+		if (InRestoredHACs.Contains(HoudiniAssetComponent))
+			continue;
+
 		HoudiniAssetComponent->MarkAsNeedInstantiation();
 	}
 }
 
+void
+FHoudiniEngineUtils::RestoreSessionSnapshot(TSet<UHoudiniAssetComponent*>& OutRestoredHACs)
+{
+	OutRestoredHACs.Empty();
+
+	// A snapshot can only be restored once, its file is deleted on every path out of here
+	TSharedPtr<FHoudiniSessionSnapshot> Snapshot = FHoudiniEngine::Get().GetSessionSnapshot();
+	if (!Snapshot.IsValid())
+		return;
+
+	ON_SCOPE_EXIT
+	{
+		Snapshot->DeleteHIPFile();
+		FHoudiniEngine::Get().SetSessionSnapshot(nullptr);
+	};
+
+	if (!Snapshot->IsSaved())
+		return;
+
+	TArray<UHoudiniAssetComponent*> HACs;
+	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
+	{
+		UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
+		if (IsValid(HoudiniAssetComponent) && Snapshot->IsComponentCaptured(HoudiniAssetComponent))
+			HACs.Add(HoudiniAssetComponent);
+	}
+
+	if (HACs.Num() <= 0)
+		return;
+
+	// The HDAs need to be loaded before the snapshot, or their nodes could not be recreated
+	for (UHoudiniAssetComponent* HAC : HACs)
+	{
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+		if (!FHoudiniEngineUtils::LoadHoudiniAsset(HAC->GetHoudiniAsset(), AssetLibraryId))
+			HOUDINI_LOG_WARNING(TEXT("Failed to load the HDA of %s before restoring the session snapshot."), *HAC->GetDisplayName());
+	}
+
+	if (!Snapshot->Restore())
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to restore the Houdini Engine session snapshot."));
+		return;
+	}
+
+	for (UHoudiniAssetComponent* HAC : HACs)
+	{
+		if (Snapshot->RestoreComponent(HAC))
+			OutRestoredHACs.Add(HAC);
+	}
+
+	// Delete the nodes of the components that were deleted, modified or couldn't be restored,
+	// and any other node under /obj that no restored component claims
+	TArray<HAPI_NodeId> OrphanedNodeIds;
+	Snapshot->GetOrphanedNodeIds(OrphanedNodeIds);
+	for (const HAPI_NodeId& NodeId : OrphanedNodeIds)
+		FHoudiniEngineUtils::DeleteHoudiniNode(NodeId);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Restored %d of %d Houdini Asset Components from the session snapshot."),
+		OutRestoredHACs.Num(), HACs.Num());
+}
+
 const FString
 FHoudiniEngineUtils::GetNodeErrorsWarningsAndMessages(const HAPI_NodeId& InNodeId)
 {
@@ -1695,9 +1763,138 @@ FHoudiniEngineUtils::LocateLibHAPIInRegistry(
 }
 #endif
 
+// Returns the absolute path of the file an HDA should be loaded from
+static FString
+GetHoudiniAssetLibraryFileName(const UHoudiniAsset* HoudiniAsset)
+{
+	// Use the AssetImportData's file path if we have it
+	FString AssetFileName = (HoudiniAsset->AssetImportData != nullptr) ? HoudiniAsset->AssetImportData->GetFirstFilename() : HoudiniAsset->GetAssetFileName();
+	// We need to convert relative file path to absolute
+	if (FPaths::IsRelative(AssetFileName))
+		AssetFileName = FPaths::ConvertRelativePathToFull(AssetFileName);
+
+	// We need to modify the file name for expanded .hdas
+	FString FileExtension = FPaths::GetExtension(AssetFileName);
+	if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
+	{
+		// The .hda directory is what we should be loading
+		AssetFileName = FPaths::GetPath(AssetFileName);
+	}
+
+	return AssetFileName;
+}
+
+FString
+FHoudiniEngineUtils::GetAssetLibraryKey(const UHoudiniAsset* HoudiniAsset, const bool& bFromMemory, const FString& AssetFileName)
+{
+	if (!IsValid(HoudiniAsset) || HoudiniAsset->IsExpandedHDA())
+		return FString();
+
+	if (bFromMemory)
+	{
+		return FString::Printf(TEXT("mem:%016llx:%u"), HoudiniAsset->GetAssetBytesHash(), HoudiniAsset->GetAssetBytesCount());
+	}
+
+	// Hashing the file itself would cost as much as loading it, use its timestamp and size instead,
+	// so that an HDA modified on disk is reloaded.
+	const FFileStatData FileStat = IFileManager::Get().GetStatData(*AssetFileName);
+	if (!FileStat.bIsValid)
+		return FString();
+
+	return FString::Printf(TEXT("file:%s:%lld:%lld"), *AssetFileName, FileStat.FileSize, FileStat.ModificationTime.GetTicks());
+}
+
+void
+FHoudiniEngineUtils::PreloadHoudiniAssets(const TArray<const UHoudiniAsset*>& HoudiniAssets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::PreloadHoudiniAssets);
+
+	if (!FHoudiniEngine::Get().GetSession() || !FHoudiniEngineUtils::IsInitialized())
+		return;
+
+	bool bMemoryCopyFirst = false;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings)
+		bMemoryCopyFirst = HoudiniRuntimeSettings->bPreferHdaMemoryCopyOverHdaSourceFile;
+
+	for (const UHoudiniAsset* HoudiniAsset : HoudiniAssets)
+	{
+		if (!IsValid(HoudiniAsset) || HoudiniAsset->IsExpandedHDA())
+			continue;
+
+		// Use the same source LoadHoudiniAsset would
+		const FString AssetFileName = GetHoudiniAssetLibraryFileName(HoudiniAsset);
+		const bool bCanLoadFromMemory = HoudiniAsset->GetAssetBytesCount() > 0;
+		const bool bCanLoadFromFile = !AssetFileName.IsEmpty() && FPaths::FileExists(AssetFileName);
+
+		bool bFromMemory = false;
+		if (bMemoryCopyFirst)
+			bFromMemory = bCanLoadFromMemory;
+		else
+			bFromMemory = !bCanLoadFromFile && bCanLoadFromMemory;
+
+		if (!bFromMemory && !bCanLoadFromFile)
+			continue;
+
+		// Registering the library as queued lets a regular load of the same HDA take over the preload
+		const FString LibraryKey = GetAssetLibraryKey(HoudiniAsset, bFromMemory, AssetFileName);
+		if (!FHoudiniEngine::Get().QueueAssetLibraryLoad(LibraryKey))
+			continue;
+
+		// This is a fire and forget task, no need to keep its GUID
+		FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetLibraryPreload, FGuid::NewGuid());
+		Task.Asset = const_cast<UHoudiniAsset*>(HoudiniAsset);
+		Task.ActorName = HoudiniAsset->GetName();
+		Task.AssetLibraryKey = LibraryKey;
+		Task.AssetLibraryFileName = bFromMemory ? FString() : AssetFileName;
+		FHoudiniEngine::Get().AddTask(Task);
+	}
+}
+
+HAPI_Result
+FHoudiniEngineUtils::LoadAssetLibrary(
+	const FString& InLibraryKey,
+	TFunctionRef<HAPI_Result(HAPI_AssetLibraryId&)> InLoadFunc,
+	HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	OutAssetLibraryId = -1;
+
+	// Libraries that can't be shared are always loaded
+	if (InLibraryKey.IsEmpty())
+		return InLoadFunc(OutAssetLibraryId);
+
+	// Wait for a load of the same library on another thread, the scheduler's preload for instance.
+	// Loading a single library shouldn't take that long, past that the library is loaded again.
+	const double MaxWaitTime = 60.0;
+	const double StartTime = FPlatformTime::Seconds();
+	EHoudiniAssetLibraryLoadState LoadState = FHoudiniEngine::Get().BeginAssetLibraryLoad(InLibraryKey, OutAssetLibraryId);
+	while (LoadState == EHoudiniAssetLibraryLoadState::Loading && FPlatformTime::Seconds() - StartTime < MaxWaitTime)
+	{
+		FPlatformProcess::Sleep(0.01f);
+		LoadState = FHoudiniEngine::Get().BeginAssetLibraryLoad(InLibraryKey, OutAssetLibraryId);
+	}
+
+	if (LoadState == EHoudiniAssetLibraryLoadState::Loaded)
+		return HAPI_RESULT_SUCCESS;
+
+	if (LoadState == EHoudiniAssetLibraryLoadState::Loading)
+		HOUDINI_LOG_WARNING(TEXT("Timed out waiting for another load of the same HDA library, loading it again."));
+
+	HAPI_Result Result = InLoadFunc(OutAssetLibraryId);
+	if (Result != HAPI_RESULT_SUCCESS)
+		OutAssetLibraryId = -1;
+
+	if (LoadState == EHoudiniAssetLibraryLoadState::Claimed)
+		FHoudiniEngine::Get().EndAssetLibraryLoad(InLibraryKey, OutAssetLibraryId);
+
+	return Result;
+}
+
 bool
 FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId& OutAssetLibraryId)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::LoadHoudiniAsset);
+
 	OutAssetLibraryId = -1;
 
 	if (!IsValid(HoudiniAsset))
@@ -1716,19 +1913,8 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	if (HoudiniRuntimeSettings)
 		bMemoryCopyFirst = HoudiniRuntimeSettings->bPreferHdaMemoryCopyOverHdaSourceFile;
 
-	// Get the HDA's file path, using the AssetImportData if we have it
-	FString AssetFileName = (HoudiniAsset->AssetImportData != nullptr) ? HoudiniAsset->AssetImportData->GetFirstFilename() : HoudiniAsset->GetAssetFileName();
-	// We need to convert relative file path to absolute
-	if (FPaths::IsRelative(AssetFileName))
-		AssetFileName = FPaths::ConvertRelativePathToFull(AssetFileName);
-
-	// We need to modify the file name for expanded .hdas
-	FString FileExtension = FPaths::GetExtension(AssetFileName);
-	if (FileExtension.Compare(TEXT("hdalibrary"), ESearchCase::IgnoreCase) == 0)
-	{
-		// the .hda directory is what we should be loading
-		AssetFileName = FPaths::GetPath(AssetFileName);
-	}
+	// Get the HDA's file path
+	FString AssetFileName = GetHoudiniAssetLibraryFileName(HoudiniAsset);
 
 	//Check whether we can Load from file/memory
 	bool bCanLoadFromMemory = (!HoudiniAsset->IsExpandedHDA() && HoudiniAsset->GetAssetBytesCount() > 0);
@@ -1771,26 +1957,35 @@ FHoudiniEngineUtils::LoadHoudiniAsset(const UHoudiniAsset * HoudiniAsset, HAPI_A
 	};
 
 	// Lambda to load an HDA from file
-	auto LoadAssetFromFile = [&Result, &OutAssetLibraryId](const FString& InAssetFileName)
-	{
-		// Load the asset from file.
-		std::string AssetFileNamePlain;
-		FHoudiniEngineUtils::ConvertUnrealString(InAssetFileName, AssetFileNamePlain);
-		Result = FHoudiniApi::LoadAssetLibraryFromFile(
-			FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutAssetLibraryId);
-
+	auto LoadAssetFromFile = [&Result, &OutAssetLibraryId, HoudiniAsset](const FString& InAssetFileName)
+	{
+		// No need to load the file again if it's already been loaded in this session
+		const FString LibraryKey = FHoudiniEngineUtils::GetAssetLibraryKey(HoudiniAsset, false, InAssetFileName);
+		Result = FHoudiniEngineUtils::LoadAssetLibrary(LibraryKey, [&InAssetFileName](HAPI_AssetLibraryId& OutLoadedLibraryId)
+		{
+			// Load the asset from file.
+			std::string AssetFileNamePlain;
+			FHoudiniEngineUtils::ConvertUnrealString(InAssetFileName, AssetFileNamePlain);
+			return FHoudiniApi::LoadAssetLibraryFromFile(
+				FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutLoadedLibraryId);
+		}, OutAssetLibraryId);
 	};
 
 	// Lambda to load an HDA from memory
 	auto LoadAssetFromMemory = [&Result, &OutAssetLibraryId](const UHoudiniAsset* InHoudiniAsset)
 	{
-		// Load the asset from the cached memory buffer
-		Result = FHoudiniApi::LoadAssetLibraryFromMemory(
-			FHoudiniEngine::Get().GetSession(),
-			reinterpret_cast<const char *>(InHoudiniAsset->GetAssetBytes()),
-			InHoudiniAsset->GetAssetBytesCount(), 
-			true,
-			&OutAssetLibraryId);
+		// No need to transfer the HDA again if the same content has already been loaded in this session
+		const FString LibraryKey = FHoudiniEngineUtils::GetAssetLibraryKey(InHoudiniAsset, true, FString());
+		Result = FHoudiniEngineUtils::LoadAssetLibrary(LibraryKey, [InHoudiniAsset](HAPI_AssetLibraryId& OutLoadedLibraryId)
+		{
+			// Load the asset from the cached memory buffer
+			return FHoudiniApi::LoadAssetLibraryFromMemory(
+				FHoudiniEngine::Get().GetSession(),
+				reinterpret_cast<const char *>(InHoudiniAsset->GetAssetBytes()),
+				InHoudiniAsset->GetAssetBytesCount(), 
+				true,
+				&OutLoadedLibraryId);
+		}, OutAssetLibraryId);
 	};
 
 	if (!bMemoryCopyFirst)
@@ -4394,29 +4589,37 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 {
     H_SCOPED_FUNCTION_TIMER();
 
-	int32 NumValues = InFloatValues.Num();
-	if (NumValues < 1)
+	return HapiSetHeightFieldData(InNodeId, InPartId, InFloatValues.GetData(), 0, InFloatValues.Num(), InHeightfieldName);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiSetHeightFieldData(
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	const float* InFloatValues,
+	const int32& InStart,
+	const int32& InCount,
+	const FString& InHeightfieldName)
+{
+	if (InCount < 1 || !InFloatValues)
 		return HAPI_RESULT_INVALID_ARGUMENT;
 
 	// Get the volume name as std::string
 	std::string NameStr;
 	FHoudiniEngineUtils::ConvertUnrealString(InHeightfieldName, NameStr);
 
-	// Get the Heighfield float data
-	const float* HeightData = InFloatValues.GetData();
-
 	int32 ChunkSize = THRIFT_MAX_CHUNKSIZE;
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
-	if (NumValues > ChunkSize)
+	if (InCount > ChunkSize)
 	{
 		// Send the heightfield data in chunks
-		for (int32 ChunkStart = 0; ChunkStart < NumValues; ChunkStart += ChunkSize)
+		for (int32 ChunkStart = 0; ChunkStart < InCount; ChunkStart += ChunkSize)
 		{
-			int32 CurCount = NumValues - ChunkStart > ChunkSize ? ChunkSize : NumValues - ChunkStart;
+			int32 CurCount = InCount - ChunkStart > ChunkSize ? ChunkSize : InCount - ChunkStart;
 			
 			Result = FHoudiniApi::SetHeightFieldData(
 				FHoudiniEngine::Get().GetSession(),
-				InNodeId, InPartId, NameStr.c_str(), &HeightData[ChunkStart], ChunkStart, CurCount);
+				InNodeId, InPartId, NameStr.c_str(), &InFloatValues[ChunkStart], InStart + ChunkStart, CurCount);
 
 			if (Result != HAPI_RESULT_SUCCESS)
 				break;
@@ -4426,7 +4629,7 @@ FHoudiniEngineUtils::HapiSetHeightFieldData(
 	{
 		Result = FHoudiniApi::SetHeightFieldData(
 			FHoudiniEngine::Get().GetSession(),
-			InNodeId, InPartId, NameStr.c_str(), HeightData, 0, InFloatValues.Num());
+			InNodeId, InPartId, NameStr.c_str(), InFloatValues, InStart, InCount);
 	}
 
 	return Result;
@@ -4837,10 +5040,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+				(HAPI_AttributeOwner)AttrIdx, AttributeInfo), false);
 
 			if (AttributeInfo.exists)
 				break;
@@ -4848,10 +5050,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 	}
 	else
 	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), 
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			InOwner, AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5070,10 +5271,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+				(HAPI_AttributeOwner)AttrIdx, AttributeInfo), false);
 
 			if (AttributeInfo.exists)
 				break;
@@ -5081,10 +5281,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	}
 	else
 	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			InOwner, AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5255,10 +5454,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+				(HAPI_AttributeOwner)AttrIdx, AttributeInfo), false);
 
 			if (AttributeInfo.exists)
 				break;
@@ -5266,10 +5464,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 	}
 	else
 	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			InOwner, AttributeInfo), false);
 	}
 
 	if (!AttributeInfo.exists)
@@ -5407,6 +5604,65 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
 }
 
 
+HAPI_Result
+FHoudiniEngineUtils::HapiGetGeoInfo(const HAPI_NodeId& NodeId, HAPI_GeoInfo& OutGeoInfo)
+{
+	if (FHoudiniHapiInfoCache* InfoCache = FHoudiniHapiInfoCache::Get())
+		return InfoCache->GetGeoInfo(NodeId, OutGeoInfo);
+
+	return FHoudiniApi::GetGeoInfo(FHoudiniEngine::Get().GetSession(), NodeId, &OutGeoInfo);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiGetPartInfo(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, HAPI_PartInfo& OutPartInfo)
+{
+	if (FHoudiniHapiInfoCache* InfoCache = FHoudiniHapiInfoCache::Get())
+		return InfoCache->GetPartInfo(GeoId, PartId, OutPartInfo);
+
+	return FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoId, PartId, &OutPartInfo);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiGetAttributeInfo(
+	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
+	const char * AttribName, const HAPI_AttributeOwner& Owner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	if (FHoudiniHapiInfoCache* InfoCache = FHoudiniHapiInfoCache::Get())
+		return InfoCache->GetAttributeInfo(GeoId, PartId, AttribName, Owner, OutAttributeInfo);
+
+	return FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, Owner, &OutAttributeInfo);
+}
+
+HAPI_Result
+FHoudiniEngineUtils::HapiGetAttributeNames(
+	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
+	const HAPI_AttributeOwner& Owner, TArray<FString>& OutAttributeNames)
+{
+	if (FHoudiniHapiInfoCache* InfoCache = FHoudiniHapiInfoCache::Get())
+		return InfoCache->GetAttributeNames(GeoId, PartId, Owner, OutAttributeNames);
+
+	OutAttributeNames.Empty();
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HAPI_Result Result = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	int32 AttribCount = PartInfo.attributeCounts[Owner];
+	TArray<HAPI_StringHandle> AttribNameSHArray;
+	AttribNameSHArray.SetNum(AttribCount);
+	Result = FHoudiniApi::GetAttributeNames(
+		FHoudiniEngine::Get().GetSession(), GeoId, PartId, Owner, AttribNameSHArray.GetData(), AttribCount);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, OutAttributeNames);
+	return Result;
+}
+
 bool
 FHoudiniEngineUtils::HapiCheckAttributeExists(
 	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
@@ -5427,9 +5683,8 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 		HAPI_AttributeInfo AttribInfo;
 		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			GeoId, PartId, AttribName, Owner, &AttribInfo), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
+			GeoId, PartId, AttribName, Owner, AttribInfo), false);
 
 		return AttribInfo.exists;
 	}
@@ -5466,27 +5721,12 @@ FHoudiniEngineUtils::IsAttributeInstancer(const HAPI_NodeId& GeoId, const HAPI_P
 
 bool FHoudiniEngineUtils::IsValidDataTable(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId)
 {
-	HAPI_PartInfo PartInfo;
-	HAPI_Result Error = FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, &PartInfo);
-	if (Error != HAPI_RESULT_SUCCESS)
-	{
-		return false;
-	}
-	TArray<HAPI_StringHandle> AttribNameHandles;
-	AttribNameHandles.SetNum(PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
-	Error = FHoudiniApi::GetAttributeNames(FHoudiniEngine::Get().GetSession(),
-		GeoId,
-		PartId,
-		HAPI_ATTROWNER_POINT,
-		AttribNameHandles.GetData(),
-		PartInfo.attributeCounts[HAPI_ATTROWNER_POINT]);
+	TArray<FString> AttribNames;
+	HAPI_Result Error = FHoudiniEngineUtils::HapiGetAttributeNames(GeoId, PartId, HAPI_ATTROWNER_POINT, AttribNames);
 	if (Error != HAPI_RESULT_SUCCESS)
 	{
 		return false;
 	}
-	TArray<FString> AttribNames;
-	FHoudiniEngineString::SHArrayToFStringArray(AttribNameHandles, AttribNames);
 	for (const FString & Name : AttribNames)
 	{
 		if (Name.StartsWith(HAPI_UNREAL_ATTRIB_DATA_TABLE_PREFIX) && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWNAME && Name != HAPI_UNREAL_ATTRIB_DATA_TABLE_ROWSTRUCT)
@@ -5626,10 +5866,9 @@ bool FHoudiniEngineUtils::HapiGetAttributeIntOrIntArray(const HAPI_NodeId& GeoId
 	const FString& AttribName, const HAPI_AttributeOwner& AttributeOwner, HAPI_AttributeInfo& OutAttributeInfo,
 	TArray<int32>& OutData)
 {
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-		FHoudiniEngine::Get().GetSession(),
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 		GeoId, PartId,
-		TCHAR_TO_UTF8(*AttribName), AttributeOwner, &OutAttributeInfo), false);
+		TCHAR_TO_UTF8(*AttribName), AttributeOwner, OutAttributeInfo), false);
 
 	if (OutAttributeInfo.storage == HAPI_STORAGETYPE_INT)
 	{
@@ -5673,10 +5912,9 @@ bool FHoudiniEngineUtils::HapiGetAttributeFloatOrFloatArray(const HAPI_NodeId& G
 	const HAPI_AttributeOwner& AttributeOwner, HAPI_AttributeInfo& OutAttributeInfo, TArray<float>& OutData)
 {
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-		FHoudiniEngine::Get().GetSession(),
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeInfo(
 		GeoId, PartId,
-		TCHAR_TO_UTF8(*AttribName), AttributeOwner, &OutAttributeInfo), false);
+		TCHAR_TO_UTF8(*AttribName), AttributeOwner, OutAttributeInfo), false);
 
 	if (OutAttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
 	{
@@ -5767,26 +6005,10 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 {
 	int32 NumberOfAttributeFound = 0;
 
-	// Get the part infos
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, &PartInfo), NumberOfAttributeFound);
-
 	// Get All attribute names for that part
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		GeoId, PartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount), NumberOfAttributeFound);
-
 	TArray<FString> AttribNameArray;
-	FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNameArray);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiGetAttributeNames(
+		GeoId, PartId, AttributeOwner, AttribNameArray), NumberOfAttributeFound);
 
 	// Iterate on all the attributes, and get their part infos to get their type
 	for (int32 Idx = 0; Idx < AttribNameArray.Num(); Idx++)
@@ -5797,10 +6019,9 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 		HAPI_AttributeInfo AttrInfo;
 		FHoudiniApi::AttributeInfo_Init(&AttrInfo);
 
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
+		if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetAttributeInfo(
 			GeoId, PartId, TCHAR_TO_UTF8(*HapiString),
-			AttributeOwner, &AttrInfo))
+			AttributeOwner, AttrInfo))
 			continue;
 
 		if (!AttrInfo.exists)
@@ -6612,21 +6833,10 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::GetGenericAttributeList);
 	
-	// Get the part info to get the attribute counts for the specified owner
-	HAPI_PartInfo PartInfo;
-	FHoudiniApi::PartInfo_Init(&PartInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
-		FHoudiniEngine::Get().GetSession(), InGeoNodeId, InPartId, &PartInfo), false);
-	
-	int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
 	// Get all attribute names for that part
-	TArray<HAPI_StringHandle> AttribNameSHArray;
-	AttribNameSHArray.SetNum(nAttribCount);
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
-		FHoudiniEngine::Get().GetSession(),
-		InGeoNodeId, InPartId, AttributeOwner,
-		AttribNameSHArray.GetData(), nAttribCount))
+	TArray<FString> AttribNames;
+	if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetAttributeNames(
+		InGeoNodeId, InPartId, AttributeOwner, AttribNames))
 	{
 		return 0;
 	}	
@@ -6644,21 +6854,17 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 	}
 
 	int32 FoundCount = 0;
-	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
+	for (const FString& AttribName : AttribNames)
 	{
-		int32 AttribNameSH = (int32)AttribNameSHArray[Idx];
-		FString AttribName = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSH, AttribName);
 		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
 			continue;
 
 		// Get the Attribute Info
 		HAPI_AttributeInfo AttribInfo;
 		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
+		if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetAttributeInfo(
 			InGeoNodeId, InPartId,
-			TCHAR_TO_UTF8(*AttribName), AttributeOwner, &AttribInfo))
+			TCHAR_TO_UTF8(*AttribName), AttributeOwner, AttribInfo))
 		{
 			// failed to get that attribute's info
 			continue;
@@ -8546,6 +8752,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 			FHoudiniEngine::Get().GetSession(), InNodeId, InCookOptions), false);
 	}
 
+	// The cached infos of the cooked nodes must be checked again
+	FHoudiniHapiInfoCache::NotifyNodeCooked();
+
 	// If we don't need to wait for completion, return now
 	if (!bWaitForCompletion)
 		return true;
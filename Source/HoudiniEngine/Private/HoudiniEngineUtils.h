@@ -99,7 +99,12 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		// Helper function used to indicate to all HAC that they need to be instantiated in the new HE session
 		// Needs to be call after starting/restarting/connecting/session syncing a HE session..
-		static void MarkAllHACsAsNeedInstantiation();
+		// The HACs that have been restored from a session snapshot are skipped.
+		static void MarkAllHACsAsNeedInstantiation(const TSet<UHoudiniAssetComponent*>& InRestoredHACs = TSet<UHoudiniAssetComponent*>());
+
+		// Restores the HACs from the snapshot of the previous session, they won't need to be instantiated again.
+		// Needs to be called right after restarting a HE session, as it replaces the whole Houdini scene.
+		static void RestoreSessionSnapshot(TSet<UHoudiniAssetComponent*>& OutRestoredHACs);
 
 		// Return the errors, warning and messages on a specified node
 		static const FString GetNodeErrorsWarningsAndMessages(const HAPI_NodeId& InNodeId);
@@ -285,6 +290,31 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const int32& InStartIndex = 0,
 			const int32& InCount = -1);
 
+		// HAPI : Get the geo, part and attribute infos.
+		// While a FHoudiniScopedHapiInfoCache is alive, these are cached until the node is cooked again.
+		static HAPI_Result HapiGetGeoInfo(
+			const HAPI_NodeId& NodeId,
+			HAPI_GeoInfo& OutGeoInfo);
+
+		static HAPI_Result HapiGetPartInfo(
+			const HAPI_NodeId& GeoId,
+			const HAPI_PartId& PartId,
+			HAPI_PartInfo& OutPartInfo);
+
+		static HAPI_Result HapiGetAttributeInfo(
+			const HAPI_NodeId& GeoId,
+			const HAPI_PartId& PartId,
+			const char * AttribName,
+			const HAPI_AttributeOwner& Owner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// HAPI : Get the names of all the attributes of a given owner.
+		static HAPI_Result HapiGetAttributeNames(
+			const HAPI_NodeId& GeoId,
+			const HAPI_PartId& PartId,
+			const HAPI_AttributeOwner& Owner,
+			TArray<FString>& OutAttributeNames);
+
 		// HAPI : Check if given attribute exists.
 		static bool HapiCheckAttributeExists(
 			const HAPI_NodeId& GeoId,
@@ -380,9 +410,31 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		static bool DeleteHoudiniNode(const HAPI_NodeId& InNodeId);
 
 		// Loads an HDA file and returns its AssetLibraryId
+		// HDAs that have already been loaded in the current session are not loaded again.
 		static bool LoadHoudiniAsset(
 			const UHoudiniAsset * HoudiniAsset,
 			HAPI_AssetLibraryId & OutAssetLibraryId);
+
+		// Returns the key identifying an HDA library in the session's asset library registry.
+		// Libraries loaded from memory are identified by their content hash,
+		// libraries loaded from file by their path, size and timestamp.
+		// Returns an empty string if the library should not be shared (expanded HDAs).
+		static FString GetAssetLibraryKey(
+			const UHoudiniAsset * HoudiniAsset,
+			const bool& bFromMemory,
+			const FString& AssetFileName);
+
+		// Loads a library through the session's asset library registry: a library that is already loaded is reused,
+		// and a library that another thread is loading is waited for. Otherwise, InLoadFunc is called and the library
+		// it loads is registered. Libraries with an empty key are always loaded and never registered.
+		static HAPI_Result LoadAssetLibrary(
+			const FString& InLibraryKey,
+			TFunctionRef<HAPI_Result(HAPI_AssetLibraryId&)> InLoadFunc,
+			HAPI_AssetLibraryId& OutAssetLibraryId);
+
+		// Queues background loads, in the current session, of the libraries of the given HDAs
+		// that haven't been loaded yet. Used to preload all the HDAs used by a level when it is opened.
+		static void PreloadHoudiniAssets(const TArray<const UHoudiniAsset*>& HoudiniAssets);
 		
 		// Returns the name of the available subassets in a loaded HDA
 		static bool GetSubAssetNames(
@@ -664,6 +716,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const TArray<float>& InFloatValues,
 			const FString& InHeightfieldName);
 
+		// Sets InCount heightfield values, starting at InStart
+		// The data will be sent in chunks if too large for thrift
+		static HAPI_Result HapiSetHeightFieldData(
+			const HAPI_NodeId& InNodeId,
+			const HAPI_PartId& InPartId,
+			const float* InFloatValues,
+			const int32& InStart,
+			const int32& InCount,
+			const FString& InHeightfieldName);
+
 		// Helper function to get Heightfield data
 		// The data will be read in chunks if too large for thrift
 		static HAPI_Result HapiGetHeightFieldData(
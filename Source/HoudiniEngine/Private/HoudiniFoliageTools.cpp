@@ -42,6 +42,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Spatial/PointHashGrid3.h"
 #include "Curves/RichCurve.h"
+#include "GameFramework/WorldSettings.h"
 
 #if WITH_EDITOR
 #include "EditorModeManager.h"
@@ -182,50 +183,77 @@ TArray<FFoliageInstance> FHoudiniFoliageTools::GetAllFoliageInstances(UWorld* In
 
 void FHoudiniFoliageTools::SpawnFoliageInstances(UWorld* InWorld, UFoliageType* Settings, const TArray<FFoliageInstance>& InstancesToPlace, const TArray<FFoliageAttachmentInfo>& AttachmentInfo)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniFoliageTools::SpawnFoliageInstances);
+
 	// This code is largely cribbed from SpawnFoliageInstance() in UE5's FoliageEdMode.cpp. It has UI specific functionality removed.
 
-	TMap<AInstancedFoliageActor*, TArray<int>> PerIFAInstances;
+	if (!IsValid(InWorld) || !IsValid(Settings) || InstancesToPlace.Num() <= 0)
+		return;
+
+	// Partition the instances per IFA in a single pass.
+	// In a partitioned world, each IFA covers a cell of the foliage grid, so we only need to look up the IFA once per cell.
+	// Otherwise, there is a single IFA per level and the instance location doesn't matter.
+	TMap<AInstancedFoliageActor*, TArray<int32>> PerIFAInstances;
+	TMap<FIntVector, AInstancedFoliageActor*> IFAPerCell;
 	const bool bSpawnInCurrentLevel = true;
 	ULevel* CurrentLevel = InWorld->GetCurrentLevel();
 	const bool bCreate = true;
-	for (int Index = 0; Index < InstancesToPlace.Num(); Index++)
+	const bool bIsPartitioned = InWorld->IsPartitionedWorld();
+	const double GridSize = (bIsPartitioned && InWorld->GetWorldSettings())
+		? FMath::Max<double>(InWorld->GetWorldSettings()->InstancedFoliageGridSize, 1.0)
+		: 0.0;
+	for (int32 Index = 0; Index < InstancesToPlace.Num(); Index++)
 	{
 		const FFoliageInstance& PlacedInstance = InstancesToPlace[Index];
 		ULevel* LevelHint = bSpawnInCurrentLevel ? CurrentLevel : PlacedInstance.BaseComponent ? PlacedInstance.BaseComponent->GetComponentLevel() : nullptr;
-		if (AInstancedFoliageActor* IFA = AInstancedFoliageActor::Get(InWorld, bCreate, LevelHint, PlacedInstance.Location))
+
+		FIntVector Cell = FIntVector::ZeroValue;
+		if (GridSize > 0.0)
 		{
-			PerIFAInstances.FindOrAdd(IFA).Add(Index);
+			Cell.X = FMath::FloorToInt(PlacedInstance.Location.X / GridSize);
+			Cell.Y = FMath::FloorToInt(PlacedInstance.Location.Y / GridSize);
+			Cell.Z = FMath::FloorToInt(PlacedInstance.Location.Z / GridSize);
 		}
+
+		AInstancedFoliageActor** FoundIFA = IFAPerCell.Find(Cell);
+		AInstancedFoliageActor* IFA = FoundIFA
+			? *FoundIFA
+			: IFAPerCell.Add(Cell, AInstancedFoliageActor::Get(InWorld, bCreate, LevelHint, PlacedInstance.Location));
+
+		if (IFA)
+			PerIFAInstances.FindOrAdd(IFA).Add(Index);
 	}
 
+	// Add the instances to each IFA in bulk, then refresh the affected foliage infos once.
 	for (const auto& PlacedLevelInstances : PerIFAInstances)
 	{
 		AInstancedFoliageActor* IFA = PlacedLevelInstances.Key;
+		const TArray<int32>& InstanceIndices = PlacedLevelInstances.Value;
 
 		FFoliageInfo* Info = nullptr;
 		UFoliageType* FoliageSettings = IFA->AddFoliageType(Settings, &Info);
+		if (!Info)
+			continue;
 
-
-		for(int InstanceIndex = 0; InstanceIndex < PlacedLevelInstances.Value.Num(); InstanceIndex++)
+		TArray<FFoliageInstance> Instances;
+		Instances.SetNum(InstanceIndices.Num());
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceIndices.Num(); InstanceIndex++)
 		{
-			FFoliageInstance Instance = InstancesToPlace[PlacedLevelInstances.Value[InstanceIndex]];
-			if (AttachmentInfo.Num() > 0)
+			const int32 PlacedIndex = InstanceIndices[InstanceIndex];
+			Instances[InstanceIndex] = InstancesToPlace[PlacedIndex];
+			if (AttachmentInfo.IsValidIndex(PlacedIndex))
 			{
-				SetInstanceAttachment(IFA, Info, FoliageSettings, Instance, AttachmentInfo[InstanceIndex]);
+				SetInstanceAttachment(IFA, Info, FoliageSettings, Instances[InstanceIndex], AttachmentInfo[PlacedIndex]);
 			}
-			Info->AddInstance(FoliageSettings, Instance);
 		}
-		Info->Refresh(false, true);
 
-	}
+		TArray<const FFoliageInstance*> InstancePointers;
+		InstancePointers.SetNum(Instances.Num());
+		for (int32 InstanceIndex = 0; InstanceIndex < Instances.Num(); InstanceIndex++)
+			InstancePointers[InstanceIndex] = &Instances[InstanceIndex];
 
-	TArray<FFoliageInfo*> FoliageInfos = FHoudiniFoliageTools::GetAllFoliageInfo(InWorld, Settings);
-	for(auto & FoliageInfo : FoliageInfos)
-	{
-	    if (FoliageInfo != nullptr)
-		{
-		    FoliageInfo->Refresh(true, false);
-		}
+		Info->AddInstances(FoliageSettings, InstancePointers);
+		Info->Refresh(false, true);
 	}
 }
 
@@ -273,40 +301,91 @@ FHoudiniFoliageTools::RemoveInstancesFromWorld(UWorld* World, UFoliageType* Foli
 void
 FHoudiniFoliageTools::RemoveFoliageInstances(UWorld* World, UFoliageType* FoliageType, const TArray<FVector3d>& Positions)
 {
-	const float Spacing = 1.0f;
-	// Create a spatial hash for fast look up of positions.
-	UE::Geometry::TPointHashGrid3d< int> SpatialHash(Spacing, -1);
-	for (int Index = 0; Index < Positions.Num(); ++Index)
-		SpatialHash.InsertPoint(Index, Positions[Index]);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniFoliageTools::RemoveFoliageInstances);
+
+	if (Positions.Num() <= 0)
+		return;
 
+	// Foliage instances don't have a persistent id, their index changes when other instances are removed.
+	// The stored positions are copied from the spawned instances, so we match them exactly first, and only 
+	// fall back to a nearest neighbour search for the positions that weren't found.
+	TMap<FVector3d, int32> RemainingCounts;
+	RemainingCounts.Reserve(Positions.Num());
+	for (const FVector3d& Position : Positions)
+		RemainingCounts.FindOrAdd(Position)++;
 
+	int32 NumRemaining = Positions.Num();
 	TArray<FFoliageInfo*> FoliageInfos = FHoudiniFoliageTools::GetAllFoliageInfo(World, FoliageType);
-	for (auto& FoliageInfo : FoliageInfos)
+	TMap<FFoliageInfo*, TArray<int32>> InstancesToRemovePerInfo;
+	for (FFoliageInfo* FoliageInfo : FoliageInfos)
 	{
-		if (FoliageInfo == nullptr) continue;
+		if (FoliageInfo == nullptr || NumRemaining <= 0)
+			continue;
 
-		// Query all instances in the Foliage Type, see if they are close to one in the set we are trying to remove
+		TArray<int32>& InstancesToRemove = InstancesToRemovePerInfo.Add(FoliageInfo);
+		for (int32 Index = 0; Index < FoliageInfo->Instances.Num() && NumRemaining > 0; Index++)
+		{
+			int32* Count = RemainingCounts.Find(FoliageInfo->Instances[Index].Location);
+			if (!Count || *Count <= 0)
+				continue;
+
+			// Only remove one instance for each position.
+			InstancesToRemove.Add(Index);
+			(*Count)--;
+			NumRemaining--;
+		}
+	}
 
-		TArray<int> InstancesToRemove;
-		for (int Index = 0; Index < FoliageInfo->Instances.Num(); Index++)
+	if (NumRemaining > 0)
+	{
+		// Some positions didn't match exactly (the instances might have been moved slightly since),
+		// look for the nearest instance within a small radius instead.
+		const float Spacing = 1.0f;
+		UE::Geometry::TPointHashGrid3d<int32> SpatialHash(Spacing, -1);
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
 		{
-			TPair<int, double> Result = SpatialHash.FindNearestInRadius(FoliageInfo->Instances[Index].Location, Spacing, [&](int PosIndex)
-				{
-					return FVector3d::DistSquared(FoliageInfo->Instances[Index].Location, Positions[PosIndex]);
-				});
+			int32* Count = RemainingCounts.Find(Positions[Index]);
+			if (Count && *Count > 0)
+			{
+				SpatialHash.InsertPoint(Index, Positions[Index]);
+				(*Count)--;
+			}
+		}
 
-			if (Result.Key != -1)
+		for (auto& InfoIt : InstancesToRemovePerInfo)
+		{
+			FFoliageInfo* FoliageInfo = InfoIt.Key;
+			TSet<int32> AlreadyRemoved(InfoIt.Value);
+			for (int32 Index = 0; Index < FoliageInfo->Instances.Num() && NumRemaining > 0; Index++)
 			{
-				// Remove this instance of foliage.
-				InstancesToRemove.Add(Index);
+				if (AlreadyRemoved.Contains(Index))
+					continue;
 
-				// Remove the matched point from the spatial hash. This means we will only remove one instance
-				// for each point.
-				SpatialHash.RemovePoint(Result.Value, Positions[Result.Value]);
-			}
+				const FVector3d& Location = FoliageInfo->Instances[Index].Location;
+				TPair<int32, double> Result = SpatialHash.FindNearestInRadius(Location, Spacing, [&](int32 PosIndex)
+					{
+						return FVector3d::DistSquared(Location, Positions[PosIndex]);
+					});
 
+				if (Result.Key != -1)
+				{
+					// Remove the matched point from the spatial hash, so we only remove one instance for each point.
+					InfoIt.Value.Add(Index);
+					SpatialHash.RemovePoint(Result.Key, Positions[Result.Key]);
+					NumRemaining--;
+				}
+			}
 		}
-		FoliageInfo->RemoveInstances(InstancesToRemove, true);
+	}
+
+	// Remove the instances from each foliage info in a single call.
+	for (auto& InfoIt : InstancesToRemovePerInfo)
+	{
+		if (InfoIt.Value.Num() <= 0)
+			continue;
+
+		InfoIt.Value.Sort();
+		InfoIt.Key->RemoveInstances(InfoIt.Value, true);
 	}
 }
 
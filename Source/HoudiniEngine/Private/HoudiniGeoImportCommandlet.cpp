@@ -46,6 +46,9 @@
 #include "Rendering/SlateRenderer.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/ThreadManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
 
 #include "HoudiniPackageParams.h"
 #include "HoudiniGeoImporter.h"
@@ -55,12 +58,19 @@
 #include "HoudiniPDGImporterMessages.h"
 #include "HoudiniEngineRuntimeUtils.h"
 
+static bool
+IsBGEOFilename(const FString& InFilename)
+{
+	const FRegexPattern BGEOPattern(TEXT(R"((.*)\.(bgeo(\.[^\.]*)?)$)"));
+	FRegexMatcher BGEOMatcher(BGEOPattern, InFilename.ToLower());
+	return BGEOMatcher.FindNext() && BGEOMatcher.GetCaptureGroup(2).StartsWith(TEXT("bgeo"));
+}
 
 UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 {
 	HelpDescription = TEXT("Import BGEOs as UAssets. Includes an option to watch a directories and include new .bgeos created there.");
 
-	HelpUsage = TEXT("HoudiniGeoImport Usage: HoudiniGeoImport {options} [filename.bgeo]");
+	HelpUsage = TEXT("HoudiniGeoImport Usage: HoudiniGeoImport {options} [filename.bgeo | -dir=directory | -manifest=file]");
 	//	"Options:\n"
 	//	"\t-help or -?\n"
 	//	"\t\tDisplays this help.\n\n"
@@ -82,7 +92,11 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"guid",
 		"watch",
 		"managerpid",
-		"bake"
+		"bake",
+		"dir",
+		"manifest",
+		"incremental",
+		"statefile"
 	};
 
 	HelpParamDescriptions = {
@@ -91,7 +105,11 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"Specify a GUID for the commandlet. Useful to identify the commandlet when the messaging system is used.",
 		"A directory to watch for new .bgeo files to import.",
 		"The PID of the owner/manager process. If the manager process dies the commandlet also quits.",
-		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode."
+		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode.",
+		"Import all the .bgeo files found in a directory (recursively).",
+		"Import all the files listed in a manifest file (one path per line, relative paths are relative to the manifest).",
+		"With -dir or -manifest: skip the files that did not change since their last successful import.",
+		"The file used to store the state of imported files for -incremental. Defaults to Saved/HoudiniEngine/GeoImportState.txt."
 	};
 
 	IsClient = false;
@@ -105,6 +123,7 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 
 	Mode = EHoudiniGeoImportCommandletMode::None;
 	bBakeOutputs = false;
+	bIncremental = false;
 }
 
 void UHoudiniGeoImportCommandlet::PrintUsage() const
@@ -452,10 +471,8 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 		return 2;
 	}
 
-	FHoudiniPackageParams PackageParams = InPackageParams;
 	UHoudiniGeoImporter* GeoImporter = NewObject<UHoudiniGeoImporter>(this);
 
-	TArray<UHoudiniOutput*> OldOutputs;
 	OutOutputs.Empty();
 
 	// 2. Update the file paths
@@ -469,6 +486,40 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 	if (!GeoImporter->LoadBGEOFileInHAPI(NodeId))
 		return 1;
 
+	TArray<UPackage*> PackagesToSave;
+	const int32 Result = ImportLoadedBGEO(
+		InFilename, GeoImporter, NodeId, InPackageParams, OutOutputs, PackagesToSave,
+		InStaticMeshGenerationProperties, InMeshBuildSettings, OutGenericAttributes, OutInstancedOutputPartData);
+	if (Result != 0)
+		return Result;
+
+	if (PackagesToSave.Num() > 0)
+	{
+		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+	}
+
+	return 0;
+}
+
+int32 UHoudiniGeoImportCommandlet::ImportLoadedBGEO(
+	const FString& InFilename,
+	UHoudiniGeoImporter* InGeoImporter,
+	const HAPI_NodeId& InNodeId,
+	const FHoudiniPackageParams& InPackageParams,
+	TArray<UHoudiniOutput*>& OutOutputs,
+	TArray<UPackage*>& OutPackagesToSave,
+	const FHoudiniStaticMeshGenerationProperties* InStaticMeshGenerationProperties,
+	const FMeshBuildSettings* InMeshBuildSettings,
+	TMap<FHoudiniOutputObjectIdentifier, TArray<FHoudiniGenericAttribute>>* OutGenericAttributes,
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* OutInstancedOutputPartData)
+{
+	FHoudiniPackageParams PackageParams = InPackageParams;
+	UHoudiniGeoImporter* GeoImporter = InGeoImporter;
+	const HAPI_NodeId NodeId = InNodeId;
+
+	TArray<UHoudiniOutput*> OldOutputs;
+	OutOutputs.Empty();
+
 	// Look for a bake folder override in the BGEO file
 	if (PackageParams.PackageMode == EPackageMode::Bake)
 	{
@@ -590,7 +641,6 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 		//return false;
 	}
 
-	TArray<UPackage*> PackagesToSave;
 	TArray<UObject*>& OutputObjects = GeoImporter->GetOutputObjects();
 	for (UObject* Object : OutputObjects)
 	{
@@ -621,31 +671,276 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 		UPackage* Package = Object->GetOutermost();
 		if (IsValid(Package))
 		{
-			PackagesToSave.AddUnique(Package);
+			OutPackagesToSave.AddUnique(Package);
 		}
 	}
 
-	if (PackagesToSave.Num() > 0)
-	{
-		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
-	}
-	
-	PackagesToSave.Empty();
 	OutputObjects.Empty();
 
 	return 0;
 }
 
+int32 UHoudiniGeoImportCommandlet::ImportBatch(const TArray<FString>& InFilenames)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniGeoImportCommandlet::ImportBatch);
+
+	if (!IsHoudiniEngineSessionRunning() && !StartHoudiniEngineSession())
+		return 2;
+
+	if (bIncremental)
+		LoadIncrementalState();
+
+	// Filter out the files that did not change since their last import
+	TArray<FString> FilesToImport;
+	TArray<FHoudiniGeoImportFileState> FileStates;
+	int32 NumSkipped = 0;
+	for (const FString& Filename : InFilenames)
+	{
+		FHoudiniGeoImportFileState FileState;
+		if (bIncremental && IsFileUnchanged(Filename, FileState))
+		{
+			HOUDINI_LOG_DISPLAY(TEXT("Skipping %s, unchanged since its last import."), *Filename);
+			// Only the time stamp might have changed, update it
+			IncrementalState.Add(Filename, FileState);
+			NumSkipped++;
+			continue;
+		}
+
+		FilesToImport.Add(Filename);
+		FileStates.Add(FileState);
+	}
+
+	// Create the file node and start its cook, the cook itself runs on HAPI's cooking thread
+	auto StartLoad = [this, &FilesToImport](const int32 InIndex, UHoudiniGeoImporter*& OutGeoImporter, HAPI_NodeId& OutNodeId)
+	{
+		OutGeoImporter = NewObject<UHoudiniGeoImporter>(this);
+		OutNodeId = -1;
+		if (!OutGeoImporter->SetFilePath(FilesToImport[InIndex]))
+			return false;
+
+		return OutGeoImporter->LoadBGEOFileInHAPI(OutNodeId, false);
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumImported = 0;
+	int32 NumFailed = 0;
+
+	UHoudiniGeoImporter* NextGeoImporter = nullptr;
+	HAPI_NodeId NextNodeId = -1;
+	bool bNextLoaded = FilesToImport.Num() > 0 && StartLoad(0, NextGeoImporter, NextNodeId);
+	for (int32 Idx = 0; Idx < FilesToImport.Num(); ++Idx)
+	{
+		const FString& Filename = FilesToImport[Idx];
+		UHoudiniGeoImporter* GeoImporter = NextGeoImporter;
+		const HAPI_NodeId NodeId = NextNodeId;
+		const bool bLoaded = bNextLoaded && UHoudiniGeoImporter::WaitForFileNodeCook();
+
+		int32 Result = 1;
+		TArray<UHoudiniOutput*> Outputs;
+		TArray<UPackage*> PackagesToSave;
+		if (bLoaded)
+		{
+			FHoudiniPackageParams PackageParams;
+			PopulatePackageParams(Filename, PackageParams);
+			Result = ImportLoadedBGEO(Filename, GeoImporter, NodeId, PackageParams, Outputs, PackagesToSave);
+		}
+		else if (NodeId >= 0)
+		{
+			UHoudiniGeoImporter::DeleteCreatedNode(NodeId);
+		}
+
+		// This file's node is gone from HAPI: start loading the next file now,
+		// so that its cook overlaps with the saving of this file's packages
+		NextGeoImporter = nullptr;
+		NextNodeId = -1;
+		bNextLoaded = false;
+		if (Idx + 1 < FilesToImport.Num())
+			bNextLoaded = StartLoad(Idx + 1, NextGeoImporter, NextNodeId);
+
+		if (PackagesToSave.Num() > 0)
+		{
+			UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+		}
+
+		for (UHoudiniOutput* Output : Outputs)
+		{
+			Output->RemoveFromRoot();
+		}
+		Outputs.Empty();
+
+		if (Result == 0)
+		{
+			NumImported++;
+			if (bIncremental)
+			{
+				// New files and files whose size changed weren't hashed. Hash them now, so that a later run that only
+				// sees their time stamp change can compare their content instead of importing them again.
+				FHoudiniGeoImportFileState& FileState = FileStates[Idx];
+				if (FileState.Hash.IsEmpty())
+					FileState.Hash = LexToString(FMD5Hash::HashFile(*Filename));
+
+				IncrementalState.Add(Filename, FileState);
+			}
+
+			HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Done"), *Filename);
+		}
+		else
+		{
+			NumFailed++;
+			HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Failed (%d)"), *Filename, Result);
+		}
+	}
+
+	if (bIncremental)
+		SaveIncrementalState();
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	HOUDINI_LOG_DISPLAY(
+		TEXT("Batch import: %d imported, %d failed, %d skipped in %.2fs (%.2f files/s)."),
+		NumImported, NumFailed, NumSkipped, ElapsedSeconds,
+		ElapsedSeconds > 0.0 ? (NumImported + NumFailed) / ElapsedSeconds : 0.0);
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+bool UHoudiniGeoImportCommandlet::GatherBatchFiles(const TMap<FString, FString>& InParams, TArray<FString>& OutFilenames) const
+{
+	OutFilenames.Empty();
+
+	if (InParams.Contains(TEXT("dir")))
+	{
+		FString Directory = InParams.FindChecked(TEXT("dir"));
+		if (FPaths::IsRelative(Directory))
+			Directory = FPaths::ConvertRelativePathToFull(Directory);
+
+		if (!IFileManager::Get().DirectoryExists(*Directory))
+		{
+			HOUDINI_LOG_ERROR(TEXT("The directory passed to -dir=%s does not exist."), *Directory);
+			return false;
+		}
+
+		TArray<FString> FoundFiles;
+		IFileManager::Get().FindFilesRecursive(FoundFiles, *Directory, TEXT("*"), true, false);
+		for (const FString& FoundFile : FoundFiles)
+		{
+			if (IsBGEOFilename(FoundFile))
+				OutFilenames.AddUnique(FoundFile);
+		}
+	}
+
+	if (InParams.Contains(TEXT("manifest")))
+	{
+		FString Manifest = InParams.FindChecked(TEXT("manifest"));
+		if (FPaths::IsRelative(Manifest))
+			Manifest = FPaths::ConvertRelativePathToFull(Manifest);
+
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Manifest))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Could not read the manifest passed to -manifest=%s."), *Manifest);
+			return false;
+		}
+
+		const FString ManifestDirectory = FPaths::GetPath(Manifest);
+		for (FString& Line : Lines)
+		{
+			Line.TrimStartAndEndInline();
+			if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+				continue;
+
+			const FString Filename = FPaths::IsRelative(Line) ? 
+				FPaths::ConvertRelativePathToFull(ManifestDirectory, Line) : Line;
+			if (!IFileManager::Get().FileExists(*Filename))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Skipping %s (listed in the manifest), the file does not exist."), *Filename);
+				continue;
+			}
+
+			OutFilenames.AddUnique(Filename);
+		}
+	}
+
+	// Import in a predictable order
+	OutFilenames.Sort();
+
+	HOUDINI_LOG_DISPLAY(TEXT("Found %d files to import."), OutFilenames.Num());
+
+	return true;
+}
+
+bool UHoudiniGeoImportCommandlet::IsFileUnchanged(const FString& InFilename, FHoudiniGeoImportFileState& OutState) const
+{
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*InFilename);
+	if (!StatData.bIsValid)
+		return false;
+
+	OutState.FileSize = StatData.FileSize;
+	OutState.TimeStampTicks = StatData.ModificationTime.GetTicks();
+
+	const FHoudiniGeoImportFileState* LastState = IncrementalState.Find(InFilename);
+	if (LastState && LastState->FileSize == OutState.FileSize && LastState->TimeStampTicks == OutState.TimeStampTicks)
+	{
+		OutState.Hash = LastState->Hash;
+		return true;
+	}
+
+	// A new file or a file with a different size has changed, no need to hash it here.
+	// It is hashed once it has been imported.
+	if (!LastState || LastState->FileSize != OutState.FileSize)
+		return false;
+
+	// Only the time stamp changed: compare the content hashes
+	OutState.Hash = LexToString(FMD5Hash::HashFile(*InFilename));
+
+	return !OutState.Hash.IsEmpty() && LastState->Hash == OutState.Hash;
+}
+
+void UHoudiniGeoImportCommandlet::LoadIncrementalState()
+{
+	IncrementalState.Empty();
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *IncrementalStateFilename))
+		return;
+
+	// Each line is: size, time stamp, hash and path, separated by tabs
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Fields;
+		if (Line.ParseIntoArray(Fields, TEXT("\t"), false) != 4)
+			continue;
+
+		FHoudiniGeoImportFileState State;
+		LexFromString(State.FileSize, *Fields[0]);
+		LexFromString(State.TimeStampTicks, *Fields[1]);
+		State.Hash = Fields[2];
+		IncrementalState.Add(Fields[3], State);
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Loaded the state of %d previously imported files from %s."), IncrementalState.Num(), *IncrementalStateFilename);
+}
+
+void UHoudiniGeoImportCommandlet::SaveIncrementalState() const
+{
+	TArray<FString> Lines;
+	Lines.Reserve(IncrementalState.Num());
+	for (const auto& Entry : IncrementalState)
+	{
+		Lines.Add(FString::Printf(
+			TEXT("%lld\t%lld\t%s\t%s"), Entry.Value.FileSize, Entry.Value.TimeStampTicks, *Entry.Value.Hash, *Entry.Key));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *IncrementalStateFilename))
+		HOUDINI_LOG_WARNING(TEXT("Could not save the incremental import state to %s."), *IncrementalStateFilename);
+}
+
 void UHoudiniGeoImportCommandlet::HandleDirectoryChanged(const TArray<FFileChangeData>& InFileChangeDatas)
 {
-	const FRegexPattern BGEOPattern(TEXT(R"((.*)\.(bgeo(\.[^\.]*)?)$)"));
-	
 	for (const FFileChangeData& FileChangeData : InFileChangeDatas)
 	{
 		HOUDINI_LOG_MESSAGE(TEXT("HandleDirectoryChanged %d %s"), FileChangeData.Action, *FileChangeData.Filename);
 
-		FRegexMatcher BGEOMatcher(BGEOPattern, FileChangeData.Filename.ToLower());
-		if (BGEOMatcher.FindNext() && BGEOMatcher.GetCaptureGroup(2).StartsWith(TEXT("bgeo")))
+		if (IsBGEOFilename(FileChangeData.Filename))
 		{
 			HOUDINI_LOG_DISPLAY(TEXT("Updating entry for %s..."), *FileChangeData.Filename);
 			const uint32 MaxImportAttempts = 3;
@@ -767,6 +1062,22 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 			return 10;
 		}
 	}
+	else if (Params.Contains(TEXT("dir")) || Params.Contains(TEXT("manifest")))
+	{
+		Mode = EHoudiniGeoImportCommandletMode::Batch;
+
+		bIncremental = Switches.Contains(TEXT("incremental"));
+		if (Params.Contains(TEXT("statefile")))
+			IncrementalStateFilename = FPaths::ConvertRelativePathToFull(Params.FindChecked(TEXT("statefile")));
+		else
+			IncrementalStateFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("GeoImportState.txt"));
+
+		TArray<FString> Filenames;
+		if (!GatherBatchFiles(Params, Filenames))
+			return 1;
+
+		return ImportBatch(Filenames);
+	}
 	else if (Tokens.Num() > 0)
 	{
 		Mode = EHoudiniGeoImportCommandletMode::SpecifiedFiles;
@@ -54,7 +54,9 @@ enum class EHoudiniGeoImportCommandletMode : uint8
 	// Directory watch mode
 	Watch,
 	// Listen mode (via PDGManager)
-	Listen
+	Listen,
+	// Import of all files in a directory or manifest
+	Batch
 };
 
 struct FDiscoveredFileData
@@ -79,6 +81,22 @@ public:
 	bool bImported;
 };
 
+// Used by -incremental to detect source files that did not change since their last import
+struct FHoudiniGeoImportFileState
+{
+public:
+	FHoudiniGeoImportFileState() : FileSize(-1), TimeStampTicks(0), Hash() {}
+
+	// Size of the file in bytes
+	int64 FileSize;
+
+	// Modification time stamp of the file
+	int64 TimeStampTicks;
+
+	// MD5 of the file's content, computed when the file is imported or when only its time stamp changed
+	FString Hash;
+};
+
 UCLASS()
 class HOUDINIENGINE_API UHoudiniGeoImportCommandlet : public UCommandlet
 {
@@ -122,6 +140,33 @@ protected:
 		TMap<FHoudiniOutputObjectIdentifier, TArray<FHoudiniGenericAttribute>>* OutGenericAttributes=nullptr,
 		TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* OutInstancedOutputPartData=nullptr);
 
+	// Finishes importing a BGEO file already loaded (and cooked) in HAPI. Deletes the HAPI node, and adds the
+	// packages that need saving to OutPackagesToSave.
+	int32 ImportLoadedBGEO(
+		const FString& InFilename,
+		UHoudiniGeoImporter* InGeoImporter,
+		const HAPI_NodeId& InNodeId,
+		const FHoudiniPackageParams& InPackageParams,
+		TArray<UHoudiniOutput*>& OutOutputs,
+		TArray<UPackage*>& OutPackagesToSave,
+		const FHoudiniStaticMeshGenerationProperties* InStaticMeshGenerationProperties=nullptr,
+		const FMeshBuildSettings* InMeshBuildSettings=nullptr,
+		TMap<FHoudiniOutputObjectIdentifier, TArray<FHoudiniGenericAttribute>>* OutGenericAttributes=nullptr,
+		TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* OutInstancedOutputPartData=nullptr);
+
+	// Import all the files, the HAPI load and cook of the next file overlaps with saving the current file's packages
+	int32 ImportBatch(const TArray<FString>& InFilenames);
+
+	// Gather the .bgeo files of a directory (-dir) or listed in a manifest (-manifest)
+	bool GatherBatchFiles(const TMap<FString, FString>& InParams, TArray<FString>& OutFilenames) const;
+
+	// Returns true if the file matches the state recorded at its last import. Fills OutState with the file's current state.
+	bool IsFileUnchanged(const FString& InFilename, FHoudiniGeoImportFileState& OutState) const;
+
+	void LoadIncrementalState();
+
+	void SaveIncrementalState() const;
+
 	void TickDiscoveredFiles();
 
 private:
@@ -152,4 +197,13 @@ private:
 	
 	// Bake outputs via FHoudiniEngineBakeUtils
 	bool bBakeOutputs;
+
+	// Skip files that have not changed since they were last imported
+	bool bIncremental;
+
+	// File used to store the state of imported files in incremental mode
+	FString IncrementalStateFilename;
+
+	// State of the files at their last successful import, keyed by absolute file path
+	TMap<FString, FHoudiniGeoImportFileState> IncrementalState;
 };
\ No newline at end of file
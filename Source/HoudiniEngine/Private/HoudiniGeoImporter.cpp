@@ -950,7 +950,7 @@ UHoudiniGeoImporter::CloseBGEOFile(const HAPI_NodeId& InNodeId)
 }
 
 bool
-UHoudiniGeoImporter::LoadBGEOFileInHAPI(HAPI_NodeId& NodeId)
+UHoudiniGeoImporter::LoadBGEOFileInHAPI(HAPI_NodeId& NodeId, bool bInWaitForCook)
 {
 	NodeId = -1;
 
@@ -988,6 +988,9 @@ UHoudiniGeoImporter::LoadBGEOFileInHAPI(HAPI_NodeId& NodeId)
 	std::string ConvertedString = TCHAR_TO_UTF8(*AbsoluteFilePath);
 	FHoudiniApi::LoadGeoFromFile(FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str());
 
+	if (!bInWaitForCook)
+		return StartCookFileNode(NodeId);
+
 	return CookFileNode(NodeId);
 }
 
@@ -996,11 +999,28 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniGeoImporter::CookFileNode);
 
-	// Cook the node    
+	if (!StartCookFileNode(InNodeId))
+		return false;
+
+	return WaitForFileNodeCook();
+}
+
+bool
+UHoudiniGeoImporter::StartCookFileNode(const HAPI_NodeId& InNodeId)
+{
+	// Cook the node, with the cooking thread this returns before the cook is done
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
 		FHoudiniEngine::Get().GetSession(), InNodeId, &CookOptions), false);
 
+	return true;
+}
+
+bool
+UHoudiniGeoImporter::WaitForFileNodeCook()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniGeoImporter::WaitForFileNodeCook);
+
 	// Wait for the cook to finish
 	int32 status = HAPI_STATE_MAX_READY_STATE + 1;
 	while (status > HAPI_STATE_MAX_READY_STATE)
@@ -57,6 +57,12 @@ public:
 		// Cook the file node specified by the valid NodeId.
 		static bool CookFileNode(const HAPI_NodeId& InNodeId);
 
+		// Start cooking the file node without waiting for the cook to finish.
+		static bool StartCookFileNode(const HAPI_NodeId& InNodeId);
+
+		// Wait for the cook started by StartCookFileNode to finish.
+		static bool WaitForFileNodeCook();
+
 		// Extract the outputs for a given node ID
 		static bool BuildAllOutputsForNode(
 			const HAPI_NodeId& InNodeId, 
@@ -85,7 +91,8 @@ public:
 		bool SetFilePath(const FString& InFilePath);
 		
 		// 3. Creates a new file node and loads the bgeo file in HAPI
-		bool LoadBGEOFileInHAPI(HAPI_NodeId& NodeId);
+		// If bInWaitForCook is false, the node's cook is only started and WaitForFileNodeCook must be called
+		bool LoadBGEOFileInHAPI(HAPI_NodeId& NodeId, bool bInWaitForCook = true);
 
 		// 3.2 (alternative) Uses an object merge node to load the geo data in HAPI (used for node sync fetch)
 		bool MergeGeoFromNode(const FString& InNodePath, HAPI_NodeId& OutNodeId);
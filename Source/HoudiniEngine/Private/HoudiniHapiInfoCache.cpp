@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "HoudiniHapiInfoCache.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineString.h"
+
+FHoudiniHapiInfoCache* FHoudiniHapiInfoCache::ActiveCache = nullptr;
+
+FHoudiniHapiInfoCache::FHoudiniHapiInfoCache()
+{
+	Queries.GetCookCount = [](const HAPI_NodeId& NodeId, int32& OutCookCount)
+	{
+		HAPI_NodeInfo NodeInfo;
+		FHoudiniApi::NodeInfo_Init(&NodeInfo);
+		HAPI_Result Result = FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo);
+		OutCookCount = NodeInfo.totalCookCount;
+		return Result;
+	};
+
+	Queries.GetGeoInfo = [](const HAPI_NodeId& NodeId, HAPI_GeoInfo& OutGeoInfo)
+	{
+		return FHoudiniApi::GetGeoInfo(FHoudiniEngine::Get().GetSession(), NodeId, &OutGeoInfo);
+	};
+
+	Queries.GetPartInfo = [](const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, HAPI_PartInfo& OutPartInfo)
+	{
+		return FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoId, PartId, &OutPartInfo);
+	};
+
+	Queries.GetAttributeInfo = [](
+		const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, const char* AttribName,
+		const HAPI_AttributeOwner& Owner, HAPI_AttributeInfo& OutAttributeInfo)
+	{
+		return FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttribName, Owner, &OutAttributeInfo);
+	};
+
+	Queries.GetAttributeNames = [](
+		const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, const HAPI_AttributeOwner& Owner,
+		const int32& Count, TArray<FString>& OutAttributeNames)
+	{
+		TArray<HAPI_StringHandle> AttribNameSHArray;
+		AttribNameSHArray.SetNum(Count);
+		HAPI_Result Result = FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, Owner, AttribNameSHArray.GetData(), Count);
+
+		if (Result == HAPI_RESULT_SUCCESS)
+			FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, OutAttributeNames);
+
+		return Result;
+	};
+}
+
+FHoudiniHapiInfoCache::FHoudiniHapiInfoCache(const FQueries& InQueries)
+	: Queries(InQueries)
+{
+}
+
+FHoudiniHapiInfoCache*
+FHoudiniHapiInfoCache::Get()
+{
+	return ActiveCache;
+}
+
+void
+FHoudiniHapiInfoCache::NotifyNodeCooked()
+{
+	// Cooking a node can also cook the nodes it depends on, so check all the cached nodes
+	if (ActiveCache)
+		ActiveCache->Invalidate();
+}
+
+FHoudiniHapiInfoCache::FNodeInfos*
+FHoudiniHapiInfoCache::GetNodeInfos(const HAPI_NodeId& NodeId)
+{
+	FNodeInfos& NodeInfos = Nodes.FindOrAdd(NodeId);
+	if (NodeInfos.Generation == Generation)
+		return &NodeInfos;
+
+	int32 CookCount = -1;
+	NumQueries++;
+	if (Queries.GetCookCount(NodeId, CookCount) != HAPI_RESULT_SUCCESS)
+	{
+		Nodes.Remove(NodeId);
+		return nullptr;
+	}
+
+	if (NodeInfos.CookCount != CookCount)
+	{
+		// The node has been cooked since its infos were cached
+		NodeInfos = FNodeInfos();
+		NodeInfos.CookCount = CookCount;
+	}
+
+	NodeInfos.Generation = Generation;
+	return &NodeInfos;
+}
+
+HAPI_Result
+FHoudiniHapiInfoCache::GetGeoInfo(const HAPI_NodeId& NodeId, HAPI_GeoInfo& OutGeoInfo)
+{
+	FNodeInfos* NodeInfos = GetNodeInfos(NodeId);
+	if (NodeInfos && NodeInfos->bHasGeoInfo)
+	{
+		NumCacheHits++;
+		OutGeoInfo = NodeInfos->GeoInfo;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	NumQueries++;
+	HAPI_Result Result = Queries.GetGeoInfo(NodeId, OutGeoInfo);
+	if (NodeInfos && Result == HAPI_RESULT_SUCCESS)
+	{
+		NodeInfos->GeoInfo = OutGeoInfo;
+		NodeInfos->bHasGeoInfo = true;
+	}
+
+	return Result;
+}
+
+HAPI_Result
+FHoudiniHapiInfoCache::GetPartInfo(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, HAPI_PartInfo& OutPartInfo)
+{
+	FNodeInfos* NodeInfos = GetNodeInfos(GeoId);
+	if (NodeInfos)
+	{
+		if (const HAPI_PartInfo* CachedPartInfo = NodeInfos->PartInfos.Find(PartId))
+		{
+			NumCacheHits++;
+			OutPartInfo = *CachedPartInfo;
+			return HAPI_RESULT_SUCCESS;
+		}
+	}
+
+	NumQueries++;
+	HAPI_Result Result = Queries.GetPartInfo(GeoId, PartId, OutPartInfo);
+	if (NodeInfos && Result == HAPI_RESULT_SUCCESS)
+		NodeInfos->PartInfos.Add(PartId, OutPartInfo);
+
+	return Result;
+}
+
+HAPI_Result
+FHoudiniHapiInfoCache::GetAttributeInfo(
+	const HAPI_NodeId& GeoId,
+	const HAPI_PartId& PartId,
+	const char* AttribName,
+	const HAPI_AttributeOwner& Owner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	FNodeInfos* NodeInfos = GetNodeInfos(GeoId);
+	const TTuple<HAPI_PartId, int32, FString> Key(PartId, (int32)Owner, UTF8_TO_TCHAR(AttribName));
+	if (NodeInfos)
+	{
+		if (const HAPI_AttributeInfo* CachedAttributeInfo = NodeInfos->AttributeInfos.Find(Key))
+		{
+			NumCacheHits++;
+			OutAttributeInfo = *CachedAttributeInfo;
+			return HAPI_RESULT_SUCCESS;
+		}
+	}
+
+	NumQueries++;
+	HAPI_Result Result = Queries.GetAttributeInfo(GeoId, PartId, AttribName, Owner, OutAttributeInfo);
+	if (NodeInfos && Result == HAPI_RESULT_SUCCESS)
+		NodeInfos->AttributeInfos.Add(Key, OutAttributeInfo);
+
+	return Result;
+}
+
+HAPI_Result
+FHoudiniHapiInfoCache::GetAttributeNames(
+	const HAPI_NodeId& GeoId,
+	const HAPI_PartId& PartId,
+	const HAPI_AttributeOwner& Owner,
+	TArray<FString>& OutAttributeNames)
+{
+	OutAttributeNames.Empty();
+
+	FNodeInfos* NodeInfos = GetNodeInfos(GeoId);
+	const TTuple<HAPI_PartId, int32> Key(PartId, (int32)Owner);
+	if (NodeInfos)
+	{
+		if (const TArray<FString>* CachedAttributeNames = NodeInfos->AttributeNames.Find(Key))
+		{
+			NumCacheHits++;
+			OutAttributeNames = *CachedAttributeNames;
+			return HAPI_RESULT_SUCCESS;
+		}
+	}
+
+	// We need the part info to get the number of attributes
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HAPI_Result Result = GetPartInfo(GeoId, PartId, PartInfo);
+	if (Result != HAPI_RESULT_SUCCESS)
+		return Result;
+
+	// GetPartInfo() may have discarded the node's infos
+	NodeInfos = Nodes.Find(GeoId);
+
+	NumQueries++;
+	Result = Queries.GetAttributeNames(GeoId, PartId, Owner, PartInfo.attributeCounts[Owner], OutAttributeNames);
+	if (NodeInfos && Result == HAPI_RESULT_SUCCESS)
+		NodeInfos->AttributeNames.Add(Key, OutAttributeNames);
+
+	return Result;
+}
+
+void
+FHoudiniHapiInfoCache::Invalidate()
+{
+	Generation++;
+}
+
+void
+FHoudiniHapiInfoCache::Reset()
+{
+	Nodes.Empty();
+}
+
+FHoudiniScopedHapiInfoCache::FHoudiniScopedHapiInfoCache()
+{
+	if (FHoudiniHapiInfoCache::ActiveCache)
+		return;
+
+	Cache = MakeUnique<FHoudiniHapiInfoCache>();
+	FHoudiniHapiInfoCache::ActiveCache = Cache.Get();
+}
+
+FHoudiniScopedHapiInfoCache::~FHoudiniScopedHapiInfoCache()
+{
+	if (Cache.IsValid() && FHoudiniHapiInfoCache::ActiveCache == Cache.Get())
+		FHoudiniHapiInfoCache::ActiveCache = nullptr;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+#include "Templates/Tuple.h"
+#include "Templates/UniquePtr.h"
+
+// Memoizes the geo, part and attribute infos queried while translating the outputs of a cooked node.
+// Each of these queries is a full round trip on out-of-process sessions, and the translators query the
+// same infos many times for each part.
+// The cached infos of a node are only reused while its cook count is unchanged: after a cook, the node's
+// cook count is checked again the next time one of its infos is queried.
+class FHoudiniHapiInfoCache
+{
+public:
+
+	// The queries used to fill the cache.
+	struct FQueries
+	{
+		TFunction<HAPI_Result(const HAPI_NodeId&, int32&)> GetCookCount;
+		TFunction<HAPI_Result(const HAPI_NodeId&, HAPI_GeoInfo&)> GetGeoInfo;
+		TFunction<HAPI_Result(const HAPI_NodeId&, const HAPI_PartId&, HAPI_PartInfo&)> GetPartInfo;
+		TFunction<HAPI_Result(const HAPI_NodeId&, const HAPI_PartId&, const char*, const HAPI_AttributeOwner&, HAPI_AttributeInfo&)> GetAttributeInfo;
+		TFunction<HAPI_Result(const HAPI_NodeId&, const HAPI_PartId&, const HAPI_AttributeOwner&, const int32&, TArray<FString>&)> GetAttributeNames;
+	};
+
+	// Creates a cache querying the current Houdini Engine session.
+	FHoudiniHapiInfoCache();
+
+	// Creates a cache using the given queries.
+	FHoudiniHapiInfoCache(const FQueries& InQueries);
+
+	// Returns the active cache, or null if no FHoudiniScopedHapiInfoCache is alive.
+	static FHoudiniHapiInfoCache* Get();
+
+	// Must be called after cooking a node, so that the cook counts of the nodes in the active cache are checked again.
+	static void NotifyNodeCooked();
+
+	HAPI_Result GetGeoInfo(const HAPI_NodeId& NodeId, HAPI_GeoInfo& OutGeoInfo);
+
+	HAPI_Result GetPartInfo(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, HAPI_PartInfo& OutPartInfo);
+
+	HAPI_Result GetAttributeInfo(
+		const HAPI_NodeId& GeoId,
+		const HAPI_PartId& PartId,
+		const char* AttribName,
+		const HAPI_AttributeOwner& Owner,
+		HAPI_AttributeInfo& OutAttributeInfo);
+
+	// Returns the names of all the attributes of a given owner.
+	HAPI_Result GetAttributeNames(
+		const HAPI_NodeId& GeoId,
+		const HAPI_PartId& PartId,
+		const HAPI_AttributeOwner& Owner,
+		TArray<FString>& OutAttributeNames);
+
+	// Checks the cook counts of the cached nodes again on their next query.
+	void Invalidate();
+
+	// Discards all the cached infos.
+	void Reset();
+
+	// Number of queries that were sent, and number of queries that were answered by the cache.
+	int32 GetNumQueries() const { return NumQueries; }
+	int32 GetNumCacheHits() const { return NumCacheHits; }
+
+private:
+
+	struct FNodeInfos
+	{
+		// Cook count of the node when its infos were cached.
+		int32 CookCount = -1;
+
+		// Value of the cache's generation when the cook count was last checked.
+		uint32 Generation = 0;
+
+		bool bHasGeoInfo = false;
+		HAPI_GeoInfo GeoInfo;
+
+		TMap<HAPI_PartId, HAPI_PartInfo> PartInfos;
+		TMap<TTuple<HAPI_PartId, int32, FString>, HAPI_AttributeInfo> AttributeInfos;
+		TMap<TTuple<HAPI_PartId, int32>, TArray<FString>> AttributeNames;
+	};
+
+	// Returns the cached infos of a node, after discarding them if the node has been cooked since they were cached.
+	// Returns null if the cook count of the node couldn't be queried.
+	FNodeInfos* GetNodeInfos(const HAPI_NodeId& NodeId);
+
+	FQueries Queries;
+
+	TMap<HAPI_NodeId, FNodeInfos> Nodes;
+
+	// Incremented when nodes are cooked.
+	uint32 Generation = 1;
+
+	int32 NumQueries = 0;
+	int32 NumCacheHits = 0;
+
+	static FHoudiniHapiInfoCache* ActiveCache;
+
+	friend class FHoudiniScopedHapiInfoCache;
+};
+
+// Activates a FHoudiniHapiInfoCache for the lifetime of the scope.
+// Nested scopes reuse the cache of the outermost scope.
+class FHoudiniScopedHapiInfoCache
+{
+public:
+
+	FHoudiniScopedHapiInfoCache();
+	~FHoudiniScopedHapiInfoCache();
+
+private:
+
+	// Only set for the outermost scope.
+	TUniquePtr<FHoudiniHapiInfoCache> Cache;
+};
@@ -762,6 +762,10 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 	if (!IsValid(HAC))
 		return false;
 
+	// Batch the input manager updates of all inputs: reference nodes shared by several inputs are reconnected once,
+	// when the scope ends
+	FUnrealObjectInputBatchScope BatchScope;
+
 	//for (auto CurrentInput : HAC->Inputs)
 	for(int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
 	{
@@ -1055,6 +1059,10 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput, const FTransfor
 	// from the manager.
 	FUnrealObjectInputUpdateScope UpdateScope;
 
+	// The batch scope defers the merge reconnects of the reference nodes updated for the input objects (the actors of a
+	// world input, for example): each reference node is then reconnected once, when the scope ends.
+	FUnrealObjectInputBatchScope BatchScope;
+
 	// Iterate on all the input objects and see if they need to be uploaded
 	bool bSuccess = true;
 	TArray<int32> CreatedNodeIds;
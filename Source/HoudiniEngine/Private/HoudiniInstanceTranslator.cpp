@@ -72,6 +72,13 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstancedActorPoolSize(
+	TEXT("HoudiniEngine.InstancedActorPoolSize"),
+	1000,
+	TEXT("Maximum number of hidden actors kept by each instanced actor component, to be reused by later cooks instead of spawning new ones.\n")
+	TEXT("0: Disabled, unused instanced actors are destroyed\n")
+	TEXT("1000: Default\n"));
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -2459,12 +2466,19 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 
 	FHoudiniEngineUtils::KeepOrClearComponentTags(InstancedActorComponent, InstancerHGPO);
 
+	// Unused actors are hidden and kept in a pool, so we can reuse them instead of spawning new ones
+	const int32 MaxPooledActors = FMath::Max(CVarHoudiniEngineInstancedActorPoolSize.GetValueOnAnyThread(), 0);
+	const bool bUseActorPool = MaxPooledActors > 0;
+
 	// See if the instanced object has changed
 	bool bInstancedObjectHasChanged = (InstancedObject != InstancedActorComponent->GetInstancedObject());
 	if (bInstancedObjectHasChanged)
 	{
 		// All actors will need to be respawned, invalidate all of them
-		InstancedActorComponent->ClearAllInstances();
+		if (bUseActorPool)
+			InstancedActorComponent->ReleaseAllInstancesToPool();
+		else
+			InstancedActorComponent->ClearAllInstances();
 
 		// Update the HIAC's instanced asset
 		InstancedActorComponent->SetInstancedObject(InstancedObject);
@@ -2476,7 +2490,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		return false;
 
 	// Set the number of needed instances
-	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
+	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num(), bUseActorPool);
 
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
@@ -2488,7 +2502,10 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		AActor* CurInstance = InstancedActorComponent->GetInstancedActorAt(Idx);
 		if (!IsValid(CurInstance))
 		{
-			CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
+			// Reuse a pooled actor if we can, spawning new actors is expensive
+			CurInstance = bUseActorPool ? InstancedActorComponent->AcquirePooledActor() : nullptr;
+			if (!IsValid(CurInstance))
+				CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
 			InstancedActorComponent->SetInstanceAt(Idx, CurTransform, CurInstance);
 		}
 		else
@@ -2504,6 +2521,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, OriginalInstancerObjectIndices[Idx]);
 	}
 
+	// Don't keep more hidden actors than needed
+	InstancedActorComponent->TrimPool(MaxPooledActors);
+
 	// Update generic properties for the component managing the instances
 	FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(InstancedActorComponent, AllPropertyAttributes);
 
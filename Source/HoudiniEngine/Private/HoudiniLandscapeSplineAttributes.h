@@ -0,0 +1,256 @@
+﻿﻿/*
+* Copyright (c) <2023> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+// This file contains the attribute data read from Houdini curves to create landscape splines. It is only used by
+// HoudiniLandscapeSplineTranslator.cpp and its tests.
+
+#include "CoreMinimal.h"
+
+
+/** Per mesh attribute data for a landscape spline segment. */
+struct FLandscapeSplineSegmentMeshAttributes
+{
+	/** Mesh ref */
+	bool bHasMeshRefAttribute = false;
+	TArray<FString> MeshRef;
+	
+	/** Mesh material override, the outer index is material 0, 1, 2 ... */
+	TArray<TArray<FString>> MeshMaterialOverrideRefs;
+
+	/** Mesh scale. */
+	bool bHasMeshScaleAttribute = false;
+	TArray<float> MeshScale;
+};
+
+
+/** Attribute data extracted from curve points and prims. */
+struct FLandscapeSplineCurveAttributes
+{
+	//
+	// Point Attributes
+	//
+	
+	/** Resampled point positions. */
+	TArray<float> PointPositions;
+	
+	/** Point rotations. */
+	bool bHasPointRotationAttribute = false;
+	TArray<float> PointRotations;
+	
+	/** Point paint layer names */
+	bool bHasPointPaintLayerNameAttribute = false;
+	TArray<FString> PointPaintLayerNames;
+	
+	/** Point bRaiseTerrain */
+	bool bHasPointRaiseTerrainAttribute = false;
+	TArray<int32> PointRaiseTerrains;
+	
+	/** Point bLowerTerrain */
+	bool bHasPointLowerTerrainAttribute = false;
+	TArray<int32> PointLowerTerrains;
+
+	/** The StaticMesh ref per point. */
+	bool bHasPointMeshRefAttribute = false;
+	TArray<FString> PointMeshRefs;
+
+	/**
+	 * The Material Override refs of each point. The outer index material override index, the inner index
+	 * is point index.
+	 */
+	TArray<TArray<FString>> PerMaterialOverridePointRefs;
+
+	/** The static mesh scale of each point. */
+	bool bHasPointMeshScaleAttribute = false;
+	TArray<float> PointMeshScales;
+
+	/** The ids of the control points. */
+	bool bHasPointIdAttribute = false;
+	TArray<int32> PointIds;
+
+	/** The point half-width. */
+	bool bHasPointHalfWidthAttribute = false;
+	TArray<float> PointHalfWidths;
+
+	/** The point side-falloff. */
+	bool bHasPointSideFalloffAttribute = false;
+	TArray<float> PointSideFalloffs;
+
+	/** The point end-falloff. */
+	bool bHasPointEndFalloffAttribute = false;
+	TArray<float> PointEndFalloffs;
+
+	//
+	// Although the following properties are named Vertex... they are point attributes in HAPI (but are intended to be
+	// authored as vertex attributes in Houdini). When curves are extracted via HAPI points and vertices are the same.
+	//
+	
+	/**
+	 * The mesh socket names on the splines' vertices. The outer index is the near side (0) and far side (1) of the
+	 * segment connection. The inner index is a vertex index.
+	 */
+	bool bHasVertexConnectionSocketNameAttribute[2] { false, false };
+	TArray<FString> VertexConnectionSocketNames[2];
+
+	/**
+	 * Tangent length point attribute, for segment connections. The outer index is the near side (0) and far side (1)
+	 * of the segment connection. The inner index is a vertex index.
+	 */
+	bool bHasVertexConnectionTangentLengthAttribute[2] { false, false };
+	TArray<float> VertexConnectionTangentLengths[2];
+
+	/** Vertex/segment paint layer name */
+	bool bHasVertexPaintLayerNameAttribute = false;
+	TArray<FString> VertexPaintLayerNames;
+
+	/** Vertex/segment bRaiseTerrain */
+	bool bHasVertexRaiseTerrainAttribute = false;
+	TArray<int32> VertexRaiseTerrains;
+
+	/** Vertex/segment bLowerTerrain */
+	bool bHasVertexLowerTerrainAttribute = false;
+	TArray<int32> VertexLowerTerrains;
+
+	/** Edit layer name */
+	bool bHasVertexEditLayerAttribute = false;
+	TArray<FString> VertexEditLayers;
+
+	/** Edit layer: clear */
+	bool bHasVertexEditLayerClearAttribute = false;
+	TArray<int32> VertexEditLayersClear;
+
+	/** Edit layer: add after */
+	bool bHasVertexEditLayerAfterAttribute = false;
+	TArray<FString> VertexEditLayersAfter;
+
+	/** Static mesh attributes on vertices. Outer index is mesh 0, 1, 2 ... */
+	TArray<FLandscapeSplineSegmentMeshAttributes> VertexPerMeshSegmentData;
+
+	//
+	// Primitive attributes
+	//
+	
+	/**
+	 * The mesh socket names on the splines' prims. The index is the near side (0) and far side (1) of the
+	 * segment connection.
+	 */
+	bool bHasPrimConnectionSocketNameAttribute[2] { false, false };
+	FString PrimConnectionSocketNames[2];
+
+	/**
+	 * Tangent length point attribute, for segment connections. The index is the near side (0) and far side (1)
+	 * of the segment connection.
+	 */
+	bool bHasPrimConnectionTangentLengthAttribute[2] { false, false };
+	float PrimConnectionTangentLengths[2];
+
+	/** Prim/segment paint layer name */
+	bool bHasPrimPaintLayerNameAttribute = false;
+	FString PrimPaintLayerName;
+
+	/** Prim/segment bRaiseTerrain */
+	bool bHasPrimRaiseTerrainAttribute = false;
+	int32 bPrimRaiseTerrain;
+
+	/** Prim/segment bLowerTerrain */
+	bool bHasPrimLowerTerrainAttribute = false;
+	int32 bPrimLowerTerrain;
+
+	/** Edit layer name */
+	bool bHasPrimEditLayerAttribute = false;
+	FString PrimEditLayer;
+
+	/** Edit layer: clear */
+	bool bHasPrimEditLayerClearAttribute = false;
+	bool bPrimEditLayerClear;
+
+	/** Edit layer: add after */
+	bool bHasPrimEditLayerAfterAttribute = false;
+	FString PrimEditLayerAfter;
+
+	/** Static mesh attribute from primitives, the index is mesh 0, 1, 2 ... */
+	TArray<FLandscapeSplineSegmentMeshAttributes> PrimPerMeshSegmentData;
+};
+
+/**
+ * Primitive attribute data for all curves of a part. Fetched once per part, the values for each curve are then copied
+ * into its FLandscapeSplineCurveAttributes. The index of each array is the curve prim index.
+ */
+struct FLandscapeSplinePrimAttributes
+{
+	bool bHasConnectionSocketNameAttribute[2] { false, false };
+	TArray<FString> ConnectionSocketNames[2];
+
+	bool bHasConnectionTangentLengthAttribute[2] { false, false };
+	TArray<float> ConnectionTangentLengths[2];
+
+	bool bHasPaintLayerNameAttribute = false;
+	TArray<FString> PaintLayerNames;
+
+	bool bHasRaiseTerrainAttribute = false;
+	TArray<int32> RaiseTerrains;
+
+	bool bHasLowerTerrainAttribute = false;
+	TArray<int32> LowerTerrains;
+
+	bool bHasEditLayerAttribute = false;
+	TArray<FString> EditLayers;
+
+	bool bHasEditLayerClearAttribute = false;
+	TArray<int32> EditLayersClear;
+
+	bool bHasEditLayerAfterAttribute = false;
+	TArray<FString> EditLayersAfter;
+
+	TArray<FLandscapeSplineSegmentMeshAttributes> PerMeshSegmentData;
+};
+
+
+/**
+ * Copies InCount tuples starting at tuple InStart from InPartValues to OutValues. OutValues is emptied if the
+ * attribute is missing, and only gets the available tuples if the range goes past the end of InPartValues.
+ */
+template <typename T>
+void
+CopyLandscapeSplineAttributeRange(
+	const bool bInHasAttribute,
+	const TArray<T>& InPartValues,
+	const int32 InTupleSize,
+	const int32 InStart,
+	const int32 InCount,
+	TArray<T>& OutValues)
+{
+	const int32 StartIndex = InStart * InTupleSize;
+	if (!bInHasAttribute || StartIndex < 0 || StartIndex >= InPartValues.Num())
+	{
+		OutValues.Reset();
+		return;
+	}
+
+	const int32 NumValues = FMath::Min(InCount * InTupleSize, InPartValues.Num() - StartIndex);
+	OutValues = TArray<T>(InPartValues.GetData() + StartIndex, NumValues);
+}
@@ -31,6 +31,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
+#include "HoudiniLandscapeSplineAttributes.h"
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniPackageParams.h"
 #include "HoudiniSplineTranslator.h"
@@ -44,170 +45,6 @@
 #include "WorldPartition/WorldPartition.h"
 
 
-/** Per mesh attribute data for a landscape spline segment. */
-struct FLandscapeSplineSegmentMeshAttributes
-{
-	/** Mesh ref */
-	bool bHasMeshRefAttribute = false;
-	TArray<FString> MeshRef;
-	
-	/** Mesh material override, the outer index is material 0, 1, 2 ... */
-	TArray<TArray<FString>> MeshMaterialOverrideRefs;
-
-	/** Mesh scale. */
-	bool bHasMeshScaleAttribute = false;
-	TArray<float> MeshScale;
-};
-
-
-/** Attribute data extracted from curve points and prims. */
-struct FLandscapeSplineCurveAttributes
-{
-	//
-	// Point Attributes
-	//
-	
-	/** Resampled point positions. */
-	TArray<float> PointPositions;
-	
-	/** Point rotations. */
-	bool bHasPointRotationAttribute = false;
-	TArray<float> PointRotations;
-	
-	/** Point paint layer names */
-	bool bHasPointPaintLayerNameAttribute = false;
-	TArray<FString> PointPaintLayerNames;
-	
-	/** Point bRaiseTerrain */
-	bool bHasPointRaiseTerrainAttribute = false;
-	TArray<int32> PointRaiseTerrains;
-	
-	/** Point bLowerTerrain */
-	bool bHasPointLowerTerrainAttribute = false;
-	TArray<int32> PointLowerTerrains;
-
-	/** The StaticMesh ref per point. */
-	bool bHasPointMeshRefAttribute = false;
-	TArray<FString> PointMeshRefs;
-
-	/**
-	 * The Material Override refs of each point. The outer index material override index, the inner index
-	 * is point index.
-	 */
-	TArray<TArray<FString>> PerMaterialOverridePointRefs;
-
-	/** The static mesh scale of each point. */
-	bool bHasPointMeshScaleAttribute = false;
-	TArray<float> PointMeshScales;
-
-	/** The ids of the control points. */
-	bool bHasPointIdAttribute = false;
-	TArray<int32> PointIds;
-
-	/** The point half-width. */
-	bool bHasPointHalfWidthAttribute = false;
-	TArray<float> PointHalfWidths;
-
-	/** The point side-falloff. */
-	bool bHasPointSideFalloffAttribute = false;
-	TArray<float> PointSideFalloffs;
-
-	/** The point end-falloff. */
-	bool bHasPointEndFalloffAttribute = false;
-	TArray<float> PointEndFalloffs;
-
-	//
-	// Although the following properties are named Vertex... they are point attributes in HAPI (but are intended to be
-	// authored as vertex attributes in Houdini). When curves are extracted via HAPI points and vertices are the same.
-	//
-	
-	/**
-	 * The mesh socket names on the splines' vertices. The outer index is the near side (0) and far side (1) of the
-	 * segment connection. The inner index is a vertex index.
-	 */
-	bool bHasVertexConnectionSocketNameAttribute[2] { false, false };
-	TArray<FString> VertexConnectionSocketNames[2];
-
-	/**
-	 * Tangent length point attribute, for segment connections. The outer index is the near side (0) and far side (1)
-	 * of the segment connection. The inner index is a vertex index.
-	 */
-	bool bHasVertexConnectionTangentLengthAttribute[2] { false, false };
-	TArray<float> VertexConnectionTangentLengths[2];
-
-	/** Vertex/segment paint layer name */
-	bool bHasVertexPaintLayerNameAttribute = false;
-	TArray<FString> VertexPaintLayerNames;
-
-	/** Vertex/segment bRaiseTerrain */
-	bool bHasVertexRaiseTerrainAttribute = false;
-	TArray<int32> VertexRaiseTerrains;
-
-	/** Vertex/segment bLowerTerrain */
-	bool bHasVertexLowerTerrainAttribute = false;
-	TArray<int32> VertexLowerTerrains;
-
-	/** Edit layer name */
-	bool bHasVertexEditLayerAttribute = false;
-	TArray<FString> VertexEditLayers;
-
-	/** Edit layer: clear */
-	bool bHasVertexEditLayerClearAttribute = false;
-	TArray<int32> VertexEditLayersClear;
-
-	/** Edit layer: add after */
-	bool bHasVertexEditLayerAfterAttribute = false;
-	TArray<FString> VertexEditLayersAfter;
-
-	/** Static mesh attributes on vertices. Outer index is mesh 0, 1, 2 ... */
-	TArray<FLandscapeSplineSegmentMeshAttributes> VertexPerMeshSegmentData;
-
-	//
-	// Primitive attributes
-	//
-	
-	/**
-	 * The mesh socket names on the splines' prims. The index is the near side (0) and far side (1) of the
-	 * segment connection.
-	 */
-	bool bHasPrimConnectionSocketNameAttribute[2] { false, false };
-	FString PrimConnectionSocketNames[2];
-
-	/**
-	 * Tangent length point attribute, for segment connections. The index is the near side (0) and far side (1)
-	 * of the segment connection.
-	 */
-	bool bHasPrimConnectionTangentLengthAttribute[2] { false, false };
-	float PrimConnectionTangentLengths[2];
-
-	/** Prim/segment paint layer name */
-	bool bHasPrimPaintLayerNameAttribute = false;
-	FString PrimPaintLayerName;
-
-	/** Prim/segment bRaiseTerrain */
-	bool bHasPrimRaiseTerrainAttribute = false;
-	int32 bPrimRaiseTerrain;
-
-	/** Prim/segment bLowerTerrain */
-	bool bHasPrimLowerTerrainAttribute = false;
-	int32 bPrimLowerTerrain;
-
-	/** Edit layer name */
-	bool bHasPrimEditLayerAttribute = false;
-	FString PrimEditLayer;
-
-	/** Edit layer: clear */
-	bool bHasPrimEditLayerClearAttribute = false;
-	bool bPrimEditLayerClear;
-
-	/** Edit layer: add after */
-	bool bHasPrimEditLayerAfterAttribute = false;
-	FString PrimEditLayerAfter;
-
-	/** Static mesh attribute from primitives, the index is mesh 0, 1, 2 ... */
-	TArray<FLandscapeSplineSegmentMeshAttributes> PrimPerMeshSegmentData;
-};
-
 /**
  * Transient/transactional struct for processing landscape spline output. Used in
  * CreateOutputLandscapeSplinesFromHoudiniGeoPartObject(). This is not a UStruct / does n0t use UProperties. We do not
@@ -281,6 +118,37 @@ struct FLandscapeSplineInfo
 };
 
 
+static void
+CopySegmentMeshAttributeRange(
+	const TArray<FLandscapeSplineSegmentMeshAttributes>& InPartAttributes,
+	const int32 InStart,
+	const int32 InCount,
+	TArray<FLandscapeSplineSegmentMeshAttributes>& OutAttributes)
+{
+	OutAttributes.SetNum(InPartAttributes.Num());
+	for (int32 MeshIdx = 0; MeshIdx < InPartAttributes.Num(); ++MeshIdx)
+	{
+		const FLandscapeSplineSegmentMeshAttributes& PartMeshAttributes = InPartAttributes[MeshIdx];
+		FLandscapeSplineSegmentMeshAttributes& MeshAttributes = OutAttributes[MeshIdx];
+
+		MeshAttributes.bHasMeshRefAttribute = PartMeshAttributes.bHasMeshRefAttribute;
+		CopyLandscapeSplineAttributeRange(PartMeshAttributes.bHasMeshRefAttribute, PartMeshAttributes.MeshRef, 1, InStart, InCount, MeshAttributes.MeshRef);
+
+		MeshAttributes.bHasMeshScaleAttribute = PartMeshAttributes.bHasMeshScaleAttribute;
+		CopyLandscapeSplineAttributeRange(PartMeshAttributes.bHasMeshScaleAttribute, PartMeshAttributes.MeshScale, 3, InStart, InCount, MeshAttributes.MeshScale);
+
+		const int32 NumMaterialOverrides = PartMeshAttributes.MeshMaterialOverrideRefs.Num();
+		MeshAttributes.MeshMaterialOverrideRefs.SetNum(NumMaterialOverrides);
+		for (int32 MaterialOverrideIdx = 0; MaterialOverrideIdx < NumMaterialOverrides; ++MaterialOverrideIdx)
+		{
+			CopyLandscapeSplineAttributeRange(
+				true, PartMeshAttributes.MeshMaterialOverrideRefs[MaterialOverrideIdx], 1, InStart, InCount,
+				MeshAttributes.MeshMaterialOverrideRefs[MaterialOverrideIdx]);
+		}
+	}
+}
+
+
 FVector 
 ConvertPositionToVector(const float* InPosition)
 {
@@ -679,6 +547,18 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 	TArray<int32> CurvePointCounts;
 	CurvePointCounts.SetNumZeroed(NumCurves);
 	FHoudiniApi::GetCurveCounts(Session, CurveNodeId, CurvePartId, CurvePointCounts.GetData(), 0, NumCurves);
+
+	int32 TotalNumPoints = 0;
+	for (const int32 NumPointsInCurve : CurvePointCounts)
+		TotalNumPoints += NumPointsInCurve;
+
+	// Fetch the curve attributes for all points and prims of the part at once. Each curve then copies its own range,
+	// instead of doing a HAPI call per attribute and per curve, which was very slow on large spline networks.
+	// Attributes that could not be fetched are left empty, and result in empty ranges for each curve.
+	FLandscapeSplineCurveAttributes PartPointAttributes;
+	FLandscapeSplinePrimAttributes PartPrimAttributes;
+	CopyPointAttributesFromHoudini(CurveNodeId, CurvePartId, 0, TotalNumPoints, PartPointAttributes);
+	CopyPrimAttributesFromHoudini(CurveNodeId, CurvePartId, NumCurves, PartPointAttributes, PartPrimAttributes);
 	
 	// Extract all target landscapes refs as prim attributes
 	TArray<FString> LandscapeRefs;
@@ -885,10 +765,10 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 		const int32 CurveFirstPointIndex = NextCurveStartPointIdx - NumPointsInCurve;
 		SplineInfo->PerCurveFirstPointIndex.Add(CurveFirstPointIndex);
 
-		// Copy the attributes for this curve primitive from Houdini / HAPI
-		CopyCurveAttributesFromHoudini(
-			CurveNodeId,
-			CurvePartId,
+		// Copy the attributes for this curve primitive from the part's attributes
+		CopyCurveAttributes(
+			PartPointAttributes,
+			PartPrimAttributes,
 			CurveIdx,
 			CurveFirstPointIndex,
 			NumPointsInCurve,
@@ -937,6 +817,17 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 		TArray<TObjectPtr<ULandscapeSplineControlPoint>>& ControlPoints = SplineInfo.SplinesComponent->GetControlPoints();
 		TArray<TObjectPtr<ULandscapeSplineSegment>>& Segments = SplineInfo.SplinesComponent->GetSegments();
 
+		// Each curve point can at most be one control point / the end of one segment, reserve space for all of them
+		// up front instead of growing the arrays one object at a time on large networks.
+		int32 NumPointsInSpline = 0;
+		for (const int32 NumPointsInCurve : SplineInfo.PerCurvePointCount)
+			NumPointsInSpline += NumPointsInCurve;
+		ControlPoints.Reserve(ControlPoints.Num() + NumPointsInSpline);
+		Segments.Reserve(Segments.Num() + NumPointsInSpline);
+		SplineInfo.SplinesOutputObject->GetControlPoints().Reserve(SplineInfo.SplinesOutputObject->GetControlPoints().Num() + NumPointsInSpline);
+		SplineInfo.SplinesOutputObject->GetSegments().Reserve(SplineInfo.SplinesOutputObject->GetSegments().Num() + NumPointsInSpline);
+		SplineInfo.ControlPointMap.Reserve(NumPointsInSpline);
+
 		// Process each curve primitive recorded in SplineInfo. Each curve primitive will be at least one segment (with
 		// at least the first and last points of the primitive being control points).
 		const int32 NumCurvesInSpline = SplineInfo.PerCurveFirstPointIndex.Num();
@@ -1050,6 +941,7 @@ FHoudiniLandscapeSplineTranslator::CreateOutputLandscapeSplinesFromHoudiniGeoPar
 			}
 		}
 
+		// Spline meshes are only rebuilt once the whole network has been wired up
 		SplineInfo.SplinesComponent->RebuildAllSplines();
 		
 		FHoudiniOutputObject* const OutputObject = OutputSplines.Find(SplineInfo.Identifier);
@@ -1284,19 +1176,15 @@ FHoudiniLandscapeSplineTranslator::CopySegmentMeshAttributesFromHoudini(
 }
 
 bool
-FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
+FHoudiniLandscapeSplineTranslator::CopyPointAttributesFromHoudini(
 	const HAPI_NodeId InNodeId,
 	const HAPI_PartId InPartId,
-	const int32 InPrimIndex,
 	const int32 InFirstPointIndex,
 	const int32 InNumPoints,
 	FLandscapeSplineCurveAttributes& OutCurveAttributes)
 {
-	// Some constants that are reused
 	// Tuple size of 1
 	static constexpr int32 TupleSizeOne = 1;
-	// Prim attribute data count of 1
-	static constexpr int32 NumPrimsOne = 1;
 
 	// point positions
 	static constexpr int32 PositionTupleSize = 3;
@@ -1517,56 +1405,6 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 			HAPI_ATTROWNER_POINT,
 			InFirstPointIndex,
 			InNumPoints);
-
-		// segment connection[ConnectionIndex] socket names -- prim attribute
-		if (!OutCurveAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex])
-		{
-			TArray<FString> SocketNames;
-			HAPI_AttributeInfo PrimMeshSocketNameAttrInfo;
-			OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-				InNodeId,
-				InPartId,
-				ConnectionMeshSocketNameAttrNames[ConnectionIndex],
-				PrimMeshSocketNameAttrInfo,
-				SocketNames,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne);
-			if (OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] && SocketNames.Num() > 0)
-			{
-				OutCurveAttributes.PrimConnectionSocketNames[ConnectionIndex] = SocketNames[0];
-			}
-		}
-		else
-		{
-			OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] = false;
-		}
-
-		// segment connection[ConnectionIndex] tangents -- prim attribute
-		if (!OutCurveAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex])
-		{
-			TArray<float> Tangents;
-			HAPI_AttributeInfo PrimTangentLengthAttrInfo;
-			OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-				InNodeId,
-				InPartId,
-				ConnectionTangentLengthAttrNames[ConnectionIndex],
-				PrimTangentLengthAttrInfo,
-				Tangents,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne);
-			if (OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] && Tangents.Num() > 0)
-			{
-				OutCurveAttributes.PrimConnectionTangentLengths[ConnectionIndex] = Tangents[0];
-			}
-		}
-		else
-		{
-			OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] = false;
-		}
 	}
 
 	// segment paint layer name -- vertex/point
@@ -1647,198 +1485,307 @@ FHoudiniLandscapeSplineTranslator::CopyCurveAttributesFromHoudini(
 		InFirstPointIndex,
 		InNumPoints);
 
-	// segment paint layer name
-	if (!OutCurveAttributes.bHasVertexPaintLayerNameAttribute)
+	// Copy segment mesh attributes from Houdini -- vertex/point attributes
+	if (!CopySegmentMeshAttributesFromHoudini(
+			InNodeId, InPartId, HAPI_ATTROWNER_POINT, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPerMeshSegmentData))
 	{
-		TArray<FString> SegmentPaintLayerName;
-		HAPI_AttributeInfo PrimLayerNameAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+		return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniLandscapeSplineTranslator::CopyPrimAttributesFromHoudini(
+	const HAPI_NodeId InNodeId,
+	const HAPI_PartId InPartId,
+	const int32 InNumPrims,
+	const FLandscapeSplineCurveAttributes& InPointAttributes,
+	FLandscapeSplinePrimAttributes& OutPrimAttributes)
+{
+	// Prim attributes are only used when the equivalent vertex/point attribute is not present.
+
+	// Tuple size of 1
+	static constexpr int32 TupleSizeOne = 1;
+
+	// Connection attributes -- there are separate attributes for the two ends of the connection
+	static const char* ConnectionMeshSocketNameAttrNames[]
+	{
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_MESH_SOCKET_NAME,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_MESH_SOCKET_NAME
+	};
+	static const char* ConnectionTangentLengthAttrNames[]
+	{
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION0_TANGENT_LENGTH,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONNECTION1_TANGENT_LENGTH
+	};
+	for (int32 ConnectionIndex = 0; ConnectionIndex < 2; ++ConnectionIndex)
+	{
+		// segment connection[ConnectionIndex] socket names -- prim attribute
+		if (!InPointAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex])
+		{
+			HAPI_AttributeInfo PrimMeshSocketNameAttrInfo;
+			OutPrimAttributes.bHasConnectionSocketNameAttribute[ConnectionIndex] = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 				InNodeId,
 				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME,
-				PrimLayerNameAttrInfo,
-				SegmentPaintLayerName,
+				ConnectionMeshSocketNameAttrNames[ConnectionIndex],
+				PrimMeshSocketNameAttrInfo,
+				OutPrimAttributes.ConnectionSocketNames[ConnectionIndex],
 				TupleSizeOne,
 				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && SegmentPaintLayerName.Num() > 0)
-		{
-			OutCurveAttributes.PrimPaintLayerName = SegmentPaintLayerName[0];
-			OutCurveAttributes.bHasPrimPaintLayerNameAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.PrimPaintLayerName = FString();
-			OutCurveAttributes.bHasPrimPaintLayerNameAttribute = false;
+				0,
+				InNumPrims);
 		}
-	}
-	else
-	{
-		OutCurveAttributes.bHasPrimPaintLayerNameAttribute = false;
-	}
 
-	// segment raise terrains
-	if (!OutCurveAttributes.bHasVertexRaiseTerrainAttribute)
-	{
-		TArray<int32> RaiseTerrains;
-		HAPI_AttributeInfo PrimRaiseTerrainAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+		// segment connection[ConnectionIndex] tangents -- prim attribute
+		if (!InPointAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex])
+		{
+			HAPI_AttributeInfo PrimTangentLengthAttrInfo;
+			OutPrimAttributes.bHasConnectionTangentLengthAttribute[ConnectionIndex] = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 				InNodeId,
 				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN,
-				PrimRaiseTerrainAttrInfo,
-				RaiseTerrains,
+				ConnectionTangentLengthAttrNames[ConnectionIndex],
+				PrimTangentLengthAttrInfo,
+				OutPrimAttributes.ConnectionTangentLengths[ConnectionIndex],
 				TupleSizeOne,
 				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && RaiseTerrains.Num() > 0)
-		{
-			OutCurveAttributes.bPrimRaiseTerrain = RaiseTerrains[0];
-			OutCurveAttributes.bHasPrimRaiseTerrainAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.bPrimRaiseTerrain = false;
-			OutCurveAttributes.bHasPrimRaiseTerrainAttribute = false;
+				0,
+				InNumPrims);
 		}
 	}
-	else
+
+	// segment paint layer name -- prim
+	if (!InPointAttributes.bHasVertexPaintLayerNameAttribute)
 	{
-		OutCurveAttributes.bHasPrimRaiseTerrainAttribute = false;
+		HAPI_AttributeInfo PrimLayerNameAttrInfo;
+		OutPrimAttributes.bHasPaintLayerNameAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_PAINT_LAYER_NAME,
+			PrimLayerNameAttrInfo,
+			OutPrimAttributes.PaintLayerNames,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
 
-	// segment lower terrains
-	if (!OutCurveAttributes.bHasVertexLowerTerrainAttribute)
+	// segment raise terrains -- prim
+	if (!InPointAttributes.bHasVertexRaiseTerrainAttribute)
 	{
-		TArray<int32> LowerTerrains;
-		HAPI_AttributeInfo PrimLowerTerrainAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-				InNodeId,
-				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN,
-				PrimLowerTerrainAttrInfo,
-				LowerTerrains,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && LowerTerrains.Num() > 0)
-		{
-			OutCurveAttributes.bPrimLowerTerrain = LowerTerrains[0];
-			OutCurveAttributes.bHasPrimLowerTerrainAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.bPrimLowerTerrain = false;
-			OutCurveAttributes.bHasPrimLowerTerrainAttribute = false;
-		}
+		HAPI_AttributeInfo PrimRaiseTerrainAttrInfo;
+		OutPrimAttributes.bHasRaiseTerrainAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_RAISE_TERRAIN,
+			PrimRaiseTerrainAttrInfo,
+			OutPrimAttributes.RaiseTerrains,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
-	else
+
+	// segment lower terrains -- prim
+	if (!InPointAttributes.bHasVertexLowerTerrainAttribute)
 	{
-		OutCurveAttributes.bHasPrimLowerTerrainAttribute = false;
+		HAPI_AttributeInfo PrimLowerTerrainAttrInfo;
+		OutPrimAttributes.bHasLowerTerrainAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_SEGMENT_LOWER_TERRAIN,
+			PrimLowerTerrainAttrInfo,
+			OutPrimAttributes.LowerTerrains,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
 
 	// segment edit layer -- prim
-	if (!OutCurveAttributes.bHasVertexEditLayerAttribute)
+	if (!InPointAttributes.bHasVertexEditLayerAttribute)
 	{
-		TArray<FString> EditLayers;
 		HAPI_AttributeInfo PrimEditLayerAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-				InNodeId,
-				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME,
-				PrimEditLayerAttrInfo,
-				EditLayers,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && EditLayers.Num() > 0)
-		{
-			OutCurveAttributes.PrimEditLayer = EditLayers[0];
-			OutCurveAttributes.bHasPrimEditLayerAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.bHasPrimEditLayerAttribute = false;
-		}
-	}
-	else
-	{
-		OutCurveAttributes.bHasPrimEditLayerAttribute = false;
+		OutPrimAttributes.bHasEditLayerAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_NAME,
+			PrimEditLayerAttrInfo,
+			OutPrimAttributes.EditLayers,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
 
 	// segment edit layer clear -- prim
-	if (!OutCurveAttributes.bHasVertexEditLayerClearAttribute)
+	if (!InPointAttributes.bHasVertexEditLayerClearAttribute)
 	{
-		TArray<int32> EditLayersClear;
 		HAPI_AttributeInfo PrimEditLayerClearAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-				InNodeId,
-				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR,
-				PrimEditLayerClearAttrInfo,
-				EditLayersClear,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && EditLayersClear.Num() > 0)
-		{
-			OutCurveAttributes.bPrimEditLayerClear = static_cast<bool>(EditLayersClear[0]);
-			OutCurveAttributes.bHasPrimEditLayerClearAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.bHasPrimEditLayerClearAttribute = false;
-		}
-	}
-	else
-	{
-		OutCurveAttributes.bHasPrimEditLayerClearAttribute = false;
+		OutPrimAttributes.bHasEditLayerClearAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_CLEAR,
+			PrimEditLayerClearAttrInfo,
+			OutPrimAttributes.EditLayersClear,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
 
 	// segment edit layer after -- prim
-	if (!OutCurveAttributes.bHasVertexEditLayerAfterAttribute)
+	if (!InPointAttributes.bHasVertexEditLayerAfterAttribute)
 	{
-		TArray<FString> EditLayersAfter;
 		HAPI_AttributeInfo PrimEditLayerAfterAttrInfo;
-		if (FHoudiniEngineUtils::HapiGetAttributeDataAsString(
-				InNodeId,
-				InPartId,
-				HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER,
-				PrimEditLayerAfterAttrInfo,
-				EditLayersAfter,
-				TupleSizeOne,
-				HAPI_ATTROWNER_PRIM,
-				InPrimIndex,
-				NumPrimsOne) && EditLayersAfter.Num() > 0)
-		{
-			OutCurveAttributes.PrimEditLayerAfter = EditLayersAfter[0];
-			OutCurveAttributes.bHasPrimEditLayerAfterAttribute = true;
-		}
-		else
-		{
-			OutCurveAttributes.bHasPrimEditLayerAfterAttribute = false;
-		}
-	}
-	else
-	{
-		OutCurveAttributes.bHasPrimEditLayerAfterAttribute = false;
+		OutPrimAttributes.bHasEditLayerAfterAttribute = FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+			InNodeId,
+			InPartId,
+			HAPI_UNREAL_ATTRIB_LANDSCAPE_EDITLAYER_AFTER,
+			PrimEditLayerAfterAttrInfo,
+			OutPrimAttributes.EditLayersAfter,
+			TupleSizeOne,
+			HAPI_ATTROWNER_PRIM,
+			0,
+			InNumPrims);
 	}
 
-	// Copy segment mesh attributes from Houdini -- vertex/point attributes
-	if (!CopySegmentMeshAttributesFromHoudini(
-			InNodeId, InPartId, HAPI_ATTROWNER_POINT, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPerMeshSegmentData))
+	// Copy segment mesh attributes from Houdini -- prim attributes
+	return CopySegmentMeshAttributesFromHoudini(
+		InNodeId, InPartId, HAPI_ATTROWNER_PRIM, 0, InNumPrims, OutPrimAttributes.PerMeshSegmentData);
+}
+
+void
+FHoudiniLandscapeSplineTranslator::CopyCurveAttributes(
+	const FLandscapeSplineCurveAttributes& InPartPointAttributes,
+	const FLandscapeSplinePrimAttributes& InPartPrimAttributes,
+	const int32 InPrimIndex,
+	const int32 InFirstPointIndex,
+	const int32 InNumPoints,
+	FLandscapeSplineCurveAttributes& OutCurveAttributes)
+{
+	// Point attributes: copy the range of points of this curve
+	static constexpr bool bAlwaysPresent = true;
+	CopyLandscapeSplineAttributeRange(bAlwaysPresent, InPartPointAttributes.PointPositions, 3, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointPositions);
+
+	OutCurveAttributes.bHasPointRotationAttribute = InPartPointAttributes.bHasPointRotationAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointRotationAttribute, InPartPointAttributes.PointRotations, 4, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointRotations);
+
+	OutCurveAttributes.bHasPointPaintLayerNameAttribute = InPartPointAttributes.bHasPointPaintLayerNameAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointPaintLayerNameAttribute, InPartPointAttributes.PointPaintLayerNames, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointPaintLayerNames);
+
+	OutCurveAttributes.bHasPointRaiseTerrainAttribute = InPartPointAttributes.bHasPointRaiseTerrainAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointRaiseTerrainAttribute, InPartPointAttributes.PointRaiseTerrains, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointRaiseTerrains);
+
+	OutCurveAttributes.bHasPointLowerTerrainAttribute = InPartPointAttributes.bHasPointLowerTerrainAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointLowerTerrainAttribute, InPartPointAttributes.PointLowerTerrains, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointLowerTerrains);
+
+	OutCurveAttributes.bHasPointMeshRefAttribute = InPartPointAttributes.bHasPointMeshRefAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointMeshRefAttribute, InPartPointAttributes.PointMeshRefs, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointMeshRefs);
+
+	const int32 NumMaterialOverrides = InPartPointAttributes.PerMaterialOverridePointRefs.Num();
+	OutCurveAttributes.PerMaterialOverridePointRefs.SetNum(NumMaterialOverrides);
+	for (int32 MaterialOverrideIdx = 0; MaterialOverrideIdx < NumMaterialOverrides; ++MaterialOverrideIdx)
 	{
-		return false;
+		CopyLandscapeSplineAttributeRange(
+			bAlwaysPresent, InPartPointAttributes.PerMaterialOverridePointRefs[MaterialOverrideIdx], 1, InFirstPointIndex, InNumPoints,
+			OutCurveAttributes.PerMaterialOverridePointRefs[MaterialOverrideIdx]);
 	}
 
-	// Copy segment mesh attributes from Houdini -- prim attributes
-	if (!CopySegmentMeshAttributesFromHoudini(
-			InNodeId, InPartId, HAPI_ATTROWNER_PRIM, InPrimIndex, 1, OutCurveAttributes.PrimPerMeshSegmentData))
+	OutCurveAttributes.bHasPointMeshScaleAttribute = InPartPointAttributes.bHasPointMeshScaleAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointMeshScaleAttribute, InPartPointAttributes.PointMeshScales, 3, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointMeshScales);
+
+	OutCurveAttributes.bHasPointIdAttribute = InPartPointAttributes.bHasPointIdAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointIdAttribute, InPartPointAttributes.PointIds, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointIds);
+
+	OutCurveAttributes.bHasPointHalfWidthAttribute = InPartPointAttributes.bHasPointHalfWidthAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointHalfWidthAttribute, InPartPointAttributes.PointHalfWidths, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointHalfWidths);
+
+	OutCurveAttributes.bHasPointSideFalloffAttribute = InPartPointAttributes.bHasPointSideFalloffAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointSideFalloffAttribute, InPartPointAttributes.PointSideFalloffs, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointSideFalloffs);
+
+	OutCurveAttributes.bHasPointEndFalloffAttribute = InPartPointAttributes.bHasPointEndFalloffAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasPointEndFalloffAttribute, InPartPointAttributes.PointEndFalloffs, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.PointEndFalloffs);
+
+	for (int32 ConnectionIndex = 0; ConnectionIndex < 2; ++ConnectionIndex)
 	{
-		return false;
+		const bool bHasVertexSocketName = InPartPointAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex];
+		OutCurveAttributes.bHasVertexConnectionSocketNameAttribute[ConnectionIndex] = bHasVertexSocketName;
+		CopyLandscapeSplineAttributeRange(
+			bHasVertexSocketName, InPartPointAttributes.VertexConnectionSocketNames[ConnectionIndex], 1, InFirstPointIndex, InNumPoints,
+			OutCurveAttributes.VertexConnectionSocketNames[ConnectionIndex]);
+
+		const bool bHasVertexTangentLength = InPartPointAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex];
+		OutCurveAttributes.bHasVertexConnectionTangentLengthAttribute[ConnectionIndex] = bHasVertexTangentLength;
+		CopyLandscapeSplineAttributeRange(
+			bHasVertexTangentLength, InPartPointAttributes.VertexConnectionTangentLengths[ConnectionIndex], 1, InFirstPointIndex, InNumPoints,
+			OutCurveAttributes.VertexConnectionTangentLengths[ConnectionIndex]);
+
+		// Prim values: only present if the vertex attribute was not found
+		OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex] = InPartPrimAttributes.bHasConnectionSocketNameAttribute[ConnectionIndex]
+			&& InPartPrimAttributes.ConnectionSocketNames[ConnectionIndex].IsValidIndex(InPrimIndex);
+		if (OutCurveAttributes.bHasPrimConnectionSocketNameAttribute[ConnectionIndex])
+			OutCurveAttributes.PrimConnectionSocketNames[ConnectionIndex] = InPartPrimAttributes.ConnectionSocketNames[ConnectionIndex][InPrimIndex];
+
+		OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex] = InPartPrimAttributes.bHasConnectionTangentLengthAttribute[ConnectionIndex]
+			&& InPartPrimAttributes.ConnectionTangentLengths[ConnectionIndex].IsValidIndex(InPrimIndex);
+		if (OutCurveAttributes.bHasPrimConnectionTangentLengthAttribute[ConnectionIndex])
+			OutCurveAttributes.PrimConnectionTangentLengths[ConnectionIndex] = InPartPrimAttributes.ConnectionTangentLengths[ConnectionIndex][InPrimIndex];
 	}
 
-	return true;
+	OutCurveAttributes.bHasVertexPaintLayerNameAttribute = InPartPointAttributes.bHasVertexPaintLayerNameAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexPaintLayerNameAttribute, InPartPointAttributes.VertexPaintLayerNames, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPaintLayerNames);
+
+	OutCurveAttributes.bHasVertexRaiseTerrainAttribute = InPartPointAttributes.bHasVertexRaiseTerrainAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexRaiseTerrainAttribute, InPartPointAttributes.VertexRaiseTerrains, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexRaiseTerrains);
+
+	OutCurveAttributes.bHasVertexLowerTerrainAttribute = InPartPointAttributes.bHasVertexLowerTerrainAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexLowerTerrainAttribute, InPartPointAttributes.VertexLowerTerrains, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexLowerTerrains);
+
+	OutCurveAttributes.bHasVertexEditLayerAttribute = InPartPointAttributes.bHasVertexEditLayerAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexEditLayerAttribute, InPartPointAttributes.VertexEditLayers, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexEditLayers);
+
+	OutCurveAttributes.bHasVertexEditLayerClearAttribute = InPartPointAttributes.bHasVertexEditLayerClearAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexEditLayerClearAttribute, InPartPointAttributes.VertexEditLayersClear, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexEditLayersClear);
+
+	OutCurveAttributes.bHasVertexEditLayerAfterAttribute = InPartPointAttributes.bHasVertexEditLayerAfterAttribute;
+	CopyLandscapeSplineAttributeRange(InPartPointAttributes.bHasVertexEditLayerAfterAttribute, InPartPointAttributes.VertexEditLayersAfter, 1, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexEditLayersAfter);
+
+	CopySegmentMeshAttributeRange(InPartPointAttributes.VertexPerMeshSegmentData, InFirstPointIndex, InNumPoints, OutCurveAttributes.VertexPerMeshSegmentData);
+
+	// Prim attributes: pick the value of this curve's primitive
+	OutCurveAttributes.bHasPrimPaintLayerNameAttribute = InPartPrimAttributes.bHasPaintLayerNameAttribute
+		&& InPartPrimAttributes.PaintLayerNames.IsValidIndex(InPrimIndex);
+	OutCurveAttributes.PrimPaintLayerName = OutCurveAttributes.bHasPrimPaintLayerNameAttribute
+		? InPartPrimAttributes.PaintLayerNames[InPrimIndex] : FString();
+
+	OutCurveAttributes.bHasPrimRaiseTerrainAttribute = InPartPrimAttributes.bHasRaiseTerrainAttribute
+		&& InPartPrimAttributes.RaiseTerrains.IsValidIndex(InPrimIndex);
+	OutCurveAttributes.bPrimRaiseTerrain = OutCurveAttributes.bHasPrimRaiseTerrainAttribute
+		? InPartPrimAttributes.RaiseTerrains[InPrimIndex] : false;
+
+	OutCurveAttributes.bHasPrimLowerTerrainAttribute = InPartPrimAttributes.bHasLowerTerrainAttribute
+		&& InPartPrimAttributes.LowerTerrains.IsValidIndex(InPrimIndex);
+	OutCurveAttributes.bPrimLowerTerrain = OutCurveAttributes.bHasPrimLowerTerrainAttribute
+		? InPartPrimAttributes.LowerTerrains[InPrimIndex] : false;
+
+	OutCurveAttributes.bHasPrimEditLayerAttribute = InPartPrimAttributes.bHasEditLayerAttribute
+		&& InPartPrimAttributes.EditLayers.IsValidIndex(InPrimIndex);
+	if (OutCurveAttributes.bHasPrimEditLayerAttribute)
+		OutCurveAttributes.PrimEditLayer = InPartPrimAttributes.EditLayers[InPrimIndex];
+
+	OutCurveAttributes.bHasPrimEditLayerClearAttribute = InPartPrimAttributes.bHasEditLayerClearAttribute
+		&& InPartPrimAttributes.EditLayersClear.IsValidIndex(InPrimIndex);
+	if (OutCurveAttributes.bHasPrimEditLayerClearAttribute)
+		OutCurveAttributes.bPrimEditLayerClear = static_cast<bool>(InPartPrimAttributes.EditLayersClear[InPrimIndex]);
+
+	OutCurveAttributes.bHasPrimEditLayerAfterAttribute = InPartPrimAttributes.bHasEditLayerAfterAttribute
+		&& InPartPrimAttributes.EditLayersAfter.IsValidIndex(InPrimIndex);
+	if (OutCurveAttributes.bHasPrimEditLayerAfterAttribute)
+		OutCurveAttributes.PrimEditLayerAfter = InPartPrimAttributes.EditLayersAfter[InPrimIndex];
+
+	static constexpr int32 NumPrimsOne = 1;
+	CopySegmentMeshAttributeRange(InPartPrimAttributes.PerMeshSegmentData, InPrimIndex, NumPrimsOne, OutCurveAttributes.PrimPerMeshSegmentData);
 }
 
 bool
@@ -46,6 +46,7 @@ class UHoudiniAssetComponent;
 struct FHoudiniPackageParams;
 struct FLandscapeSplineInfo;
 struct FLandscapeSplineCurveAttributes;
+struct FLandscapeSplinePrimAttributes;
 struct FLandscapeSplineSegmentMeshAttributes;
 struct FHoudiniLandscapeSplineApplyLayerData;
 
@@ -103,8 +104,20 @@ struct HOUDINIENGINE_API FHoudiniLandscapeSplineTranslator
 		UHoudiniAssetComponent* InHAC=nullptr);
 
 private:
+	// Copies the curve attributes of stand-in parts without a session
+	friend class HoudiniCoreTest_LandscapeSplineCurveAttributes;
+
 	static void DeleteTempLandscapeLayers(UHoudiniOutput* InOutput);
 
+	/** Copies the attributes of a single curve from the attributes fetched for the whole part. */
+	static void CopyCurveAttributes(
+		const FLandscapeSplineCurveAttributes& InPartPointAttributes,
+		const FLandscapeSplinePrimAttributes& InPartPrimAttributes,
+		int32 InPrimIndex,
+		int32 InFirstPointIndex,
+		int32 InNumPoints,
+		FLandscapeSplineCurveAttributes& OutCurveAttributes);
+
 	static void AddSegmentToOutputObject(
 		ULandscapeSplineSegment* InSegment,
 		const FLandscapeSplineCurveAttributes& InAttributes,
@@ -129,14 +142,20 @@ private:
 		int32 InCount,
 		TArray<FLandscapeSplineSegmentMeshAttributes>& OutAttributes);
 
-	static bool CopyCurveAttributesFromHoudini(
+	static bool CopyPointAttributesFromHoudini(
 		HAPI_NodeId InNodeId,
 		HAPI_PartId InPartId,
-		int32 InPrimIndex,
 		int32 InFirstPointIndex,
 		int32 InNumPoints,
 		FLandscapeSplineCurveAttributes& OutCurveAttributes);
 
+	static bool CopyPrimAttributesFromHoudini(
+		HAPI_NodeId InNodeId,
+		HAPI_PartId InPartId,
+		int32 InNumPrims,
+		const FLandscapeSplineCurveAttributes& InPointAttributes,
+		FLandscapeSplinePrimAttributes& OutPrimAttributes);
+
 	static bool UpdateControlPointFromAttributes(
 		ULandscapeSplineControlPoint* InPoint,
 		const FLandscapeSplineCurveAttributes& InAttributes,
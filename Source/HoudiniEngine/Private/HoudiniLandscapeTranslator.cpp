@@ -64,6 +64,14 @@ typedef FHoudiniEngineUtils FHUtils;
 
 HOUDINI_LANDSCAPE_DEFINE_LOG_CATEGORY();
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeRegionWrites(
+	TEXT("HoudiniEngine.LandscapeRegionWrites"),
+	1,
+	TEXT("When enabled, landscape outputs are compared with the existing layer data and only the modified regions are written.\n")
+	TEXT("0: Disabled, always write the whole layer\n")
+	TEXT("1: Enabled (Default)\n")
+);
+
 bool
 FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	UHoudiniOutput* InOutput,
@@ -87,7 +95,15 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	// Remove any layers from last cook.
 	//------------------------------------------------------------------------------------------------------------------------------
 
-	FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(InOutput);
+	// Temporary edit layers that are written to again by this cook are kept, so that only modified regions are rewritten.
+
+	FHoudiniReusedEditLayers ReusedLayers;
+	if (CVarHoudiniEngineLandscapeRegionWrites.GetValueOnAnyThread() != 0)
+		ReusedLayers = GetReusableEditLayers(InOutput, Parts, *HAC, InPackageParams);
+
+	TSet<FString> EditLayersToKeep;
+	ReusedLayers.Landscapes.GetKeys(EditLayersToKeep);
+	FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(InOutput, &EditLayersToKeep);
 
 	//------------------------------------------------------------------------------------------------------------------------------
 	// Resolve landscape Actors. This means we either find existing landscapes, if modifying landscapes, or create new landscapes
@@ -110,6 +126,7 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	//------------------------------------------------------------------------------------------------------------------------------
 
 	TArray<UHoudiniLandscapeTargetLayerOutput*> AllOutputs;
+	TSet<ALandscape*> LandscapesToUpdate;
 
 	for (FHoudiniHeightFieldPartData& Part : Parts)
 	{
@@ -121,7 +138,7 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 
 		int Index = LandscapeMapping.HoudiniLayerToUnrealLandscape[&Part];
 		FHoudiniUnrealLandscapeTarget& Landscape = LandscapeMapping.TargetLandscapes[Index];
-		UHoudiniLandscapeTargetLayerOutput* Result = TranslateHeightFieldPart(InOutput, Landscape, Part, *HAC, ClearedLayers, InPackageParams);
+		UHoudiniLandscapeTargetLayerOutput* Result = TranslateHeightFieldPart(InOutput, Landscape, Part, *HAC, ClearedLayers, InPackageParams, ReusedLayers, LandscapesToUpdate);
 		if (!Result)
 			continue;
 		AllOutputs.Add(Result);
@@ -145,6 +162,22 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 		OutputObj.CachedAttributes.Add(HAPI_UNREAL_ATTRIB_BAKE_OUTLINER_FOLDER, Part.BakeOutlinerFolder);
 	}
 
+	// ------------------------------------------------------------------------------------------------------------------
+	// Remove kept edit layers that were not written to, and update the modified landscapes once all layers are written.
+	// ------------------------------------------------------------------------------------------------------------------
+
+	for (auto& KeptLayer : ReusedLayers.Landscapes)
+	{
+		if (!ReusedLayers.UsedLayers.Contains(KeptLayer.Key) && KeptLayer.Value.IsValid())
+			FHoudiniLandscapeRuntimeUtils::DeleteEditLayer(KeptLayer.Value.Get(), FName(KeptLayer.Key));
+	}
+
+	for (ALandscape* Landscape : LandscapesToUpdate)
+	{
+		if (IsValid(Landscape))
+			Landscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All);
+	}
+
 
 	// ------------------------------------------------------------------------------------------------------------------
 	// Once done with processing parts, lock layers
@@ -573,6 +606,112 @@ TArray<FHoudiniHeightFieldPartData> FHoudiniLandscapeTranslator::GetPartsToTrans
 
 
 
+FString
+FHoudiniLandscapeTranslator::GetCookedEditLayerName(
+		const FHoudiniHeightFieldPartData& Part,
+		UHoudiniAssetComponent& HAC,
+		const FHoudiniPackageParams& InPackageParams)
+{
+	// For the cooked name, but the layer name first so it is easier to read in the Landscape Editor UI.
+	FString CookedLayerName = Part.UnrealLayerName;
+	if (HAC.bLandscapeUseTempLayers)
+	{
+		CookedLayerName = CookedLayerName + FString(" : ") + InPackageParams.GetPackageName() + HAC.GetComponentGUID().ToString();
+	}
+	return CookedLayerName;
+}
+
+TSet<FString>
+FHoudiniLandscapeTranslator::GetEditLayersToKeepBeforeCook(
+		UHoudiniOutput* InOutput,
+		const TArray<ALandscapeProxy*>& InAllInputLandscapes)
+{
+	TSet<FString> Result;
+	if (!IsValid(InOutput) || CVarHoudiniEngineLandscapeRegionWrites.GetValueOnAnyThread() == 0)
+		return Result;
+
+	for (auto& OutputObjectPair : InOutput->GetOutputObjects())
+	{
+		UHoudiniLandscapeTargetLayerOutput* OldLayer = Cast<UHoudiniLandscapeTargetLayerOutput>(OutputObjectPair.Value.OutputObject);
+		if (!IsValid(OldLayer) || !IsValid(OldLayer->Landscape) || OldLayer->bCreatedLandscape)
+			continue;
+
+		if (OldLayer->BakedEditLayer == OldLayer->CookedEditLayer)
+			continue;
+
+		const bool bIsInputLandscape = InAllInputLandscapes.ContainsByPredicate([&](ALandscapeProxy* InputLandscape)
+		{
+			return IsValid(InputLandscape) && InputLandscape->GetLandscapeActor() == OldLayer->Landscape;
+		});
+
+		if (!bIsInputLandscape)
+			Result.Add(OldLayer->CookedEditLayer);
+	}
+
+	return Result;
+}
+
+FHoudiniReusedEditLayers
+FHoudiniLandscapeTranslator::GetReusableEditLayers(
+		UHoudiniOutput* InOutput,
+		const TArray<FHoudiniHeightFieldPartData>& Parts,
+		UHoudiniAssetComponent& HAC,
+		const FHoudiniPackageParams& InPackageParams)
+{
+	FHoudiniReusedEditLayers Result;
+
+	// Number of parts writing to each edit layer / target layer in this cook.
+	TMap<FString, int> NewWrites;
+	for (const FHoudiniHeightFieldPartData& Part : Parts)
+	{
+		FString Key = FHoudiniReusedEditLayers::GetKey(GetCookedEditLayerName(Part, HAC, InPackageParams), Part.TargetLayerName);
+		NewWrites.FindOrAdd(Key)++;
+	}
+
+	// Gather the temporary edit layers written by the previous cook. Edit layers on landscapes created by the previous
+	// cook are never reused, since those landscapes are destroyed.
+	TSet<FString> RejectedLayers;
+	for (auto& OutputObjectPair : InOutput->GetOutputObjects())
+	{
+		UHoudiniLandscapeTargetLayerOutput* OldLayer = Cast<UHoudiniLandscapeTargetLayerOutput>(OutputObjectPair.Value.OutputObject);
+		if (!IsValid(OldLayer) || !IsValid(OldLayer->Landscape) || OldLayer->BakedEditLayer == OldLayer->CookedEditLayer)
+			continue;
+
+		if (OldLayer->bCreatedLandscape)
+		{
+			RejectedLayers.Add(OldLayer->CookedEditLayer);
+			continue;
+		}
+
+		TWeakObjectPtr<ALandscape>& LayerLandscape = Result.Landscapes.FindOrAdd(OldLayer->CookedEditLayer);
+		if (LayerLandscape.IsValid() && LayerLandscape.Get() != OldLayer->Landscape)
+			RejectedLayers.Add(OldLayer->CookedEditLayer);
+		LayerLandscape = OldLayer->Landscape;
+
+		FString Key = FHoudiniReusedEditLayers::GetKey(OldLayer->CookedEditLayer, OldLayer->TargetLayer);
+		Result.WrittenExtents.FindOrAdd(Key).Add(OldLayer->Extents);
+	}
+
+	// An edit layer can only be kept if every target layer it contains will be written to again, otherwise stale data
+	// would be left behind. Target layers written by several parts (tiles) are not handled: one of them may need to
+	// clear the target layer after the others have been written.
+	for (auto& Written : Result.WrittenExtents)
+	{
+		const int* NumNewWrites = NewWrites.Find(Written.Key);
+		if (!NumNewWrites || *NumNewWrites != 1 || Written.Value.Num() != 1)
+		{
+			FString EditLayer;
+			Written.Key.Split(TEXT("/"), &EditLayer, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+			RejectedLayers.Add(EditLayer);
+		}
+	}
+
+	for (const FString& EditLayer : RejectedLayers)
+		Result.Landscapes.Remove(EditLayer);
+
+	return Result;
+}
+
 UHoudiniLandscapeTargetLayerOutput*
 FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		UHoudiniOutput* OwningOutput,
@@ -580,8 +719,12 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		FHoudiniHeightFieldPartData& Part,
 		UHoudiniAssetComponent& HAC,
 		FHoudiniClearedEditLayers& ClearedLayers,
-		const FHoudiniPackageParams& InPackageParams)
+		const FHoudiniPackageParams& InPackageParams,
+		FHoudiniReusedEditLayers& ReusedLayers,
+		TSet<ALandscape*>& OutLandscapesToUpdate)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniLandscapeTranslator::TranslateHeightFieldPart);
+
 	enum TargetLayerType
 	{
 		Height, Visibility, Paint
@@ -612,15 +755,7 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 	// -----------------------------------------------------------------------------------------------------------------
 
 	FString BakedLayerName = Part.UnrealLayerName;
-
-	// For the cooked name, but the layer name first so it is easier to read in the Landscape Editor UI.
-	auto LayerPackageParams = InPackageParams;
-	FString CookedLayerName = BakedLayerName;
-
-	if (HAC.bLandscapeUseTempLayers)
-	{
-		CookedLayerName = CookedLayerName + FString(" : ") + LayerPackageParams.GetPackageName() + HAC.GetComponentGUID().ToString();
-	}	
+	FString CookedLayerName = GetCookedEditLayerName(Part, HAC, InPackageParams);
 
 	// ------------------------------------------------------------------------------------------------------------------
 	// Make sure the target layer exists before we do anything else. If its missing, we can't do anything
@@ -672,6 +807,13 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 	if (UnrealEditLayer != nullptr)
 		UnrealEditLayerIndex = OutputLandscape->GetLayerIndex(UnrealEditLayer->Name);
 
+	// A temporary edit layer kept from the previous cook already contains what we wrote to it last time, so it must not
+	// be cleared unless the region we write to has changed (checked once the extents are known).
+	const TWeakObjectPtr<ALandscape>* ReusedLandscape = ReusedLayers.Landscapes.Find(CookedLayerName);
+	const bool bIsReusedLayer = UnrealEditLayer != nullptr && ReusedLandscape && ReusedLandscape->Get() == OutputLandscape;
+	if (bIsReusedLayer)
+		ReusedLayers.UsedLayers.Add(CookedLayerName);
+
 	// ------------------------------------------------------------------------------------------------------------------
 	// Clear layer
 	// ------------------------------------------------------------------------------------------------------------------
@@ -685,6 +827,7 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 	if (UnrealEditLayer != nullptr && 
 		OutputLandscape->bHasLayersContent &&
 		Part.bClearLayer &&
+		!bIsReusedLayer &&
 		!ClearedLayers.Contains(CookedLayerName, Part.TargetLayerName))
 	{
 		if (LayerType != TargetLayerType::Paint)
@@ -745,6 +888,35 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 
 	auto Extents = FHoudiniLandscapeUtils::GetExtents(OutputLandscape, HeightFieldData);
 
+	// If this region was not written to the kept edit layer by the previous cook, clear the target layer so we don't
+	// leave stale data outside of it.
+	if (bIsReusedLayer)
+	{
+		TArray<FHoudiniExtents>* WrittenExtents = ReusedLayers.WrittenExtents.Find(FHoudiniReusedEditLayers::GetKey(CookedLayerName, Part.TargetLayerName));
+		const bool bSameExtents = WrittenExtents && WrittenExtents->ContainsByPredicate([&](const FHoudiniExtents& Written)
+		{
+			return Written.Min == Extents.Min && Written.Max == Extents.Max;
+		});
+
+		if (!bSameExtents && !ClearedLayers.Contains(CookedLayerName, Part.TargetLayerName))
+		{
+			if (LayerType == TargetLayerType::Height)
+				OutputLandscape->ClearLayer(UnrealEditLayer->Guid, nullptr, ELandscapeClearMode::Clear_Heightmap);
+			else if (LayerType == TargetLayerType::Visibility)
+				OutputLandscape->ClearPaintLayer(UnrealEditLayer->Guid, ALandscapeProxy::VisibilityLayer);
+			else if (TargetLayerInfo)
+				OutputLandscape->ClearPaintLayer(UnrealEditLayer->Guid, TargetLayerInfo);
+			ClearedLayers.Add(CookedLayerName, Part.TargetLayerName);
+		}
+	}
+
+	// Only write the regions that differ from the current layer data. Regions are computed per landscape component.
+	const bool bWriteDirtyRegionsOnly = UnrealEditLayer != nullptr && CVarHoudiniEngineLandscapeRegionWrites.GetValueOnAnyThread() != 0;
+	const int RegionSize = FMath::Max(OutputLandscape->ComponentSizeQuads, 1);
+	int XDiff = 1 + Extents.Max.X - Extents.Min.X;
+	int YDiff = 1 + Extents.Max.Y - Extents.Min.Y;
+	TArray<FIntRect> DirtyRegions;
+
 	// ------------------------------------------------------------------------------------------------------------------
 	// Is a paint layer or visibility layer
 	// ------------------------------------------------------------------------------------------------------------------
@@ -768,12 +940,10 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		if (OutputLandscape->bCanHaveLayersContent)
 			LayerGUID = UnrealEditLayer->Guid;
 
-		FScopedSetLandscapeEditingLayer Scope(OutputLandscape, LayerGUID, [&] { OutputLandscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All); });
+		ULandscapeLayerInfoObject* WrittenLayerInfo = LayerType == TargetLayerType::Visibility ? ALandscapeProxy::VisibilityLayer : TargetLayerInfo;
 
 		TArray<uint8> Values;
 		Values.SetNum(HeightFieldData.Values.Num());
-		int XDiff = 1 + Extents.Max.X - Extents.Min.X;
-		int YDiff = 1 + Extents.Max.Y - Extents.Min.Y;
 		int Dest = 0;
 		for (int Y = 0; Y < YDiff; Y++)
 		{
@@ -784,21 +954,32 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 			}
 		}
 
-		if (LayerType == TargetLayerType::Visibility)
+		if (bWriteDirtyRegionsOnly)
 		{
-			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), ALandscapeProxy::VisibilityLayer);
-			AlphaAccessor.SetData(
-				Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
-				Values.GetData(),
-				ELandscapeLayerPaintingRestriction::None);
+			TArray<uint8_t> CurrentValues = FHoudiniLandscapeUtils::GetLayerData(OutputLandscape, Extents, UnrealEditLayer, WrittenLayerInfo);
+			DirtyRegions = FHoudiniLandscapeUtils::GetDirtyRegions(CurrentValues, Values, XDiff, YDiff, RegionSize);
 		}
 		else
 		{
-			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), TargetLayerInfo);
-			AlphaAccessor.SetData(
-				Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
-				Values.GetData(),
-				ELandscapeLayerPaintingRestriction::None);
+			DirtyRegions.Add(FIntRect(0, 0, XDiff, YDiff));
+		}
+
+		if (DirtyRegions.Num() > 0)
+		{
+			FScopedSetLandscapeEditingLayer Scope(OutputLandscape, LayerGUID);
+
+			FAlphamapAccessor<false, false> AlphaAccessor(OutputLandscape->GetLandscapeInfo(), WrittenLayerInfo);
+			for (const FIntRect& Region : DirtyRegions)
+			{
+				TArray<uint8_t> RegionValues;
+				if (Region.Width() != XDiff || Region.Height() != YDiff)
+					RegionValues = FHoudiniLandscapeUtils::ExtractRegion(Values, XDiff, Region);
+
+				AlphaAccessor.SetData(
+					Extents.Min.X + Region.Min.X, Extents.Min.Y + Region.Min.Y, Extents.Min.X + Region.Max.X - 1, Extents.Min.Y + Region.Max.Y - 1,
+					RegionValues.Num() > 0 ? RegionValues.GetData() : Values.GetData(),
+					ELandscapeLayerPaintingRestriction::None);
+			}
 		}
 	}
 
@@ -827,14 +1008,46 @@ FHoudiniLandscapeTranslator::TranslateHeightFieldPart(
 		// Quantized to 16-bit and set the data.
 		auto QuantizedData = FHoudiniLandscapeUtils::QuantizeNormalizedDataTo16Bit(HeightFieldData.Values);
 
-		FScopedSetLandscapeEditingLayer Scope(OutputLandscape, UnrealEditLayer->Guid, [&] { OutputLandscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All); });
+		if (bWriteDirtyRegionsOnly)
+		{
+			TArray<uint16> CurrentValues = FHoudiniLandscapeUtils::GetHeightData(OutputLandscape, Extents, UnrealEditLayer);
+			DirtyRegions = FHoudiniLandscapeUtils::GetDirtyRegions(CurrentValues, QuantizedData, XDiff, YDiff, RegionSize);
+		}
+		else
+		{
+			DirtyRegions.Add(FIntRect(0, 0, XDiff, YDiff));
+		}
+
+		if (DirtyRegions.Num() > 0)
+		{
+			FScopedSetLandscapeEditingLayer Scope(OutputLandscape, UnrealEditLayer->Guid);
+
+			FHeightmapAccessor<false> HeightMapAccessor(TargetLandscapeInfo);
+			for (const FIntRect& Region : DirtyRegions)
+			{
+				TArray<uint16> RegionValues;
+				if (Region.Width() != XDiff || Region.Height() != YDiff)
+					RegionValues = FHoudiniLandscapeUtils::ExtractRegion(QuantizedData, XDiff, Region);
+
+				HeightMapAccessor.SetData(
+					Extents.Min.X + Region.Min.X, Extents.Min.Y + Region.Min.Y, Extents.Min.X + Region.Max.X - 1, Extents.Min.Y + Region.Max.Y - 1,
+					RegionValues.Num() > 0 ? RegionValues.GetData() : QuantizedData.GetData());
+			}
+		}
+	}
+
+	// The landscape content is updated once all the parts are written, see ProcessLandscapeOutput().
+	if (DirtyRegions.Num() > 0)
+		OutLandscapesToUpdate.Add(OutputLandscape);
 
-		FLandscapeEditDataInterface LandscapeEdit(TargetLandscapeInfo);
-		FHeightmapAccessor<false> HeightMapAccessor(TargetLandscapeInfo);
-		HeightMapAccessor.SetData(
-			Extents.Min.X, Extents.Min.Y, Extents.Max.X, Extents.Max.Y,
-			QuantizedData.GetData());
+	if (bWriteDirtyRegionsOnly)
+	{
+		int64 NumDirtySamples = 0;
+		for (const FIntRect& Region : DirtyRegions)
+			NumDirtySamples += Region.Area();
 
+		HOUDINI_LANDSCAPE_MESSAGE(TEXT("Layer %s / %s: wrote %lld of %d samples in %d regions."),
+			*CookedLayerName, *Part.TargetLayerName, NumDirtySamples, XDiff * YDiff, DirtyRegions.Num());
 	}
 
 	if (bWasLocked && UnrealEditLayer)
@@ -49,6 +49,22 @@ struct FHoudiniLandscapeCreationInfo
 	int WorldPartitionGridSize = 4;
 };
 
+// Temporary edit layers kept from the previous cook of an output, so that only the regions that changed need to be
+// rewritten.
+struct FHoudiniReusedEditLayers
+{
+	// Name of the kept edit layers, and the landscape they are on.
+	TMap<FString, TWeakObjectPtr<ALandscape>> Landscapes;
+
+	// Extents written during the previous cook, per edit layer / target layer key.
+	TMap<FString, TArray<FHoudiniExtents>> WrittenExtents;
+
+	// Edit layers that were written to again during this cook.
+	TSet<FString> UsedLayers;
+
+	static FString GetKey(const FString& EditLayer, const FString& TargetLayer) { return EditLayer + TEXT("/") + TargetLayer; }
+};
+
 struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 {
 	static TArray<FHoudiniHeightFieldPartData> GetPartsToTranslate(UHoudiniOutput* InOutput);
@@ -63,6 +79,13 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 		FHoudiniClearedEditLayers & ClearedLayers,
 		TArray<UPackage*>& OutCreatedPackages);
 
+	// Returns the temporary edit layers of the output that may be rewritten by the next cook, and so should not be
+	// deleted before cooking. Edit layers on landscapes that are sent back to the HDA as inputs are never kept, so that
+	// Houdini doesn't receive the cooked data.
+	static TSet<FString> GetEditLayersToKeepBeforeCook(
+		UHoudiniOutput* InOutput,
+		const TArray<ALandscapeProxy*>& InAllInputLandscapes);
+
 	static const FHoudiniGeoPartObject* GetHoudiniHeightFieldFromOutput(
 		UHoudiniOutput* InOutput,
 		const bool bMatchEditLayer,
@@ -77,13 +100,23 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 
 private:
 
+	static FString GetCookedEditLayerName(const FHoudiniHeightFieldPartData& Part, UHoudiniAssetComponent& HAC, const FHoudiniPackageParams& InPackageParams);
+
+	static FHoudiniReusedEditLayers GetReusableEditLayers(
+			UHoudiniOutput* InOutput,
+			const TArray<FHoudiniHeightFieldPartData>& Parts,
+			UHoudiniAssetComponent& HAC,
+			const FHoudiniPackageParams& InPackageParams);
+
 	static UHoudiniLandscapeTargetLayerOutput* TranslateHeightFieldPart(
 			UHoudiniOutput* OwningOutput,
 			FHoudiniUnrealLandscapeTarget& Landscape,
 			FHoudiniHeightFieldPartData& Part,
 			UHoudiniAssetComponent& HAC,
 			FHoudiniClearedEditLayers& ClearedLayers,
-			const FHoudiniPackageParams& InPackageParams);
+			const FHoudiniPackageParams& InPackageParams,
+			FHoudiniReusedEditLayers& ReusedLayers,
+			TSet<ALandscape*>& OutLandscapesToUpdate);
 };
 
 
@@ -244,12 +244,21 @@ TArray<uint8_t> FHoudiniLandscapeUtils::GetLayerData(ALandscape* Landscape, cons
 	int DiffY = 1 + Extents.Max.Y - Extents.Min.Y;
 	int NumPoints = DiffX * DiffY;
 
-	TArray<uint8_t> Values;
-	Values.SetNum(NumPoints);
-
 	FLandscapeLayer* EditLayer = FHoudiniLandscapeUtils::GetEditLayer(Landscape, EditLayerName);
 	ULandscapeLayerInfoObject* TargetLayerInfo = Landscape->GetLandscapeInfo()->GetLayerInfoByName(TargetLayerName);
 
+	return GetLayerData(Landscape, Extents, EditLayer, TargetLayerInfo);
+}
+
+TArray<uint8_t> FHoudiniLandscapeUtils::GetLayerData(ALandscape* Landscape, const FHoudiniExtents& Extents, FLandscapeLayer* EditLayer, ULandscapeLayerInfoObject* TargetLayerInfo)
+{
+	int DiffX = 1 + Extents.Max.X - Extents.Min.X;
+	int DiffY = 1 + Extents.Max.Y - Extents.Min.Y;
+	int NumPoints = DiffX * DiffY;
+
+	TArray<uint8_t> Values;
+	Values.SetNum(NumPoints);
+
 	FScopedSetLandscapeEditingLayer Scope(Landscape, EditLayer->Guid, [&] { /*Landscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All); */});
 
 	FLandscapeEditDataInterface LandscapeEdit(Landscape->GetLandscapeInfo());
@@ -259,6 +268,127 @@ TArray<uint8_t> FHoudiniLandscapeUtils::GetLayerData(ALandscape* Landscape, cons
 	return Values;
 }
 
+template<typename T>
+static TArray<FIntRect> GetDirtyRegionsImpl(const TArray<T>& OldData, const TArray<T>& NewData, int SizeX, int SizeY, int TileSize)
+{
+	TArray<FIntRect> Regions;
+	if (SizeX <= 0 || SizeY <= 0)
+		return Regions;
+
+	if (OldData.Num() != SizeX * SizeY || NewData.Num() != SizeX * SizeY || TileSize <= 0)
+	{
+		// Can't compare, so everything is dirty.
+		Regions.Add(FIntRect(0, 0, SizeX, SizeY));
+		return Regions;
+	}
+
+	// Flag the dirty tiles, comparing one tile-wide row segment at a time.
+	const int NumTilesX = FMath::DivideAndRoundUp(SizeX, TileSize);
+	const int NumTilesY = FMath::DivideAndRoundUp(SizeY, TileSize);
+	TArray<bool> DirtyTiles;
+	DirtyTiles.SetNumZeroed(NumTilesX * NumTilesY);
+
+	for (int Y = 0; Y < SizeY; Y++)
+	{
+		const int TileY = Y / TileSize;
+		const int RowStart = Y * SizeX;
+		for (int TileX = 0; TileX < NumTilesX; TileX++)
+		{
+			bool& bDirty = DirtyTiles[TileY * NumTilesX + TileX];
+			if (bDirty)
+				continue;
+
+			const int StartX = TileX * TileSize;
+			const int Count = FMath::Min(TileSize, SizeX - StartX);
+			if (FMemory::Memcmp(&OldData[RowStart + StartX], &NewData[RowStart + StartX], Count * sizeof(T)) != 0)
+				bDirty = true;
+		}
+	}
+
+	// Merge runs of dirty tiles on each tile row, then extend regions downwards when the next row has the same run.
+	TArray<int> OpenRegions;
+	for (int TileY = 0; TileY < NumTilesY; TileY++)
+	{
+		TArray<int> RowRegions;
+		int TileX = 0;
+		while (TileX < NumTilesX)
+		{
+			if (!DirtyTiles[TileY * NumTilesX + TileX])
+			{
+				TileX++;
+				continue;
+			}
+
+			const int RunStart = TileX;
+			while (TileX < NumTilesX && DirtyTiles[TileY * NumTilesX + TileX])
+				TileX++;
+
+			int* Extended = OpenRegions.FindByPredicate([&](int Index)
+			{
+				return Regions[Index].Min.X == RunStart && Regions[Index].Max.X == TileX;
+			});
+
+			if (Extended)
+			{
+				Regions[*Extended].Max.Y = TileY + 1;
+				RowRegions.Add(*Extended);
+			}
+			else
+			{
+				RowRegions.Add(Regions.Add(FIntRect(RunStart, TileY, TileX, TileY + 1)));
+			}
+		}
+		OpenRegions = MoveTemp(RowRegions);
+	}
+
+	// Tiles to samples.
+	for (FIntRect& Region : Regions)
+	{
+		Region.Min *= TileSize;
+		Region.Max.X = FMath::Min(Region.Max.X * TileSize, SizeX);
+		Region.Max.Y = FMath::Min(Region.Max.Y * TileSize, SizeY);
+	}
+
+	return Regions;
+}
+
+template<typename T>
+static TArray<T> ExtractRegionImpl(const TArray<T>& Data, int SizeX, const FIntRect& Region)
+{
+	const int Width = Region.Width();
+	TArray<T> Values;
+	Values.SetNumUninitialized(Width * Region.Height());
+
+	int Dest = 0;
+	for (int Y = Region.Min.Y; Y < Region.Max.Y; Y++)
+	{
+		FMemory::Memcpy(&Values[Dest], &Data[Y * SizeX + Region.Min.X], Width * sizeof(T));
+		Dest += Width;
+	}
+
+	return Values;
+}
+
+TArray<FIntRect> FHoudiniLandscapeUtils::GetDirtyRegions(const TArray<uint16>& OldData, const TArray<uint16>& NewData, int SizeX, int SizeY, int TileSize)
+{
+	return GetDirtyRegionsImpl(OldData, NewData, SizeX, SizeY, TileSize);
+}
+
+TArray<FIntRect> FHoudiniLandscapeUtils::GetDirtyRegions(const TArray<uint8_t>& OldData, const TArray<uint8_t>& NewData, int SizeX, int SizeY, int TileSize)
+{
+	return GetDirtyRegionsImpl(OldData, NewData, SizeX, SizeY, TileSize);
+}
+
+TArray<uint16> FHoudiniLandscapeUtils::ExtractRegion(const TArray<uint16>& Data, int SizeX, const FIntRect& Region)
+{
+	return ExtractRegionImpl(Data, SizeX, Region);
+}
+
+TArray<uint8_t> FHoudiniLandscapeUtils::ExtractRegion(const TArray<uint8_t>& Data, int SizeX, const FIntRect& Region)
+{
+	return ExtractRegionImpl(Data, SizeX, Region);
+}
+
 
 bool
 FHoudiniLandscapeUtils::CalcLandscapeSizeFromHeightFieldSize(
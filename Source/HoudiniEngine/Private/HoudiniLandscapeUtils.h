@@ -247,6 +247,19 @@ struct HOUDINIENGINE_API FHoudiniLandscapeUtils
 
 	static TArray<uint8_t> GetLayerData(ALandscape* Landscape, const FHoudiniExtents& Extents, const FName& EditLayerName, const FName& TargetLayerName);
 
+	// Same as above, but takes the edit layer and target layer info directly (eg. for the visibility layer).
+	static TArray<uint8_t> GetLayerData(ALandscape* Landscape, const FHoudiniExtents& Extents, FLandscapeLayer* EditLayer, ULandscapeLayerInfoObject* TargetLayerInfo);
+
+	// Compares two row-major SizeX * SizeY data sets in tiles of TileSize samples, and returns the regions (relative to
+	// the start of the data, Max exclusive) containing changes. Adjacent dirty tiles are merged. Returns an empty array if
+	// nothing has changed, or the whole region if the data sets cannot be compared.
+	static TArray<FIntRect> GetDirtyRegions(const TArray<uint16>& OldData, const TArray<uint16>& NewData, int SizeX, int SizeY, int TileSize);
+	static TArray<FIntRect> GetDirtyRegions(const TArray<uint8_t>& OldData, const TArray<uint8_t>& NewData, int SizeX, int SizeY, int TileSize);
+
+	// Copies Region out of the row-major data set of width SizeX.
+	static TArray<uint16> ExtractRegion(const TArray<uint16>& Data, int SizeX, const FIntRect& Region);
+	static TArray<uint8_t> ExtractRegion(const TArray<uint8_t>& Data, int SizeX, const FIntRect& Region);
+
     static FHoudiniLayersToUnrealLandscapeMapping ResolveLandscapes(const FString & CookedLandscapePrefix, 
 			const FHoudiniPackageParams& PackageParams, 
             UHoudiniAssetComponent* HAC, 
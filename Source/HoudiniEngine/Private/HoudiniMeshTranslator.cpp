@@ -5851,6 +5851,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				*FoundStaticMesh->GetName());
 		}
 
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bQuantizeProxyStaticMeshes)
+			FoundStaticMesh->Quantize();
+
 		//// Try to find the outer package so we can dirty it up
 		//if (FoundStaticMesh->GetOuter())
 		//{
@@ -9431,6 +9435,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMeshFromSplitGroups(const FString& Me
 			*FoundStaticMesh->GetName());
 	}
 
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bQuantizeProxyStaticMeshes)
+		FoundStaticMesh->Quantize();
+
 	//// Try to find the outer package so we can dirty it up
 	//if (FoundStaticMesh->GetOuter())
 	//{
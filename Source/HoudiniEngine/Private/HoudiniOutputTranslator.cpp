@@ -36,6 +36,7 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniHapiInfoCache.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniAssetComponent.h"
@@ -50,6 +51,7 @@
 #include "HoudiniSplineTranslator.h"
 #include "HoudiniLandscapeTranslator.h"
 #include "HoudiniLandscapeSplineTranslator.h"
+#include "HoudiniLandscapeRuntimeUtils.h"
 #include "HoudiniInstanceTranslator.h"
 #include "HoudiniGeometryCollectionTranslator.h"
 
@@ -91,6 +93,10 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	if (!IsValid(HAC))
 		return false;
 
+	// The same geo/part/attribute infos are queried many times while building and translating the outputs,
+	// cache them for the duration of the update.
+	FHoudiniScopedHapiInfoCache HapiInfoCache;
+
 	// Outputs that should be cleared, but only AFTER new output processing have taken place.
 	// This is needed for landscape resizing where the new landscape needs to copy data from the original landscape
 	// before the original landscape gets destroyed.
@@ -812,9 +818,8 @@ FHoudiniOutputTranslator::UpdateLoadedOutputs(UHoudiniAssetComponent* HAC)
 			{
 				HAPI_GeoInfo CurrentEditableGeoInfo;
 				FHoudiniApi::GeoInfo_Init(&CurrentEditableGeoInfo);
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-					FHoudiniEngine::Get().GetSession(),
-					EditableNodeIds[nEditable], &CurrentEditableGeoInfo));
+				HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
+					EditableNodeIds[nEditable], CurrentEditableGeoInfo));
 
 				// Do not process the main display geo twice!
 				if (CurrentEditableGeoInfo.isDisplayGeo)
@@ -847,10 +852,9 @@ FHoudiniOutputTranslator::UpdateLoadedOutputs(UHoudiniAssetComponent* HAC)
 					//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentEditableGeoInfo.nodeId, &CookOptions);
 					FHoudiniEngineUtils::HapiCookNode(CurrentEditableGeoInfo.nodeId, nullptr, true);
 
-					HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-						FHoudiniEngine::Get().GetSession(),
+					HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
 						CurrentEditableGeoInfo.nodeId,
-						&CurrentEditableGeoInfo));
+						CurrentEditableGeoInfo));
 				}
 
 				// Iterate on this geo's parts
@@ -860,8 +864,7 @@ FHoudiniOutputTranslator::UpdateLoadedOutputs(UHoudiniAssetComponent* HAC)
 					HAPI_PartInfo CurrentHapiPartInfo;
 					FHoudiniApi::PartInfo_Init(&CurrentHapiPartInfo);
 
-					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
-						FHoudiniEngine::Get().GetSession(), CurrentEditableGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+					if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetPartInfo(CurrentEditableGeoInfo.nodeId, PartId, CurrentHapiPartInfo))
 						continue;
 
 					// A closed curve will be returned as a mesh in HAPI
@@ -1132,9 +1135,8 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 		{
 			HAPI_GeoInfo CurrentEditableGeoInfo;
 			FHoudiniApi::GeoInfo_Init(&CurrentEditableGeoInfo);
-			HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-				FHoudiniEngine::Get().GetSession(), 
-				EditableNodeIds[nEditable], &CurrentEditableGeoInfo));
+			HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
+				EditableNodeIds[nEditable], CurrentEditableGeoInfo));
 
 			// TODO: Check whether this display geo is actually being output
 			//       Just because this is a display node doesn't mean that it will be output (it
@@ -1356,10 +1358,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			{
 				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-					FHoudiniEngine::Get().GetSession(),
+				HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
 					CurrentHapiGeoInfo.nodeId,
-					&GeoInfos[GeoIdx]));
+					GeoInfos[GeoIdx]));
 			}
 
 			// Cache/convert the display geo's info
@@ -1410,8 +1411,7 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				}
 
 				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
-					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+				if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetPartInfo(CurrentHapiGeoInfo.nodeId, PartId, CurrentHapiPartInfo))
 				{
 					bPartInfoFailed = true;
 
@@ -1422,13 +1422,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
 						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 
-						HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-							FHoudiniEngine::Get().GetSession(),
+						HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
 							CurrentHapiGeoInfo.nodeId,
-							&GeoInfos[GeoIdx]));
+							GeoInfos[GeoIdx]));
 
-						if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
-							FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+						if (HAPI_RESULT_SUCCESS == FHoudiniEngineUtils::HapiGetPartInfo(CurrentHapiGeoInfo.nodeId, PartId, CurrentHapiPartInfo))
 						{
 							// We managed to get the templated part infos after cooking
 							bPartInfoFailed = false;
@@ -1500,8 +1498,7 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				}
 
 				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
-					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+				if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiGetPartInfo(CurrentHapiGeoInfo.nodeId, PartId, CurrentHapiPartInfo))
 				{
 					bPartInfoFailed = true;
 
@@ -1512,13 +1509,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
 						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 
-						HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-							FHoudiniEngine::Get().GetSession(),
+						HOUDINI_CHECK_ERROR(FHoudiniEngineUtils::HapiGetGeoInfo(
 							CurrentHapiGeoInfo.nodeId,
-							&GeoInfos[GeoIdx]));
+							GeoInfos[GeoIdx]));
 
-						if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
-							FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+						if (HAPI_RESULT_SUCCESS == FHoudiniEngineUtils::HapiGetPartInfo(CurrentHapiGeoInfo.nodeId, PartId, CurrentHapiPartInfo))
 						{
 							// We managed to get the templated part infos after cooking
 							bPartInfoFailed = false;
@@ -2542,6 +2537,9 @@ FHoudiniOutputTranslator::ClearOutput(UHoudiniOutput* Output)
 	{
 		case EHoudiniOutputType::Landscape:
 		{
+			// Temporary edit layers may have been kept before the cook, remove them.
+			FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(Output);
+
 			for (auto& OutputObject : Output->GetOutputObjects())
 			{
 				// Currently, any Landscape managed by an HDA is always present in the current level.
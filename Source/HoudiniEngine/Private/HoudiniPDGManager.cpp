@@ -52,6 +52,65 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGImportTimeBudget(
+	TEXT("HoudiniEngine.PDGImportTimeBudget"),
+	0.05f,
+	TEXT("Time (in seconds) that can be spent importing PDG work item results on each tick. Remaining results are imported on the next ticks.\n")
+	TEXT("<= 0: No limit\n")
+	TEXT("0.05: Default\n"));
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGImportMemoryBudget(
+	TEXT("HoudiniEngine.PDGImportMemoryBudget"),
+	256,
+	TEXT("Total size (in MB) of the PDG work item result files that can be imported on each tick.\n")
+	TEXT("<= 0: No limit\n")
+	TEXT("256: Default\n"));
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGMaxCommandletImports(
+	TEXT("HoudiniEngine.PDGMaxCommandletImports"),
+	32,
+	TEXT("Maximum number of PDG work item results sent to the BGEO commandlet that can be waiting for their import to complete.\n")
+	TEXT("<= 0: No limit\n")
+	TEXT("32: Default\n"));
+
+FHoudiniPDGImportBudget::FHoudiniPDGImportBudget(const double& InTimeLimit, const int64& InMaxBytes, const int32& InMaxInFlight, const int32& InNumInFlight)
+	: StartTime(FPlatformTime::Seconds())
+	, TimeLimit(InTimeLimit)
+	, MaxBytes(InMaxBytes)
+	, MaxInFlight(InMaxInFlight)
+	, NumInFlight(InNumInFlight)
+{
+}
+
+bool
+FHoudiniPDGImportBudget::CanStartImport() const
+{
+	// Back-pressure: wait for the commandlet to catch up
+	if (MaxInFlight > 0 && NumInFlight >= MaxInFlight)
+		return false;
+
+	// Always allow one import per tick
+	if (NumImports <= 0)
+		return true;
+
+	if (MaxBytes > 0 && NumBytes >= MaxBytes)
+		return false;
+
+	if (TimeLimit > 0.0 && (FPlatformTime::Seconds() - StartTime) >= TimeLimit)
+		return false;
+
+	return true;
+}
+
+void
+FHoudiniPDGImportBudget::AddImport(const int64& InBytes, const bool& bInAsync)
+{
+	NumImports++;
+	NumBytes += FMath::Max<int64>(InBytes, 0);
+	if (bInAsync)
+		NumInFlight++;
+}
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -1668,6 +1727,31 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
 	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
+	const bool bUseCommandlet = CommandletStatus == EHoudiniBGEOCommandletStatus::Connected;
+	if (!bUseCommandlet)
+	{
+		// We won't receive results for imports sent to a commandlet that isn't connected anymore
+		NumCommandletImportsInFlight = 0;
+	}
+
+	ImportWorkItemResults(bUseCommandlet, [this](FHoudiniPDGImportBGEOMessage* InMessage)
+	{
+		BGEOCommandletEndpoint->Send(InMessage, BGEOCommandletAddress);
+	});
+}
+
+void
+FHoudiniPDGManager::ImportWorkItemResults(
+	const bool bUseCommandlet,
+	TFunctionRef<void(FHoudiniPDGImportBGEOMessage*)> InSendToCommandlet)
+{
+	// Only import as many results as the budget allows on this tick, the others will be imported on the next ticks
+	FHoudiniPDGImportBudget ImportBudget(
+		CVarHoudiniEnginePDGImportTimeBudget.GetValueOnAnyThread(),
+		static_cast<int64>(CVarHoudiniEnginePDGImportMemoryBudget.GetValueOnAnyThread()) * 1024 * 1024,
+		bUseCommandlet ? CVarHoudiniEnginePDGMaxCommandletImports.GetValueOnAnyThread() : 0,
+		NumCommandletImportsInFlight);
+
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
 		// Iterate through all PDG Asset Link
@@ -1753,6 +1837,11 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 						FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
 						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
 						{
+							// Defer the import if we've used this tick's budget
+							if (!ImportBudget.CanStartImport())
+								continue;
+
+							ImportBudget.AddImport(IFileManager::Get().FileSize(*CurrentWorkResultObj.FilePath), bUseCommandlet);
 							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
 
 							// Load this WRObj
@@ -1763,9 +1852,10 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 							// CurrentWorkResult.WorkItemIndex is not necessarily unique)
 							PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
 
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							if (bUseCommandlet)
 							{
-								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
+								NumCommandletImportsInFlight++;
+								InSendToCommandlet(new FHoudiniPDGImportBGEOMessage(
 									CurrentWorkResultObj.FilePath,
 									CurrentWorkResultObj.Name,
 									PackageParams,
@@ -1773,7 +1863,7 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 									CurrentWorkResult.WorkItemID,
 									StaticMeshGenerationProperties,
 									MeshBuildSettings
-								), BGEOCommandletAddress);
+								));
 							}
 							else
 							{
@@ -1855,8 +1945,15 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const FHoudiniPDGImportBGEOResultMessage& InMessage, 
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
+{
+	HandleImportBGEOResult(InMessage);
+}
+
+void FHoudiniPDGManager::HandleImportBGEOResult(const FHoudiniPDGImportBGEOResultMessage& InMessage)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+	NumCommandletImportsInFlight = FMath::Max(NumCommandletImportsInFlight - 1, 0);
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
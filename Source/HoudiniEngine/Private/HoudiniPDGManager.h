@@ -55,8 +55,42 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// Limits the number and size of the work item results imported on a single tick.
+// Results that don't fit in the budget stay in the ToLoad state and are imported on a later tick.
+struct HOUDINIENGINE_API FHoudiniPDGImportBudget
+{
+public:
+
+	// InTimeLimit (seconds) and InMaxBytes apply to the current tick, InMaxInFlight to the imports sent 
+	// to the commandlet that haven't completed yet. Values <= 0 mean no limit.
+	FHoudiniPDGImportBudget(const double& InTimeLimit, const int64& InMaxBytes, const int32& InMaxInFlight, const int32& InNumInFlight);
+
+	// Returns true if another result can be imported on this tick.
+	// The first import of each tick ignores the time and size limits so that results keep coming in.
+	bool CanStartImport() const;
+
+	// Records an import started on this tick, with the size of the result's file
+	void AddImport(const int64& InBytes, const bool& bInAsync);
+
+	int32 GetNumImports() const { return NumImports; }
+	int64 GetNumBytes() const { return NumBytes; }
+	int32 GetNumInFlight() const { return NumInFlight; }
+
+private:
+
+	double StartTime = 0.0;
+	double TimeLimit = 0.0;
+	int64 MaxBytes = 0;
+	int32 MaxInFlight = 0;
+	int32 NumInFlight = 0;
+	int32 NumImports = 0;
+	int64 NumBytes = 0;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
+	// Drives the work item result imports with stand-in work items and commandlet
+	friend class HoudiniCoreTest_PDGImportBudget;
 
 public:
 
@@ -167,6 +201,16 @@ private:
 
 	void ProcessWorkItemResults();
 
+	// Imports the work item results in the ToLoad state, within this tick's import budget. If bUseCommandlet is true,
+	// the import messages are passed to InSendToCommandlet (which takes ownership of them), otherwise the results are
+	// imported directly.
+	void ImportWorkItemResults(
+		const bool bUseCommandlet,
+		TFunctionRef<void(struct FHoudiniPDGImportBGEOMessage*)> InSendToCommandlet);
+
+	// Creates the outputs of a work item result imported by the commandlet.
+	void HandleImportBGEOResult(const struct FHoudiniPDGImportBGEOResultMessage& InMessage);
+
 	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
@@ -204,6 +248,9 @@ private:
 
 	int32 MaxNumberOfPDGEvents = 20;
 
+	// Number of imports sent to the BGEO commandlet that we haven't received a result for yet
+	int32 NumCommandletImportsInFlight = 0;
+
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
 	FMessageAddress BGEOCommandletAddress;
 	FProcHandle BGEOCommandletProcHandle;
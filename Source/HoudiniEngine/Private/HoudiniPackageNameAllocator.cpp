@@ -0,0 +1,178 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPackageNameAllocator.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+FHoudiniPackageNameAllocator::~FHoudiniPackageNameAllocator()
+{
+	Reset();
+}
+
+bool
+FHoudiniPackageNameAllocator::IsReady() const
+{
+	FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	if (!AssetRegistryModule)
+		return false;
+
+	// In commandlets, folders are scanned synchronously when first used.
+	return IsRunningCommandlet() || !AssetRegistryModule->Get().IsLoadingAssets();
+}
+
+bool
+FHoudiniPackageNameAllocator::IsPackageNameInUse(const FString& InPackageName)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	const FFolderPackageNames& Folder = FindOrAddFolder(FPackageName::GetLongPackagePath(InPackageName));
+	return Folder.PackageNames.Contains(FPackageName::GetShortName(InPackageName));
+}
+
+int32
+FHoudiniPackageNameAllocator::GetNextBakeCounter(const FString& InBasePackageName, int32 InBakeCounter)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	const FFolderPackageNames& Folder = FindOrAddFolder(FPackageName::GetLongPackagePath(InBasePackageName));
+	const int32* MaxBakeCounter = Folder.MaxBakeCounters.Find(FPackageName::GetShortName(InBasePackageName));
+	if (!MaxBakeCounter)
+		return InBakeCounter + 1;
+
+	return FMath::Max(InBakeCounter, *MaxBakeCounter) + 1;
+}
+
+void
+FHoudiniPackageNameAllocator::AddPackageName(const FString& InPackageName, int32 InBakeCounter)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	FFolderPackageNames& Folder = FindOrAddFolder(FPackageName::GetLongPackagePath(InPackageName));
+	const FString ShortName = FPackageName::GetShortName(InPackageName);
+	Folder.PackageNames.Add(ShortName);
+
+	// Record the bake counter
+	FString BaseName;
+	if (InBakeCounter <= 0 || !ShortName.Split(TEXT("_"), &BaseName, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		return;
+
+	int32& MaxBakeCounter = Folder.MaxBakeCounters.FindOrAdd(BaseName, 0);
+	MaxBakeCounter = FMath::Max(MaxBakeCounter, InBakeCounter);
+}
+
+void
+FHoudiniPackageNameAllocator::RemoveFolder(const FString& InFolder)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	Folders.Remove(InFolder);
+}
+
+void
+FHoudiniPackageNameAllocator::Reset()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	Folders.Empty();
+
+	FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	if (AssetRegistryModule)
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+	}
+
+	OnAssetAddedHandle.Reset();
+	OnAssetRemovedHandle.Reset();
+	OnAssetRenamedHandle.Reset();
+}
+
+FHoudiniPackageNameAllocator::FFolderPackageNames&
+FHoudiniPackageNameAllocator::FindOrAddFolder(const FString& InFolder)
+{
+	if (FFolderPackageNames* Folder = Folders.Find(InFolder))
+		return *Folder;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPackageNameAllocator::FindOrAddFolder);
+
+	// Don't keep the names of every folder used during the editor session, forgotten folders are simply gathered again.
+	if (Folders.Num() >= MaxFolders)
+		Folders.Empty();
+
+	FFolderPackageNames& Folder = Folders.Add(InFolder);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (!OnAssetAddedHandle.IsValid())
+	{
+		OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetAdded);
+		OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetRemoved);
+		OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetRenamed);
+	}
+
+	// The registry's background search is not run in commandlets, so scan the folder ourselves.
+	if (IsRunningCommandlet())
+		AssetRegistry.ScanPathsSynchronous({ InFolder });
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPath(FName(*InFolder), Assets, false);
+	for (const FAssetData& Asset : Assets)
+		Folder.PackageNames.Add(FPackageName::GetShortName(Asset.PackageName));
+
+	return Folder;
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetAdded(const FAssetData& InAssetData)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	if (FFolderPackageNames* Folder = Folders.Find(InAssetData.PackagePath.ToString()))
+		Folder->PackageNames.Add(FPackageName::GetShortName(InAssetData.PackageName));
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	// Bake counters are not lowered: the counter of a removed package is simply not reused.
+	FScopeLock ScopeLock(&CriticalSection);
+	if (FFolderPackageNames* Folder = Folders.Find(InAssetData.PackagePath.ToString()))
+		Folder->PackageNames.Remove(FPackageName::GetShortName(InAssetData.PackageName));
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const FString OldPackageName = FPackageName::ObjectPathToPackageName(InOldObjectPath);
+	if (FFolderPackageNames* OldFolder = Folders.Find(FPackageName::GetLongPackagePath(OldPackageName)))
+		OldFolder->PackageNames.Remove(FPackageName::GetShortName(OldPackageName));
+
+	if (FFolderPackageNames* Folder = Folders.Find(InAssetData.PackagePath.ToString()))
+		Folder->PackageNames.Add(FPackageName::GetShortName(InAssetData.PackageName));
+}
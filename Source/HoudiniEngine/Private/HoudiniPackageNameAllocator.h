@@ -0,0 +1,93 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+// Keeps track of the package names used in the content folders the plugin creates packages in, so that a free package
+// name (bake counter or temp GUID suffix) can be found without probing the disk for each candidate.
+// Each folder is gathered once from the asset registry, and is then kept up to date with the packages created by the
+// plugin and the asset registry's notifications.
+class HOUDINIENGINE_API FHoudiniPackageNameAllocator
+{
+public:
+
+	~FHoudiniPackageNameAllocator();
+
+	// Returns false if the allocator cannot be used yet (the asset registry is still discovering assets).
+	bool IsReady() const;
+
+	// Returns true if the (sanitized) long package name is used by a known package.
+	bool IsPackageNameInUse(const FString& InPackageName);
+
+	// Returns the next bake counter to try for InBasePackageName (the long package name without bake counter suffix)
+	// after InBakeCounter, skipping all the counters already known to be used for it in the folder.
+	int32 GetNextBakeCounter(const FString& InBasePackageName, int32 InBakeCounter);
+
+	// Records a package name as used. InBakeCounter is the bake counter suffix the name was created with, or 0 if
+	// the name has no bake counter. Only the counters given here are used by GetNextBakeCounter: the suffix of a
+	// name found in the asset registry can't be told apart from a temp GUID made of digits.
+	void AddPackageName(const FString& InPackageName, int32 InBakeCounter);
+
+	// Forgets the names gathered for a folder, they are gathered again the next time the folder is used.
+	void RemoveFolder(const FString& InFolder);
+
+	// Forgets all gathered folders and stops listening to the asset registry.
+	void Reset();
+
+private:
+
+	struct FFolderPackageNames
+	{
+		// Short names of the packages in the folder.
+		TSet<FString> PackageNames;
+		// Highest bake counter given to AddPackageName per short name (without the bake counter suffix).
+		TMap<FString, int32> MaxBakeCounters;
+	};
+
+	// Returns the names for a folder, gathering them from the asset registry the first time. Requires the lock.
+	FFolderPackageNames& FindOrAddFolder(const FString& InFolder);
+
+	// Maximum number of folders kept, all gathered folders are forgotten when it is reached.
+	static constexpr int32 MaxFolders = 64;
+
+	// Asset registry notifications
+	void OnAssetAdded(const FAssetData& InAssetData);
+	void OnAssetRemoved(const FAssetData& InAssetData);
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	// Gathered folders, by package path.
+	TMap<FString, FFolderPackageNames> Folders;
+
+	FCriticalSection CriticalSection;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+};
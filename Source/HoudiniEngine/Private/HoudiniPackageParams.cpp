@@ -26,6 +26,7 @@
 
 #include "HoudiniPackageParams.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngine.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniStaticMesh.h"
@@ -301,6 +302,12 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	// Get the appropriate package path/name for this object
 	FString PackageName = GetPackageName();
 	FString PackagePath = GetPackagePath();
+
+	// When creating new assets, use the name allocator to skip the names already in use instead of probing the disk
+	// for each of them. Fallback to probing the disk if the asset registry is not ready yet.
+	FHoudiniPackageNameAllocator& NameAllocator = FHoudiniEngine::Get().GetPackageNameAllocator();
+	const bool bUseNameAllocator = ReplaceMode == EPackageReplaceMode::CreateNewAssets && !OverideEnabled && NameAllocator.IsReady();
+	const FString BasePackageName = UPackageTools::SanitizePackageName(PackagePath + TEXT("/") + PackageName);
 	   
 	// Iterate until we find a suitable name for the package
 	UPackage * NewPackage = nullptr;
@@ -332,17 +339,26 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
 		{
 			UPackage* FoundPackage = FindPackage(nullptr, *FinalPackageName);
-			if (FoundPackage == nullptr)
+			bool bNameInUse = FoundPackage != nullptr;
+			if (!bNameInUse && bUseNameAllocator)
+			{
+				bNameInUse = NameAllocator.IsPackageNameInUse(FinalPackageName);
+			}
+			else if (!bNameInUse)
 			{
 				// Package might not be in memory, check if it exists on disk
 				FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
+				bNameInUse = IsValid(FoundPackage);
 			}
 			
-			if (IsValid(FoundPackage))
+			if (bNameInUse)
 			{
 				// we need to generate a new name for it
 				CurrentGuid = FGuid::NewGuid();
-				BakeCounter++;
+				if (bUseNameAllocator)
+					BakeCounter = NameAllocator.GetNextBakeCounter(BasePackageName, BakeCounter);
+				else
+					BakeCounter++;
 				continue;
 			}
 		}
@@ -351,6 +367,9 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		NewPackage = CreatePackage(*FinalPackageName);
 		if (IsValid(NewPackage))
 		{
+			if (bUseNameAllocator)
+				NameAllocator.AddPackageName(FinalPackageName, PackageMode == EPackageMode::Bake ? BakeCounter : 0);
+
 			// Record bake counter / temp GUID in package metadata
 			UMetaData* MetaData = NewPackage->GetMetaData();
 			if (IsValid(MetaData))
@@ -71,6 +71,13 @@
 #define HAPI_UNREAL_PARAM_PIVOT						"p"
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE				"scale"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineUploadLoadedParameterDiff(
+	TEXT("HoudiniEngine.UploadLoadedParameterDiff"),
+	1,
+	TEXT("When loading a HAC, only upload the parameter values that differ from the HDA's defaults, in bulk.\n")
+	TEXT("0: Disabled, every loaded parameter is uploaded individually\n")
+	TEXT("1: Enabled (Default)\n"));
+
 // 
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
@@ -2664,6 +2671,258 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 	return true;
 }
 
+TArray<FIntPoint>
+FHoudiniParameterTranslator::GetDirtyValueRuns(const TBitArray<>& InDirtyValues)
+{
+	TArray<FIntPoint> Runs;
+	int32 RunStart = INDEX_NONE;
+	for (int32 Idx = 0; Idx <= InDirtyValues.Num(); Idx++)
+	{
+		const bool bDirty = Idx < InDirtyValues.Num() && InDirtyValues[Idx];
+		if (bDirty && RunStart == INDEX_NONE)
+		{
+			RunStart = Idx;
+		}
+		else if (!bDirty && RunStart != INDEX_NONE)
+		{
+			Runs.Add(FIntPoint(RunStart, Idx - RunStart));
+			RunStart = INDEX_NONE;
+		}
+	}
+
+	return Runs;
+}
+
+bool
+FHoudiniParameterTranslator::UploadLoadedParameters(UHoudiniAssetComponent* HAC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniParameterTranslator::UploadLoadedParameters);
+
+	if (!IsValid(HAC) || CVarHoudiniEngineUploadLoadedParameterDiff.GetValueOnAnyThread() <= 0)
+		return false;
+
+	const HAPI_NodeId NodeId = HAC->GetAssetId();
+	if (NodeId < 0)
+		return false;
+
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNodeInfo(
+		FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo), false);
+
+	// Fetch the node's current values, the HDA defaults for a freshly instantiated node, in bulk
+	TArray<int32> IntValues;
+	TArray<float> FloatValues;
+	TArray<FString> StringValues;
+	if (NodeInfo.parmIntValueCount > 0)
+	{
+		IntValues.SetNumZeroed(NodeInfo.parmIntValueCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(), 0, IntValues.Num()), false);
+	}
+
+	if (NodeInfo.parmFloatValueCount > 0)
+	{
+		FloatValues.SetNumZeroed(NodeInfo.parmFloatValueCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(), 0, FloatValues.Num()), false);
+	}
+
+	if (NodeInfo.parmStringValueCount > 0)
+	{
+		TArray<HAPI_StringHandle> StringHandles;
+		StringHandles.SetNumZeroed(NodeInfo.parmStringValueCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, true, StringHandles.GetData(), 0, StringHandles.Num()), false);
+
+		if (!FHoudiniEngineString::SHArrayToFStringArray(StringHandles, StringValues))
+			StringValues.Empty();
+	}
+
+	TBitArray<> DirtyInts(false, IntValues.Num());
+	TBitArray<> DirtyFloats(false, FloatValues.Num());
+	TArray<UHoudiniParameter*> ParamsToUpload;
+	int32 NumUnchanged = 0;
+	int32 NumStringsUploaded = 0;
+
+	// Compares a parameter's values with the node's values, and stores the ones that differ.
+	// Returns false if the parameter's values can't be handled here.
+	auto DiffValues = [](const auto* InValues, const int32& InCount, const int32& InValueIndex, auto& NodeValues, TBitArray<>& DirtyValues, bool& bOutChanged)
+	{
+		if (!InValues || InCount <= 0 || InValueIndex < 0 || InValueIndex + InCount > NodeValues.Num())
+			return false;
+
+		bOutChanged = false;
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+		{
+			if (NodeValues[InValueIndex + Idx] == InValues[Idx])
+				continue;
+
+			NodeValues[InValueIndex + Idx] = InValues[Idx];
+			bOutChanged = true;
+		}
+
+		if (bOutChanged)
+			DirtyValues.SetRange(InValueIndex, InCount, true);
+
+		return true;
+	};
+
+	for (UHoudiniParameter* CurrentParm : HAC->Parameters)
+	{
+		if (!IsValid(CurrentParm) || !CurrentParm->HasChanged() || CurrentParm->IsPendingRevertToDefault())
+			continue;
+
+		if (CurrentParm->GetNodeId() != NodeId)
+			continue;
+
+		bool bHandled = false;
+		bool bChanged = false;
+		bool bUploaded = false;
+		switch (CurrentParm->GetParameterType())
+		{
+			case EHoudiniParameterType::Float:
+			{
+				UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(CurrentParm);
+				if (IsValid(FloatParam) && FloatParam->GetNumberOfValues() >= FloatParam->GetTupleSize())
+					bHandled = DiffValues(FloatParam->GetValuesPtr(), FloatParam->GetTupleSize(), FloatParam->GetValueIndex(), FloatValues, DirtyFloats, bChanged);
+			}
+			break;
+
+			case EHoudiniParameterType::Color:
+			{
+				UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(CurrentParm);
+				if (IsValid(ColorParam))
+				{
+					const FLinearColor Color = ColorParam->GetColorValue();
+					bHandled = DiffValues(&Color.R, ColorParam->GetTupleSize() == 4 ? 4 : 3, ColorParam->GetValueIndex(), FloatValues, DirtyFloats, bChanged);
+				}
+			}
+			break;
+
+			case EHoudiniParameterType::Int:
+			{
+				UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(CurrentParm);
+				if (IsValid(IntParam) && IntParam->GetNumberOfValues() >= IntParam->GetTupleSize())
+					bHandled = DiffValues(IntParam->GetValuesPtr(), IntParam->GetTupleSize(), IntParam->GetValueIndex(), IntValues, DirtyInts, bChanged);
+			}
+			break;
+
+			case EHoudiniParameterType::Toggle:
+			{
+				UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(CurrentParm);
+				if (IsValid(ToggleParam) && ToggleParam->GetNumValues() >= ToggleParam->GetTupleSize())
+					bHandled = DiffValues(ToggleParam->GetValuesPtr(), ToggleParam->GetTupleSize(), ToggleParam->GetValueIndex(), IntValues, DirtyInts, bChanged);
+			}
+			break;
+
+			case EHoudiniParameterType::IntChoice:
+			{
+				UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(CurrentParm);
+				if (IsValid(ChoiceParam))
+				{
+					const int32 IntValue = ChoiceParam->GetIntValue(ChoiceParam->GetIntValueIndex());
+					bHandled = DiffValues(&IntValue, 1, ChoiceParam->GetValueIndex(), IntValues, DirtyInts, bChanged);
+				}
+			}
+			break;
+
+			case EHoudiniParameterType::String:
+			case EHoudiniParameterType::StringChoice:
+			{
+				// There is no bulk setter for strings, so only the strings that differ are uploaded, one at a time
+				if (StringValues.Num() <= 0)
+					break;
+
+				TArray<FString> ParmStrings;
+				if (UHoudiniParameterString* StringParam = Cast<UHoudiniParameterString>(CurrentParm))
+				{
+					for (int32 Idx = 0; Idx < StringParam->GetNumberOfValues(); Idx++)
+						ParmStrings.Add(StringParam->GetValueAt(Idx));
+				}
+				else if (UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(CurrentParm))
+				{
+					if (ChoiceParam->IsStringChoice())
+						ParmStrings.Add(ChoiceParam->GetStringValue());
+				}
+
+				const int32 ValueIndex = CurrentParm->GetValueIndex();
+				if (ParmStrings.Num() <= 0 || ValueIndex < 0 || ValueIndex + ParmStrings.Num() > StringValues.Num())
+					break;
+
+				bHandled = true;
+				for (int32 Idx = 0; Idx < ParmStrings.Num(); Idx++)
+				{
+					if (StringValues[ValueIndex + Idx].Equals(ParmStrings[Idx], ESearchCase::CaseSensitive))
+						continue;
+
+					bChanged = true;
+					std::string ConvertedString = TCHAR_TO_UTF8(*ParmStrings[Idx]);
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmStringValue(
+						FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), CurrentParm->GetParmId(), Idx))
+					{
+						// Let UploadChangedParameters try again
+						bHandled = false;
+						break;
+					}
+				}
+				bUploaded = bHandled && bChanged;
+			}
+			break;
+
+			default:
+				break;
+		}
+
+		if (!bHandled)
+			continue;
+
+		if (bUploaded)
+		{
+			CurrentParm->MarkChanged(false);
+			NumStringsUploaded++;
+		}
+		else if (bChanged)
+		{
+			ParamsToUpload.Add(CurrentParm);
+		}
+		else
+		{
+			// The loaded value is the same as the node's: nothing to upload
+			CurrentParm->MarkChanged(false);
+			NumUnchanged++;
+		}
+	}
+
+	// Upload each contiguous run of modified values in a single call
+	bool bSuccess = true;
+	for (const FIntPoint& Run : GetDirtyValueRuns(DirtyInts))
+	{
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, &IntValues[Run.X], Run.X, Run.Y))
+			bSuccess = false;
+	}
+
+	for (const FIntPoint& Run : GetDirtyValueRuns(DirtyFloats))
+	{
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(), NodeId, &FloatValues[Run.X], Run.X, Run.Y))
+			bSuccess = false;
+	}
+
+	// If a bulk upload failed, leave the parameters marked as changed so UploadChangedParameters uploads them individually
+	if (bSuccess)
+	{
+		for (UHoudiniParameter* Param : ParamsToUpload)
+			Param->MarkChanged(false);
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("%s: %d loaded parameters already matched the HDA, %d uploaded in bulk, %d string parameters uploaded."),
+		*HAC->GetName(), NumUnchanged, ParamsToUpload.Num(), NumStringsUploaded);
+
+	return bSuccess;
+}
+
 bool
 FHoudiniParameterTranslator::UploadParameterValue(UHoudiniParameter* InParam)
 {
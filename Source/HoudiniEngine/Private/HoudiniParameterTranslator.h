@@ -52,6 +52,14 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// 
 	static bool UploadChangedParameters(UHoudiniAssetComponent* HAC);
 
+	// Used on the first cook after loading: uploads the int, float and string values of the loaded parameters
+	// that differ from the freshly instantiated node's values, with one SetParm*Values call per contiguous run.
+	// Parameters that already match are marked as unchanged, the others are left to UploadChangedParameters.
+	static bool UploadLoadedParameters(UHoudiniAssetComponent* HAC);
+
+	// Returns the runs of consecutive set bits as (start index, count)
+	static TArray<FIntPoint> GetDirtyValueRuns(const TBitArray<>& InDirtyValues);
+
 	//
 	static bool UploadParameterValue(UHoudiniParameter* InParam);
 
@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "HoudiniSessionSnapshot.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniNodeSyncComponent.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameter.h"
+#include "HoudiniSplineComponent.h"
+#include "UnrealObjectInputRuntimeUtils.h"
+
+#include "HAL/FileManager.h"
+
+#include <string>
+
+FHoudiniSessionSnapshot::FHoudiniSessionSnapshot()
+{
+	Queries.GetNodePath = [](const HAPI_NodeId& NodeId, FString& OutPath)
+	{
+		return FHoudiniEngineUtils::HapiGetAbsNodePath(NodeId, OutPath);
+	};
+
+	Queries.GetNodeFromPath = [](const FString& Path, HAPI_NodeId& OutNodeId)
+	{
+		return HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeFromPath(
+			FHoudiniEngine::Get().GetSession(), -1, TCHAR_TO_UTF8(*Path), &OutNodeId);
+	};
+
+	Queries.SaveHIPFile = [](const FString& Path)
+	{
+		std::string PathConverted(TCHAR_TO_UTF8(*Path));
+		return HAPI_RESULT_SUCCESS == FHoudiniApi::SaveHIPFile(
+			FHoudiniEngine::Get().GetSession(), PathConverted.c_str(), false);
+	};
+
+	Queries.LoadHIPFile = [](const FString& Path)
+	{
+		std::string PathConverted(TCHAR_TO_UTF8(*Path));
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::LoadHIPFile(
+			FHoudiniEngine::Get().GetSession(), PathConverted.c_str(), false))
+		{
+			return false;
+		}
+
+		// Loading is asynchronous in threaded mode, wait for it to finish
+		int Status = HAPI_STATE_STARTING_LOAD;
+		while (Status > HAPI_STATE_MAX_READY_STATE)
+		{
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStatus(
+				FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status))
+			{
+				return false;
+			}
+
+			// We want to yield a bit.
+			FPlatformProcess::Sleep(0.1f);
+		}
+
+		return Status != HAPI_STATE_READY_WITH_FATAL_ERRORS;
+	};
+
+	Queries.DeleteHIPFile = [](const FString& Path)
+	{
+		return IFileManager::Get().Delete(*Path, false, true, true);
+	};
+
+	Queries.GetChildNodeIds = [](const FString& Path, TArray<HAPI_NodeId>& OutNodeIds)
+	{
+		OutNodeIds.Empty();
+
+		HAPI_NodeId ParentNodeId = -1;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeFromPath(
+			FHoudiniEngine::Get().GetSession(), -1, TCHAR_TO_UTF8(*Path), &ParentNodeId))
+		{
+			return false;
+		}
+
+		int32 ChildCount = 0;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::ComposeChildNodeList(
+			FHoudiniEngine::Get().GetSession(), ParentNodeId, HAPI_NODETYPE_ANY, HAPI_NODEFLAGS_ANY, false, &ChildCount))
+		{
+			return false;
+		}
+
+		if (ChildCount <= 0)
+			return true;
+
+		OutNodeIds.SetNumUninitialized(ChildCount);
+		return HAPI_RESULT_SUCCESS == FHoudiniApi::GetComposedChildNodeList(
+			FHoudiniEngine::Get().GetSession(), ParentNodeId, OutNodeIds.GetData(), ChildCount);
+	};
+}
+
+FHoudiniSessionSnapshot::FHoudiniSessionSnapshot(const FQueries& InQueries)
+	: Queries(InQueries)
+{
+}
+
+int32
+FHoudiniSessionSnapshot::CaptureComponents(const TArray<UHoudiniAssetComponent*>& InHACs)
+{
+	for (UHoudiniAssetComponent* HAC : InHACs)
+	{
+		if (!IsValid(HAC) || HAC->GetAssetState() != EHoudiniAssetState::None || HAC->GetAssetId() < 0)
+			continue;
+
+		// Node sync components fetch existing nodes, and PDG asset links would need to be initialized again
+		if (HAC->IsA<UHoudiniNodeSyncComponent>() || HAC->GetPDGAssetLink())
+			continue;
+
+		FComponentEntry Entry;
+		Entry.CookCount = HAC->GetAssetCookCount();
+		auto GatherNodeId = [&Entry](const HAPI_NodeId& InNodeId)
+		{
+			if (InNodeId >= 0)
+				Entry.NodeIds.AddUnique(InNodeId);
+			return InNodeId;
+		};
+
+		if (!RemapComponentNodeIds(HAC, GatherNodeId))
+			continue;
+
+		// Previous input nodes still exist in the snapshot, they are deleted after restoring
+		for (UHoudiniInput* Input : HAC->GetInputs())
+		{
+			if (!IsValid(Input))
+				continue;
+
+			for (const int32& NodeId : Input->GetInputNodesPendingDelete())
+				GatherNodeId(NodeId);
+		}
+
+		CaptureNodes(Entry.NodeIds);
+		Components.Add(HAC, MoveTemp(Entry));
+	}
+
+	return Components.Num();
+}
+
+void
+FHoudiniSessionSnapshot::CaptureNodes(const TArray<HAPI_NodeId>& InNodeIds)
+{
+	for (const HAPI_NodeId& NodeId : InNodeIds)
+	{
+		if (NodeId < 0 || NodePaths.Contains(NodeId))
+			continue;
+
+		FString NodePath;
+		if (Queries.GetNodePath(NodeId, NodePath) && !NodePath.IsEmpty())
+			NodePaths.Add(NodeId, NodePath);
+	}
+}
+
+bool
+FHoudiniSessionSnapshot::SaveHIPFile(const FString& InHIPFilePath)
+{
+	if (NodePaths.Num() <= 0 || !Queries.SaveHIPFile(InHIPFilePath))
+		return false;
+
+	HIPFilePath = InHIPFilePath;
+	return true;
+}
+
+void
+FHoudiniSessionSnapshot::DeleteHIPFile()
+{
+	if (!IsSaved())
+		return;
+
+	Queries.DeleteHIPFile(HIPFilePath);
+	HIPFilePath.Empty();
+}
+
+bool
+FHoudiniSessionSnapshot::IsComponentCaptured(UHoudiniAssetComponent* HAC) const
+{
+	return Components.Contains(HAC);
+}
+
+bool
+FHoudiniSessionSnapshot::Restore()
+{
+	RestoredNodeIds.Empty();
+	if (!IsSaved() || !Queries.LoadHIPFile(HIPFilePath))
+		return false;
+
+	for (const auto& NodePath : NodePaths)
+	{
+		HAPI_NodeId RestoredNodeId = -1;
+		if (Queries.GetNodeFromPath(NodePath.Value, RestoredNodeId) && RestoredNodeId >= 0)
+			RestoredNodeIds.Add(NodePath.Key, RestoredNodeId);
+	}
+
+	return true;
+}
+
+bool
+FHoudiniSessionSnapshot::RemapNodeId(const HAPI_NodeId& InNodeId, HAPI_NodeId& OutNodeId) const
+{
+	if (InNodeId < 0)
+	{
+		OutNodeId = InNodeId;
+		return true;
+	}
+
+	const HAPI_NodeId* RestoredNodeId = RestoredNodeIds.Find(InNodeId);
+	if (!RestoredNodeId)
+		return false;
+
+	OutNodeId = *RestoredNodeId;
+	return true;
+}
+
+bool
+FHoudiniSessionSnapshot::RestoreComponent(UHoudiniAssetComponent* HAC)
+{
+	FComponentEntry* Entry = Components.Find(HAC);
+	if (!Entry || Entry->bRestored)
+		return false;
+
+	// The component must be in the same state as when the snapshot was taken
+	if (!IsValid(HAC) || HAC->GetAssetState() != EHoudiniAssetState::None || HAC->GetAssetCookCount() != Entry->CookCount)
+		return false;
+
+	// Make sure all the nodes can be remapped before modifying the component
+	bool bAllNodesRestored = true;
+	auto CheckNodeId = [this, &bAllNodesRestored](const HAPI_NodeId& InNodeId)
+	{
+		HAPI_NodeId RestoredNodeId = -1;
+		bAllNodesRestored &= RemapNodeId(InNodeId, RestoredNodeId);
+		return InNodeId;
+	};
+
+	if (!RemapComponentNodeIds(HAC, CheckNodeId) || !bAllNodesRestored)
+		return false;
+
+	auto ApplyNodeId = [this](const HAPI_NodeId& InNodeId)
+	{
+		HAPI_NodeId RestoredNodeId = -1;
+		RemapNodeId(InNodeId, RestoredNodeId);
+		return RestoredNodeId;
+	};
+	RemapComponentNodeIds(HAC, ApplyNodeId);
+
+	for (UHoudiniInput* Input : HAC->GetInputs())
+	{
+		if (IsValid(Input))
+			Input->ClearInputNodesPendingDelete();
+	}
+
+	// The output nodes are gathered again before the next cook, and their node ids have changed
+	HAC->ClearOutputNodes();
+	HAC->ClearOutputNodesCookCount();
+	HAC->SetAssetCookCount(0);
+
+	Entry->bRestored = true;
+	return true;
+}
+
+void
+FHoudiniSessionSnapshot::GetOrphanedNodeIds(TArray<HAPI_NodeId>& OutNodeIds) const
+{
+	OutNodeIds.Empty();
+
+	// Nodes used by the restored components, including nodes shared with components that were not restored
+	TSet<HAPI_NodeId> ClaimedNodeIds;
+	for (const auto& Component : Components)
+	{
+		if (!Component.Value.bRestored)
+			continue;
+
+		UHoudiniAssetComponent* HAC = Component.Key.ResolveObjectPtr();
+		auto ClaimNodeId = [&ClaimedNodeIds](const HAPI_NodeId& InNodeId)
+		{
+			ClaimedNodeIds.Add(InNodeId);
+			return InNodeId;
+		};
+		RemapComponentNodeIds(HAC, ClaimNodeId);
+	}
+
+	TArray<FString> ClaimedNodePaths;
+	for (const auto& RestoredNodeId : RestoredNodeIds)
+	{
+		if (ClaimedNodeIds.Contains(RestoredNodeId.Value))
+		{
+			if (const FString* NodePath = NodePaths.Find(RestoredNodeId.Key))
+				ClaimedNodePaths.Add(*NodePath);
+		}
+		else
+		{
+			OutNodeIds.AddUnique(RestoredNodeId.Value);
+		}
+	}
+
+	// The snapshot also contains the nodes that were never captured: nodes of the components that can't be
+	// restored, of the input manager, prewarmed nodes... Only keep the networks used by the restored components.
+	TArray<HAPI_NodeId> ObjNodeIds;
+	if (!Queries.GetChildNodeIds || !Queries.GetChildNodeIds(TEXT("/obj"), ObjNodeIds))
+		return;
+
+	for (const HAPI_NodeId& ObjNodeId : ObjNodeIds)
+	{
+		FString ObjNodePath;
+		if (ClaimedNodeIds.Contains(ObjNodeId) || !Queries.GetNodePath(ObjNodeId, ObjNodePath))
+			continue;
+
+		const FString ObjNodePathPrefix = ObjNodePath + TEXT("/");
+		const bool bIsClaimed = ClaimedNodePaths.ContainsByPredicate([&](const FString& ClaimedNodePath)
+		{
+			return ClaimedNodePath == ObjNodePath || ClaimedNodePath.StartsWith(ObjNodePathPrefix);
+		});
+
+		if (bIsClaimed)
+			continue;
+
+		// Nodes inside an orphaned network are deleted along with it
+		OutNodeIds.RemoveAll([&](const HAPI_NodeId& NodeId)
+		{
+			const HAPI_NodeId* OriginalNodeId = RestoredNodeIds.FindKey(NodeId);
+			const FString* NodePath = OriginalNodeId ? NodePaths.Find(*OriginalNodeId) : nullptr;
+			return NodePath && NodePath->StartsWith(ObjNodePathPrefix);
+		});
+		OutNodeIds.AddUnique(ObjNodeId);
+	}
+}
+
+bool
+FHoudiniSessionSnapshot::RemapComponentNodeIds(UHoudiniAssetComponent* HAC, TFunctionRef<HAPI_NodeId(const HAPI_NodeId&)> InFunc)
+{
+	if (!IsValid(HAC))
+		return false;
+
+	// The nodes of the ref counted input system are owned by the input manager and can't be remapped
+	const bool bIsRefCountedInputSystemEnabled = FUnrealObjectInputRuntimeUtils::IsRefCountedInputSystemEnabled();
+	TArray<UHoudiniInputObject*> InputObjects;
+	for (UHoudiniInput* Input : HAC->Inputs)
+	{
+		if (!IsValid(Input))
+			continue;
+
+		TArray<UHoudiniInputObject*> CurrentInputObjects;
+		Input->GetAllHoudiniInputObjects(CurrentInputObjects);
+		for (UHoudiniInputObject* InputObject : CurrentInputObjects)
+		{
+			if (!IsValid(InputObject))
+				continue;
+
+			if (bIsRefCountedInputSystemEnabled && InputObject->InputNodeHandleOverridesNodeIds())
+				return false;
+
+			InputObjects.Add(InputObject);
+		}
+	}
+
+	HAC->AssetId = InFunc(HAC->AssetId);
+
+	for (UHoudiniParameter* Parameter : HAC->Parameters)
+	{
+		if (IsValid(Parameter))
+			Parameter->SetNodeId(InFunc(Parameter->GetNodeId()));
+	}
+
+	for (UHoudiniInput* Input : HAC->Inputs)
+	{
+		if (!IsValid(Input))
+			continue;
+
+		Input->SetAssetNodeId(InFunc(Input->GetAssetNodeId()));
+		Input->SetInputNodeId(InFunc(Input->GetInputNodeId()));
+		for (int32& NodeId : Input->GetCreatedDataNodeIds())
+			NodeId = InFunc(NodeId);
+	}
+
+	for (UHoudiniInputObject* InputObject : InputObjects)
+	{
+		InputObject->SetInputNodeId(InFunc(InputObject->GetInputNodeId()));
+		InputObject->SetInputObjectNodeId(InFunc(InputObject->GetInputObjectNodeId()));
+
+		if (UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(InputObject))
+		{
+			InputActor->SplinesMeshObjectNodeId = InFunc(InputActor->SplinesMeshObjectNodeId);
+			InputActor->SplinesMeshNodeId = InFunc(InputActor->SplinesMeshNodeId);
+		}
+
+		// Curve inputs are updated through the node id stored on their spline component
+		if (UHoudiniInputHoudiniSplineComponent* InputSpline = Cast<UHoudiniInputHoudiniSplineComponent>(InputObject))
+		{
+			UHoudiniSplineComponent* SplineComponent = InputSpline->GetCurveComponent();
+			if (IsValid(SplineComponent))
+				SplineComponent->SetNodeId(InFunc(SplineComponent->GetNodeId()));
+		}
+	}
+
+	// Editable output curves upload their points to the curve node inside the HDA
+	for (UHoudiniOutput* Output : HAC->Outputs)
+	{
+		if (!IsValid(Output) || !Output->IsEditableNode())
+			continue;
+
+		for (auto& OutputObjectPair : Output->GetOutputObjects())
+		{
+			for (UObject* OutputComponent : OutputObjectPair.Value.OutputComponents)
+			{
+				UHoudiniSplineComponent* SplineComponent = Cast<UHoudiniSplineComponent>(OutputComponent);
+				if (IsValid(SplineComponent))
+					SplineComponent->SetNodeId(InFunc(SplineComponent->GetNodeId()));
+			}
+		}
+	}
+
+	return true;
+}
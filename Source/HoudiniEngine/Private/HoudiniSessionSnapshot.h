@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) <2021> Side Effects Software Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "Containers/Map.h"
+#include "Templates/Function.h"
+#include "UObject/ObjectKey.h"
+
+class UHoudiniAssetComponent;
+
+// A snapshot of the Houdini scene of a session, along with the nodes used by the Houdini Asset Components.
+// After a restart of the session, or a crash of Houdini, loading the snapshot recreates the components' nodes
+// with their parameters and inputs, so the components that were not modified since the snapshot can skip
+// their instantiation, input upload and cook.
+// Node ids are not preserved when loading a HIP file, the nodes are identified by their path and remapped.
+class FHoudiniSessionSnapshot
+{
+public:
+
+	// The queries used to save and restore the snapshot.
+	struct FQueries
+	{
+		TFunction<bool(const HAPI_NodeId&, FString&)> GetNodePath;
+		TFunction<bool(const FString&, HAPI_NodeId&)> GetNodeFromPath;
+		TFunction<bool(const FString&)> SaveHIPFile;
+		TFunction<bool(const FString&)> LoadHIPFile;
+		TFunction<bool(const FString&)> DeleteHIPFile;
+		// Returns the ids of the nodes directly inside the network at the given path.
+		TFunction<bool(const FString&, TArray<HAPI_NodeId>&)> GetChildNodeIds;
+	};
+
+	// Creates a snapshot of the current Houdini Engine session.
+	FHoudiniSessionSnapshot();
+
+	// Creates a snapshot using the given queries.
+	FHoudiniSessionSnapshot(const FQueries& InQueries);
+
+	// Records the nodes used by the components that can be restored: idle components with an instantiated node.
+	// Returns the number of captured components.
+	int32 CaptureComponents(const TArray<UHoudiniAssetComponent*>& InHACs);
+
+	// Records the paths of the given nodes. Nodes that don't exist are ignored.
+	void CaptureNodes(const TArray<HAPI_NodeId>& InNodeIds);
+
+	// Saves the Houdini scene. The snapshot can only be restored once it has been saved.
+	// Can be called from any thread.
+	bool SaveHIPFile(const FString& InHIPFilePath);
+
+	bool IsSaved() const { return !HIPFilePath.IsEmpty(); }
+
+	const FString& GetHIPFilePath() const { return HIPFilePath; }
+
+	// Deletes the saved scene, the snapshot can't be restored afterwards.
+	void DeleteHIPFile();
+
+	bool IsComponentCaptured(UHoudiniAssetComponent* HAC) const;
+
+	// Loads the saved scene in the current session, and finds the new ids of the captured nodes.
+	// This replaces the whole Houdini scene, and should only be done right after the session has started.
+	bool Restore();
+
+	// Returns the id of a captured node in the restored session.
+	// Invalid node ids are returned unchanged.
+	bool RemapNodeId(const HAPI_NodeId& InNodeId, HAPI_NodeId& OutNodeId) const;
+
+	// Makes a component use its restored nodes, so that it doesn't need to be instantiated and to upload its inputs.
+	// Fails if the component has cooked since the snapshot or if any of its nodes couldn't be restored,
+	// the component is left untouched in that case.
+	bool RestoreComponent(UHoudiniAssetComponent* HAC);
+
+	// Returns the nodes of the restored scene that are not used by any of the restored components:
+	// the top level nodes of /obj that don't contain any node of a restored component, and the captured nodes
+	// that no restored component uses. This includes the nodes of the components that weren't captured or
+	// couldn't be restored, the input manager's nodes and the prewarmed nodes of the previous session.
+	void GetOrphanedNodeIds(TArray<HAPI_NodeId>& OutNodeIds) const;
+
+private:
+
+	// Replaces the ids of all the nodes used by a component, its parameters and its inputs by the value returned by InFunc.
+	// Returns false, without modifying the component, if some of its nodes can't be remapped.
+	static bool RemapComponentNodeIds(UHoudiniAssetComponent* HAC, TFunctionRef<HAPI_NodeId(const HAPI_NodeId&)> InFunc);
+
+	struct FComponentEntry
+	{
+		// Cook count of the component's node when the snapshot was taken.
+		int32 CookCount = -1;
+
+		TArray<HAPI_NodeId> NodeIds;
+
+		bool bRestored = false;
+	};
+
+	FQueries Queries;
+
+	// Path of the saved HIP file, empty until the snapshot has been saved.
+	FString HIPFilePath;
+
+	// Paths of the captured nodes.
+	TMap<HAPI_NodeId, FString> NodePaths;
+
+	// Ids of the captured nodes in the restored session.
+	TMap<HAPI_NodeId, HAPI_NodeId> RestoredNodeIds;
+
+	TMap<TObjectKey<UHoudiniAssetComponent>, FComponentEntry> Components;
+};
@@ -1,5 +1,55 @@
-﻿#include "../HoudiniEngine.h"
+﻿#include "../HCsgUtils.h"
+#include "../HoudiniCookGraph.h"
+#include "../HoudiniEngine.h"
+#include "../HoudiniEngineManager.h"
+#include "../HoudiniEngineScheduler.h"
+#include "../HoudiniEngineString.h"
+#include "../HoudiniEngineUtils.h"
+#include "../HoudiniFoliageTools.h"
+#include "../HoudiniHapiInfoCache.h"
+#include "../HoudiniLandscapeSplineAttributes.h"
+#include "../HoudiniLandscapeSplineTranslator.h"
+#include "../HoudiniLandscapeUtils.h"
+#include "../HoudiniPackageParams.h"
+#include "../HoudiniPDGImporterMessages.h"
+#include "../HoudiniPDGManager.h"
+#include "../HoudiniParameterTranslator.h"
+#include "../HoudiniSessionSnapshot.h"
+#include "../UnrealGeometryCollectionTranslator.h"
+#include "../UnrealLandscapeTranslator.h"
+#include "../UnrealObjectInputUtils.h"
+#include "../UnrealSplineTranslator.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+#include "HoudiniInstancedActorComponent.h"
+#include "HoudiniMeshSplitInstancerComponent.h"
+#include "HoudiniParameter.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniPDGAssetLink.h"
+#include "HoudiniStaticMesh.h"
+#include "UnrealObjectInputManager.h"
+#include "UnrealObjectInputRuntimeTypes.h"
+#include "Async/Async.h"
+#include "Builders/CubeBuilder.h"
+#include "Components/BrushComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Brush.h"
+#include "Engine/Polys.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "FoliageType_InstancedStaticMesh.h"
+#include "GeometryCollection/GeometryCollection.h"
+#include "HAL/IConsoleManager.h"
+#include "Model.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +60,1731 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_CookPriority, "Houdini.Core.Scheduler.CookPriority", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_CookPriority::RunTest(const FString & Parameters)
+{
+	// The scheduler is not run on a thread here, we only fill and drain its queue.
+	FHoudiniEngineScheduler Scheduler;
+
+	// Background HDAs request a cook, then a selected HDA does
+	const int32 NumBackgroundCooks = 3;
+	TArray<FGuid> TaskGUIDs;
+	for (int32 Idx = 0; Idx < NumBackgroundCooks; Idx++)
+	{
+		FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, TaskGUIDs.Add_GetRef(FGuid::NewGuid()));
+		Task.AssetId = 10 + Idx;
+		Scheduler.AddTask(Task);
+	}
+
+	const HAPI_NodeId SelectedNodeId = 20;
+	FHoudiniEngineTask SelectedTask(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+	SelectedTask.AssetId = SelectedNodeId;
+	SelectedTask.Priority = 2;
+	Scheduler.AddTask(SelectedTask);
+
+	TestEqual(TEXT("Pending tasks"), Scheduler.GetPendingTaskCount(), NumBackgroundCooks + 1);
+
+	// Cancelling a pending task removes it from the queue and reports it as aborted
+	TestTrue(TEXT("Pending task can be cancelled"), Scheduler.CancelTask(TaskGUIDs[1]));
+	TestFalse(TEXT("Unknown task can't be cancelled"), Scheduler.CancelTask(FGuid::NewGuid()));
+	FHoudiniEngineTaskInfo TaskInfo;
+	TestTrue(TEXT("Cancelled task posted its state"), FHoudiniEngine::Get().RetrieveTaskInfo(TaskGUIDs[1], TaskInfo));
+	TestTrue(TEXT("Cancelled task is aborted"), TaskInfo.TaskState == EHoudiniEngineTaskState::Aborted);
+	FHoudiniEngine::Get().RemoveTaskInfo(TaskGUIDs[1]);
+
+	// Drain the queue: the selected HDA comes first, the others keep their order
+	TArray<HAPI_NodeId> CookedNodeIds;
+	FHoudiniEngineTask Task;
+	while (Scheduler.DequeueTask(Task))
+		CookedNodeIds.Add(Task.AssetId);
+
+	TestTrue(TEXT("Selected HDA is cooked first"), CookedNodeIds == TArray<HAPI_NodeId>({ SelectedNodeId, 10, 12 }));
+	TestFalse(TEXT("Queue is empty"), Scheduler.HasPendingTasks());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_AssetLibraryRegistry, "Houdini.Core.AssetLibraries.Registry", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_AssetLibraryRegistry::RunTest(const FString & Parameters)
+{
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+
+	// Unique keys never match the library of an actual HDA, and stand-in loads don't touch the session
+	const FString KeyPrefix = FString::Printf(TEXT("test:%s:"), *FGuid::NewGuid().ToString());
+	FThreadSafeCounter NumLoads;
+	auto StandInLoad = [&NumLoads](const HAPI_AssetLibraryId& InLoadedLibraryId, const HAPI_Result& InResult)
+	{
+		return [&NumLoads, InLoadedLibraryId, InResult](HAPI_AssetLibraryId& OutLoadedLibraryId)
+		{
+			NumLoads.Increment();
+			OutLoadedLibraryId = InLoadedLibraryId;
+			return InResult;
+		};
+	};
+
+	// A regular load takes over a queued preload, which then finds the library loaded
+	{
+		const FString Key = KeyPrefix + TEXT("queued");
+		TestTrue(TEXT("Preload queued"), HoudiniEngine.QueueAssetLibraryLoad(Key));
+		TestFalse(TEXT("Preload is only queued once"), HoudiniEngine.QueueAssetLibraryLoad(Key));
+
+		HAPI_AssetLibraryId LibraryId = -1;
+		TestEqual(TEXT("Regular load"), FHoudiniEngineUtils::LoadAssetLibrary(Key, StandInLoad(101, HAPI_RESULT_SUCCESS), LibraryId), HAPI_RESULT_SUCCESS);
+		TestEqual(TEXT("Loaded library"), LibraryId, 101);
+		TestEqual(TEXT("Library loaded once"), NumLoads.GetValue(), 1);
+
+		LibraryId = -1;
+		TestTrue(TEXT("Preload finds the library loaded"), HoudiniEngine.BeginAssetLibraryLoad(Key, LibraryId) == EHoudiniAssetLibraryLoadState::Loaded);
+		TestEqual(TEXT("Preload reuses the library"), LibraryId, 101);
+		TestFalse(TEXT("Loaded library isn't queued again"), HoudiniEngine.QueueAssetLibraryLoad(Key));
+
+		TestEqual(TEXT("Second regular load"), FHoudiniEngineUtils::LoadAssetLibrary(Key, StandInLoad(102, HAPI_RESULT_SUCCESS), LibraryId), HAPI_RESULT_SUCCESS);
+		TestEqual(TEXT("Second load reuses the library"), LibraryId, 101);
+		TestEqual(TEXT("Library still loaded once"), NumLoads.GetValue(), 1);
+	}
+
+	// A regular load waits for a preload running on another thread, and reuses its library
+	{
+		const FString Key = KeyPrefix + TEXT("preloading");
+		TestTrue(TEXT("Preload queued"), HoudiniEngine.QueueAssetLibraryLoad(Key));
+
+		FEvent* PreloadStarted = FPlatformProcess::GetSynchEventFromPool();
+		TFuture<bool> Preload = Async(EAsyncExecution::Thread, [&HoudiniEngine, Key, PreloadStarted]()
+		{
+			HAPI_AssetLibraryId LibraryId = -1;
+			const bool bClaimed = HoudiniEngine.BeginAssetLibraryLoad(Key, LibraryId) == EHoudiniAssetLibraryLoadState::Claimed;
+			PreloadStarted->Trigger();
+			if (!bClaimed)
+				return false;
+
+			FPlatformProcess::Sleep(0.2f);
+			HoudiniEngine.EndAssetLibraryLoad(Key, 202);
+			return true;
+		});
+
+		PreloadStarted->Wait();
+		FPlatformProcess::ReturnSynchEventToPool(PreloadStarted);
+
+		HAPI_AssetLibraryId LibraryId = -1;
+		TestEqual(TEXT("Regular load during the preload"), FHoudiniEngineUtils::LoadAssetLibrary(Key, StandInLoad(203, HAPI_RESULT_SUCCESS), LibraryId), HAPI_RESULT_SUCCESS);
+		TestTrue(TEXT("Preload claimed the library"), Preload.Get());
+		TestEqual(TEXT("Regular load reuses the preloaded library"), LibraryId, 202);
+		TestEqual(TEXT("Regular load didn't load the library again"), NumLoads.GetValue(), 1);
+	}
+
+	// Failed loads aren't registered, the next load tries again
+	{
+		const FString Key = KeyPrefix + TEXT("failed");
+		HAPI_AssetLibraryId LibraryId = -1;
+		TestEqual(TEXT("Failed load"), FHoudiniEngineUtils::LoadAssetLibrary(Key, StandInLoad(301, HAPI_RESULT_FAILURE), LibraryId), HAPI_RESULT_FAILURE);
+		TestEqual(TEXT("Failed load has no library"), LibraryId, -1);
+		TestFalse(TEXT("Failed load isn't registered"), HoudiniEngine.FindLoadedAssetLibrary(Key, LibraryId));
+
+		TestEqual(TEXT("Load after a failure"), FHoudiniEngineUtils::LoadAssetLibrary(Key, StandInLoad(302, HAPI_RESULT_SUCCESS), LibraryId), HAPI_RESULT_SUCCESS);
+		TestEqual(TEXT("Library loaded after a failure"), LibraryId, 302);
+		TestEqual(TEXT("Both loads ran"), NumLoads.GetValue(), 3);
+	}
+
+	// Libraries without a key are never shared
+	{
+		HAPI_AssetLibraryId LibraryId = -1;
+		FHoudiniEngineUtils::LoadAssetLibrary(FString(), StandInLoad(401, HAPI_RESULT_SUCCESS), LibraryId);
+		FHoudiniEngineUtils::LoadAssetLibrary(FString(), StandInLoad(401, HAPI_RESULT_SUCCESS), LibraryId);
+		TestEqual(TEXT("Unshared library loaded every time"), NumLoads.GetValue(), 5);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_InputManagerBatch, "Houdini.Core.InputManager.BatchedReconnects", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_InputManagerBatch::RunTest(const FString & Parameters)
+{
+	IUnrealObjectInputManager* const Manager = FUnrealObjectInputManager::Get();
+	if (!TestNotNull(TEXT("Input manager"), Manager))
+		return false;
+
+	// The merges are rebuilt in HAPI
+	if (!TestNotNull(TEXT("Houdini Engine session"), FHoudiniEngine::Get().GetSession()))
+		return false;
+
+	// Adds a leaf node with its HAPI nodes: a null SOP in a geo object, inside the leaf's container
+	auto AddLeafNode = [](UObject const* const InObject, const FUnrealObjectInputOptions& InOptions, FUnrealObjectInputHandle& OutHandle)
+	{
+		constexpr bool bIsLeaf = true;
+		const FUnrealObjectInputIdentifier Identifier(InObject, InOptions, bIsLeaf);
+		FUnrealObjectInputHandle ParentHandle;
+		int32 ParentNodeId = -1;
+		if (FUnrealObjectInputUtils::EnsureParentsExist(Identifier, ParentHandle, true))
+			FUnrealObjectInputUtils::GetHAPINodeId(ParentHandle, ParentNodeId);
+
+		HAPI_NodeId ObjectNodeId = -1;
+		if (FHoudiniEngineUtils::CreateNode(ParentNodeId, TEXT("geo"), TEXT("BatchTestLeaf"), true, &ObjectNodeId) != HAPI_RESULT_SUCCESS)
+			return false;
+
+		HAPI_NodeId NodeId = -1;
+		if (FHoudiniEngineUtils::CreateNode(ObjectNodeId, TEXT("null"), TEXT("BatchTestLeaf"), true, &NodeId) != HAPI_RESULT_SUCCESS)
+		{
+			FHoudiniEngineUtils::DeleteHoudiniNode(ObjectNodeId);
+			return false;
+		}
+
+		return FUnrealObjectInputUtils::AddNodeOrUpdateNode(Identifier, NodeId, OutHandle, ObjectNodeId);
+	};
+
+	// Simulate a world input with a large selection: each actor has a leaf and a reference node referencing it, the
+	// world input's reference node references all the actors
+	const int32 NumActors = 100;
+	const FUnrealObjectInputOptions Options;
+	constexpr bool bIsLeaf = false;
+	TArray<FUnrealObjectInputIdentifier> Identifiers;
+	TArray<FUnrealObjectInputHandle> LeafHandles;
+	TSet<FUnrealObjectInputHandle> ActorHandles;
+	for (int32 Idx = 0; Idx < NumActors; Idx++)
+	{
+		UHoudiniAsset* const Object = NewObject<UHoudiniAsset>(GetTransientPackage());
+
+		FUnrealObjectInputHandle LeafHandle;
+		if (!TestTrue(TEXT("Leaf node added"), AddLeafNode(Object, Options, LeafHandle)))
+			return false;
+		LeafHandles.Add(LeafHandle);
+		Identifiers.Add(LeafHandle.GetIdentifier());
+
+		FUnrealObjectInputHandle ActorHandle;
+		const FUnrealObjectInputIdentifier ActorIdentifier(Object, Options, bIsLeaf);
+		const TSet<FUnrealObjectInputHandle> ReferencedNodes = { LeafHandle };
+		if (!TestTrue(TEXT("Actor reference node added"), FUnrealObjectInputUtils::CreateOrUpdateReferenceInputMergeNode(ActorIdentifier, ReferencedNodes, ActorHandle, false)))
+			return false;
+		ActorHandles.Add(ActorHandle);
+		Identifiers.Add(ActorIdentifier);
+	}
+
+	UHoudiniAsset* const WorldObject = NewObject<UHoudiniAsset>(GetTransientPackage());
+	const FUnrealObjectInputIdentifier WorldIdentifier(WorldObject, Options, bIsLeaf);
+	FUnrealObjectInputHandle WorldHandle;
+	if (!TestTrue(TEXT("World reference node added"), FUnrealObjectInputUtils::CreateOrUpdateReferenceInputMergeNode(WorldIdentifier, ActorHandles, WorldHandle, false)))
+		return false;
+	Identifiers.Add(WorldIdentifier);
+
+	// Moving the selection dirties every actor and the world input, and the upload of each actor reconnects both the
+	// actor's merge and the world input's merge
+	// (BeginBatch / EndBatch are used instead of FUnrealObjectInputBatchScope to get the number of merge rebuilds)
+	int32 NumDeferredReconnects = 0;
+	Manager->BeginBatch();
+	for (const FUnrealObjectInputHandle& ActorHandle : ActorHandles)
+	{
+		Manager->MarkAsDirty(ActorHandle.GetIdentifier(), true);
+		Manager->MarkAsDirty(WorldHandle.GetIdentifier(), true);
+
+		if (FUnrealObjectInputUtils::ConnectReferencedNodesToMerge(ActorHandle.GetIdentifier()))
+			NumDeferredReconnects++;
+		if (FUnrealObjectInputUtils::ConnectReferencedNodesToMerge(WorldHandle.GetIdentifier()))
+			NumDeferredReconnects++;
+	}
+
+	// Reference nodes without HAPI nodes are rejected instead of being deferred
+	UHoudiniAsset* const InvalidObject = NewObject<UHoudiniAsset>(GetTransientPackage());
+	FUnrealObjectInputHandle InvalidHandle;
+	const TSet<FUnrealObjectInputHandle> InvalidReferencedNodes = { LeafHandles[0] };
+	if (TestTrue(TEXT("Reference node without HAPI nodes added"), Manager->AddReferenceNode(InvalidObject, Options, -1, -1, InvalidHandle, &InvalidReferencedNodes)))
+	{
+		Identifiers.Add(InvalidHandle.GetIdentifier());
+		TestFalse(TEXT("Reconnect of a node without HAPI nodes fails in a batch"), FUnrealObjectInputUtils::ConnectReferencedNodesToMerge(InvalidHandle.GetIdentifier()));
+	}
+
+	TestTrue(TEXT("Batch is open"), Manager->IsBatching());
+	const int32 NumMergeRebuilds = Manager->EndBatch();
+
+	TestEqual(TEXT("Deferred reconnects"), NumDeferredReconnects, 2 * NumActors);
+	TestEqual(TEXT("Each merge is rebuilt once"), NumMergeRebuilds, NumActors + 1);
+	TestFalse(TEXT("Batch is closed"), Manager->IsBatching());
+
+	int32 NumDirtyLeaves = 0;
+	for (const FUnrealObjectInputHandle& LeafHandle : LeafHandles)
+	{
+		if (Manager->IsDirty(LeafHandle.GetIdentifier()))
+			NumDirtyLeaves++;
+	}
+	TestEqual(TEXT("All leaves are dirty"), NumDirtyLeaves, NumActors);
+
+	// Without a batch, reconnects are not deferred
+	TestFalse(TEXT("Reconnect is not deferred outside of a batch"), Manager->DeferReferenceNodeReconnect(WorldIdentifier));
+
+	// Release the nodes, referencing nodes first: the manager removes them and deletes their HAPI nodes
+	InvalidHandle.Reset();
+	WorldHandle.Reset();
+	ActorHandles.Empty();
+	LeafHandles.Empty();
+	int32 NumRemainingNodes = 0;
+	for (const FUnrealObjectInputIdentifier& Identifier : Identifiers)
+	{
+		if (Manager->Contains(Identifier))
+			NumRemainingNodes++;
+	}
+	TestEqual(TEXT("The test nodes are removed from the manager"), NumRemainingNodes, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_LandscapeDirtyRegions, "Houdini.Core.Landscape.DirtyRegions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_LandscapeDirtyRegions::RunTest(const FString & Parameters)
+{
+	// A 4k heightfield, compared in regions of 127 quads (the size of a landscape component)
+	const int SizeX = 4033;
+	const int SizeY = 4033;
+	const int RegionSize = 127;
+
+	TArray<uint16> OldData;
+	OldData.Init(32768, SizeX * SizeY);
+	TArray<uint16> NewData = OldData;
+
+	TestEqual(TEXT("Unchanged data has no dirty regions"), FHoudiniLandscapeUtils::GetDirtyRegions(OldData, NewData, SizeX, SizeY, RegionSize).Num(), 0);
+
+	// Simulate a local erosion brush straddling four regions
+	for (int Y = 120; Y < 140; Y++)
+	{
+		for (int X = 250; X < 260; X++)
+			NewData[Y * SizeX + X] += 100;
+	}
+
+	TArray<FIntRect> Regions = FHoudiniLandscapeUtils::GetDirtyRegions(OldData, NewData, SizeX, SizeY, RegionSize);
+	if (!TestEqual(TEXT("Adjacent dirty regions are merged"), Regions.Num(), 1))
+		return false;
+	TestTrue(TEXT("Dirty region"), Regions[0] == FIntRect(127, 0, 381, 254));
+
+	// A change in the last partial region is clamped to the data
+	NewData.Last() += 1;
+	Regions = FHoudiniLandscapeUtils::GetDirtyRegions(OldData, NewData, SizeX, SizeY, RegionSize);
+	if (!TestEqual(TEXT("Separate dirty regions"), Regions.Num(), 2))
+		return false;
+	TestTrue(TEXT("Last dirty region"), Regions[1] == FIntRect(4064 - RegionSize, 4064 - RegionSize, SizeX, SizeY));
+
+	// Only the dirty region is extracted
+	TArray<uint16> RegionData = FHoudiniLandscapeUtils::ExtractRegion(NewData, SizeX, Regions[0]);
+	TestEqual(TEXT("Extracted region size"), RegionData.Num(), Regions[0].Area());
+	TestTrue(TEXT("Extracted region data"), RegionData[(130 - Regions[0].Min.Y) * Regions[0].Width() + (255 - Regions[0].Min.X)] == 32868);
+
+	// Data that can't be compared is entirely dirty
+	OldData.Reset();
+	Regions = FHoudiniLandscapeUtils::GetDirtyRegions(OldData, NewData, SizeX, SizeY, RegionSize);
+	if (TestEqual(TEXT("Mismatching data is dirty"), Regions.Num(), 1))
+		TestTrue(TEXT("Whole region"), Regions[0] == FIntRect(0, 0, SizeX, SizeY));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_LandscapeRegionWriteTiming, "Houdini.Core.Landscape.RegionWriteTiming", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_LandscapeRegionWriteTiming::RunTest(const FString & Parameters)
+{
+	// Times the data prepared for a 4k height layer when a local edit is recooked: the whole layer versus the dirty
+	// regions only, including the cost of comparing with the existing layer data.
+	const int SizeX = 4033;
+	const int SizeY = 4033;
+	const int RegionSize = 127;
+	const int NumIterations = 5;
+
+	TArray<uint16> OldData;
+	OldData.SetNumUninitialized(SizeX * SizeY);
+	for (int Index = 0; Index < OldData.Num(); Index++)
+		OldData[Index] = (uint16)(Index * 7919);
+
+	TArray<uint16> NewData = OldData;
+	for (int Y = 2000; Y < 2100; Y++)
+	{
+		for (int X = 1000; X < 1100; X++)
+			NewData[Y * SizeX + X] += 100;
+	}
+
+	const FIntRect WholeLayer(0, 0, SizeX, SizeY);
+	int64 NumFullSamples = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int Iteration = 0; Iteration < NumIterations; Iteration++)
+		NumFullSamples += FHoudiniLandscapeUtils::ExtractRegion(NewData, SizeX, WholeLayer).Num();
+	const double FullTime = (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+	int64 NumRegionSamples = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		for (const FIntRect& Region : FHoudiniLandscapeUtils::GetDirtyRegions(OldData, NewData, SizeX, SizeY, RegionSize))
+			NumRegionSamples += FHoudiniLandscapeUtils::ExtractRegion(NewData, SizeX, Region).Num();
+	}
+	const double RegionTime = (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+	NumFullSamples /= NumIterations;
+	NumRegionSamples /= NumIterations;
+	AddInfo(FString::Printf(TEXT("Whole layer: %lld samples in %.2f ms. Dirty regions: %lld samples in %.2f ms (including the comparison)."),
+		NumFullSamples, FullTime * 1000.0, NumRegionSamples, RegionTime * 1000.0));
+
+	TestEqual(TEXT("The whole layer is written"), NumFullSamples, (int64)SizeX * SizeY);
+	TestTrue(TEXT("Less than 1% of the layer is written"), NumRegionSamples * 100 < NumFullSamples);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_PackageNameAllocation, "Houdini.Core.Packages.SameNameBakes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_PackageNameAllocation::RunTest(const FString & Parameters)
+{
+	if (!TestTrue(TEXT("Package name allocator is ready"), FHoudiniEngine::Get().GetPackageNameAllocator().IsReady()))
+		return false;
+
+	// Bake the same output name many times in the same folder. The packages are only created in memory.
+	FHoudiniPackageParams PackageParams;
+	PackageParams.PackageMode = EPackageMode::Bake;
+	PackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+	PackageParams.BakeFolder = TEXT("/Temp/HoudiniEngine/Tests/") + FGuid::NewGuid().ToString();
+	PackageParams.ObjectName = TEXT("BakedOutput");
+
+	const int32 NumBakes = 5000;
+	TSet<FString> PackageNames;
+	TArray<UPackage*> Packages;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < NumBakes; Idx++)
+	{
+		FString PackageName;
+		UPackage* Package = PackageParams.CreatePackageForObject(PackageName);
+		if (!TestNotNull(TEXT("Package created"), Package))
+			break;
+		PackageNames.Add(Package->GetName());
+		Packages.Add(Package);
+	}
+	const double Duration = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("Created %d same-named packages in %.3fs"), Packages.Num(), Duration));
+	TestEqual(TEXT("Every bake got a new package"), PackageNames.Num(), NumBakes);
+	TestTrue(TEXT("Last bake counter"), PackageNames.Contains(PackageParams.BakeFolder + FString::Printf(TEXT("/BakedOutput_%d"), NumBakes - 1)));
+
+	// A temp GUID suffix made of digits is not mistaken for a bake counter
+	FHoudiniPackageNameAllocator& NameAllocator = FHoudiniEngine::Get().GetPackageNameAllocator();
+	NameAllocator.AddPackageName(PackageParams.BakeFolder + TEXT("/TempOutput_12345678"), 0);
+	TestEqual(TEXT("Temp GUID suffix is not a bake counter"), NameAllocator.GetNextBakeCounter(PackageParams.BakeFolder + TEXT("/TempOutput"), 0), 1);
+	NameAllocator.AddPackageName(PackageParams.BakeFolder + TEXT("/TempOutput_3"), 3);
+	TestEqual(TEXT("Bake counter is recorded"), NameAllocator.GetNextBakeCounter(PackageParams.BakeFolder + TEXT("/TempOutput"), 0), 4);
+
+	// Destroy the test packages and forget the test folder
+	for (UPackage* Package : Packages)
+	{
+		Package->ClearFlags(RF_Standalone);
+		Package->MarkAsGarbage();
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	FHoudiniEngine::Get().GetPackageNameAllocator().RemoveFolder(PackageParams.BakeFolder);
+
+	int32 NumRemainingPackages = 0;
+	for (const FString& PackageName : PackageNames)
+	{
+		if (FindPackage(nullptr, *PackageName))
+			NumRemainingPackages++;
+	}
+	TestEqual(TEXT("The test packages are destroyed"), NumRemainingPackages, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_DirtyComponents, "Houdini.Core.Manager.DirtyComponents", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_DirtyComponents::RunTest(const FString & Parameters)
+{
+	if (!TestTrue(TEXT("Runtime is initialized"), FHoudiniEngineRuntime::IsInitialized()))
+		return false;
+
+	// Parameters and inputs notify the global runtime, so use it with our own manager. The manager does not tick during
+	// the test: the HACs of the editor that were dirty are flagged again at the end, and only our HACs are counted.
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+	FHoudiniEngineManager Manager;
+	const TArray<UHoudiniAssetComponent*> PreviouslyDirty = Runtime.ConsumeDirtyHoudiniComponents();
+
+	// Register a large number of idle HACs
+	const int32 NumComponents = 1000;
+	TArray<UHoudiniAssetComponent*> HACs;
+	for (int32 Idx = 0; Idx < NumComponents; Idx++)
+	{
+		UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+		HAC->AddToRoot();
+		HAC->SetAssetState(EHoudiniAssetState::None);
+		Runtime.RegisterHoudiniComponent(HAC);
+		HACs.Add(HAC);
+	}
+	const TSet<UHoudiniAssetComponent*> TestHACs(HACs);
+
+	// Returns our HACs that an event driven tick would process
+	auto Gather = [&Runtime, &Manager, &TestHACs]()
+	{
+		TArray<UHoudiniAssetComponent*> ComponentsToProcess;
+		TArray<UHoudiniAssetComponent*> ComponentsToRevisit;
+		Manager.GatherComponentsToProcess(Runtime, true, ComponentsToProcess, ComponentsToRevisit);
+		TSet<UHoudiniAssetComponent*> Gathered(ComponentsToProcess);
+		Gathered.Append(ComponentsToRevisit);
+		return Gathered.Intersect(TestHACs);
+	};
+
+	// Newly registered HACs are dirty until they have been looked at once
+	TestEqual(TEXT("Registered HACs are processed once"), Gather().Num(), NumComponents);
+
+	// Nothing changed: an idle tick only polls the "current" HAC
+	TestTrue(TEXT("An idle tick only processes the current HAC"), Gather().Num() <= 1);
+
+	// Changing a parameter value only flags its HAC
+	UHoudiniAssetComponent* ParameterHAC = HACs[NumComponents / 2];
+	UHoudiniParameterFloat* Parameter = UHoudiniParameterFloat::Create(ParameterHAC, TEXT("TestParameter"));
+	Parameter->SetNumberOfValues(1);
+	Parameter->SetValueAt(1.0f, 0);
+	Parameter->MarkChanged(true);
+
+	TSet<UHoudiniAssetComponent*> Gathered = Gather();
+	TestTrue(TEXT("A tick after a parameter change processes its HAC"), Gathered.Contains(ParameterHAC));
+	TestTrue(TEXT("A tick after a parameter change only processes its HAC and the current HAC"), Gathered.Num() <= 2);
+
+	// Changing an input only flags its HAC
+	UHoudiniAssetComponent* InputHAC = HACs[NumComponents / 4];
+	UHoudiniInput* Input = NewObject<UHoudiniInput>(InputHAC);
+	InputHAC->GetInputs().Add(Input);
+	Input->MarkChanged(true);
+
+	Gathered = Gather();
+	TestTrue(TEXT("A tick after an input change processes its HAC"), Gathered.Contains(InputHAC));
+	TestTrue(TEXT("A tick after an input change only processes its HAC and the current HAC"), Gathered.Num() <= 2);
+
+	// World inputs are not notified of the changes made to their actors, so their HAC is polled on every tick
+	bool bBlueprintStructureModified = false;
+	Input->SetInputType(EHoudiniInputType::World, bBlueprintStructureModified);
+	Gather();
+	Gathered = Gather();
+	TestTrue(TEXT("A HAC with a world input is polled on idle ticks"), Gathered.Contains(InputHAC));
+	TestTrue(TEXT("Only the HAC with a world input and the current HAC are polled"), Gathered.Num() <= 2);
+
+	// Unregistered HACs are not flagged anymore
+	Runtime.UnRegisterHoudiniComponent(ParameterHAC);
+	Parameter->MarkChanged(true);
+	TestFalse(TEXT("Unregistered HACs are not dirty"), Runtime.ConsumeDirtyHoudiniComponents().Contains(ParameterHAC));
+
+	for (UHoudiniAssetComponent* HAC : HACs)
+	{
+		Runtime.UnRegisterHoudiniComponent(HAC);
+		HAC->RemoveFromRoot();
+	}
+
+	for (UHoudiniAssetComponent* HAC : PreviouslyDirty)
+		Runtime.MarkHoudiniComponentDirty(HAC);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_FoliageBatch, "Houdini.Core.Foliage.BatchSpawnAndRemove", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_FoliageBatch::RunTest(const FString & Parameters)
+{
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube mesh loaded"), Mesh))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("World created"), World))
+		return false;
+
+	UFoliageType_InstancedStaticMesh* FoliageType = NewObject<UFoliageType_InstancedStaticMesh>(GetTransientPackage());
+	FoliageType->SetStaticMesh(Mesh);
+
+	const int32 NumInstances = 100000;
+	FRandomStream Random(1234);
+	TArray<FFoliageInstance> Instances;
+	Instances.SetNum(NumInstances);
+	for (FFoliageInstance& Instance : Instances)
+		Instance.Location = FVector(Random.FRandRange(-100000.0, 100000.0), Random.FRandRange(-100000.0, 100000.0), 0.0);
+
+	double StartTime = FPlatformTime::Seconds();
+	FHoudiniFoliageTools::SpawnFoliageInstances(World, FoliageType, Instances, {});
+	AddInfo(FString::Printf(TEXT("Spawned %d foliage instances in %.3fs"), NumInstances, FPlatformTime::Seconds() - StartTime));
+
+	TestEqual(TEXT("All instances spawned"), FHoudiniFoliageTools::GetAllFoliageInstances(World, FoliageType).Num(), NumInstances);
+
+	// Remove every other instance
+	TArray<FVector3d> Positions;
+	for (int32 Idx = 0; Idx < NumInstances; Idx += 2)
+		Positions.Add(Instances[Idx].Location);
+
+	StartTime = FPlatformTime::Seconds();
+	FHoudiniFoliageTools::RemoveFoliageInstances(World, FoliageType, Positions);
+	AddInfo(FString::Printf(TEXT("Removed %d foliage instances in %.3fs"), Positions.Num(), FPlatformTime::Seconds() - StartTime));
+
+	TestEqual(TEXT("Half the instances removed"), FHoudiniFoliageTools::GetAllFoliageInstances(World, FoliageType).Num(), NumInstances - Positions.Num());
+
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_SplitInstancerUpdate, "Houdini.Core.Instancer.SplitInstancerUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_SplitInstancerUpdate::RunTest(const FString & Parameters)
+{
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube mesh loaded"), Mesh))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("World created"), World))
+		return false;
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	UHoudiniMeshSplitInstancerComponent* MSIC = NewObject<UHoudiniMeshSplitInstancerComponent>(Actor);
+	Actor->SetRootComponent(MSIC);
+	MSIC->RegisterComponent();
+	MSIC->SetStaticMesh(Mesh);
+
+	const int32 NumInstances = 10000;
+	TArray<FTransform> Transforms;
+	Transforms.SetNum(NumInstances);
+	for (int32 Idx = 0; Idx < NumInstances; Idx++)
+		Transforms[Idx].SetLocation(FVector(Idx * 100.0, 0.0, 0.0));
+
+	// First update creates all the components
+	double StartTime = FPlatformTime::Seconds();
+	TestTrue(TEXT("Instances created"), MSIC->SetInstanceTransforms(Transforms));
+	AddInfo(FString::Printf(TEXT("Created %d split instances in %.3fs"), NumInstances, FPlatformTime::Seconds() - StartTime));
+	TestEqual(TEXT("One component per instance"), MSIC->GetInstances().Num(), NumInstances);
+
+	// Same mesh/materials, only the transforms change: the components are updated in place
+	TArray<UStaticMeshComponent*> PreviousInstances = MSIC->GetInstances();
+	for (FTransform& Transform : Transforms)
+		Transform.AddToTranslation(FVector(0.0, 0.0, 50.0));
+
+	StartTime = FPlatformTime::Seconds();
+	TestTrue(TEXT("Instances updated"), MSIC->SetInstanceTransforms(Transforms));
+	AddInfo(FString::Printf(TEXT("Updated %d split instances in %.3fs"), NumInstances, FPlatformTime::Seconds() - StartTime));
+
+	TestTrue(TEXT("Components reused"), PreviousInstances == MSIC->GetInstances());
+	TestTrue(TEXT("Transforms updated"), MSIC->GetInstances().Last()->GetRelativeTransform().Equals(Transforms.Last()));
+	TestTrue(TEXT("Components registered"), MSIC->GetInstances()[0]->IsRegistered());
+
+	// Unchanged update
+	StartTime = FPlatformTime::Seconds();
+	MSIC->SetInstanceTransforms(Transforms);
+	AddInfo(FString::Printf(TEXT("Unchanged update of %d split instances in %.3fs"), NumInstances, FPlatformTime::Seconds() - StartTime));
+
+	MSIC->ClearInstances(0);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_InstancedActorPool, "Houdini.Core.Instancer.InstancedActorPool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_InstancedActorPool::RunTest(const FString & Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("World created"), World))
+		return false;
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	UHoudiniInstancedActorComponent* IAC = NewObject<UHoudiniInstancedActorComponent>(Actor);
+	Actor->SetRootComponent(IAC);
+	IAC->RegisterComponent();
+
+	const int32 NumInstances = 5000;
+	UObject* ObjectA = AStaticMeshActor::StaticClass();
+	UObject* ObjectB = AActor::StaticClass();
+
+	// Simulates the instanced actor part of a cook: switch the instanced object, then fill all the instances
+	auto Recook = [&](UObject* InObject, bool bUsePool)
+	{
+		if (bUsePool)
+			IAC->ReleaseAllInstancesToPool();
+		else
+			IAC->ClearAllInstances();
+
+		IAC->SetInstancedObject(InObject);
+		IAC->SetNumberOfInstances(NumInstances, bUsePool);
+		for (int32 Idx = 0; Idx < NumInstances; Idx++)
+		{
+			const FTransform Transform(FVector(Idx * 100.0, 0.0, 0.0));
+			AActor* Instance = bUsePool ? IAC->AcquirePooledActor() : nullptr;
+			if (!Instance)
+				Instance = World->SpawnActor<AActor>(CastChecked<UClass>(InObject));
+			IAC->SetInstanceAt(Idx, Transform, Instance);
+		}
+		IAC->TrimPool(NumInstances);
+	};
+
+	for (bool bUsePool : { false, true })
+	{
+		Recook(ObjectA, bUsePool);
+		Recook(ObjectB, bUsePool);
+
+		// Switching back to the first object: with pooling, no actor should be spawned
+		const double StartTime = FPlatformTime::Seconds();
+		Recook(ObjectA, bUsePool);
+		AddInfo(FString::Printf(TEXT("Recook of %d instanced actors %s pooling: %.3fs"), NumInstances, bUsePool ? TEXT("with") : TEXT("without"), FPlatformTime::Seconds() - StartTime));
+
+		TestEqual(TEXT("All instances set"), IAC->GetInstancedActors().Num(), NumInstances);
+		TestTrue(TEXT("Instances are of the right class"), IAC->GetInstancedActors().Last()->IsA(AStaticMeshActor::StaticClass()));
+		if (bUsePool)
+		{
+			TestEqual(TEXT("Unused actors are pooled"), IAC->GetNumPooledActors(), NumInstances);
+			TestFalse(TEXT("Reused actors are visible"), IAC->GetInstancedActors()[0]->IsHidden());
+		}
+	}
+
+	// The pool restores the visibility and collision the actors had when they were released
+	AActor* HiddenInstance = IAC->GetInstancedActors().Last();
+	HiddenInstance->SetActorHiddenInGame(true);
+	HiddenInstance->SetActorEnableCollision(false);
+	IAC->ReleaseAllInstancesToPool();
+	TestNull(TEXT("Pooled actors are detached"), HiddenInstance->GetAttachParentActor());
+	TestTrue(TEXT("Pooled actors are hidden in game"), HiddenInstance->IsHidden());
+
+	AActor* ReusedInstance = IAC->AcquirePooledActor();
+	TestEqual(TEXT("The last released actor is reused first"), ReusedInstance, HiddenInstance);
+	TestTrue(TEXT("Reused actors stay hidden in game"), ReusedInstance->IsHidden());
+	TestFalse(TEXT("Reused actors keep their collision disabled"), ReusedInstance->GetActorEnableCollision());
+
+	AActor* VisibleInstance = IAC->AcquirePooledActor();
+	TestFalse(TEXT("Other reused actors are visible"), VisibleInstance->IsHidden());
+	TestTrue(TEXT("Other reused actors have collision"), VisibleInstance->GetActorEnableCollision());
+	World->DestroyActor(ReusedInstance);
+	World->DestroyActor(VisibleInstance);
+
+	// Shrinking the instance count keeps the extra actors in the pool
+	IAC->SetNumberOfInstances(NumInstances / 2, true);
+	TestEqual(TEXT("Instance count reduced"), IAC->GetInstancedActors().Num(), NumInstances / 2);
+	IAC->TrimPool(0);
+	TestEqual(TEXT("Pool emptied"), IAC->GetNumPooledActors(), 0);
+
+	IAC->ClearAllInstances();
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_PDGImportBudget, "Houdini.Core.PDG.ImportBudget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_PDGImportBudget::RunTest(const FString & Parameters)
+{
+	// Simulate a flood of work item results against a stand-in commandlet that completes a few imports per tick
+	const int32 NumResults = 10000;
+	const int64 MaxBytesPerTick = 64 * 1024 * 1024;
+	const int64 MaxResultSize = 4 * 1024 * 1024;
+	const int32 MaxInFlight = 32;
+	const int32 CompletedPerTick = 20;
+
+	FRandomStream Random(42);
+	TArray<int64> PendingResults;
+	PendingResults.SetNum(NumResults);
+	for (int64& Size : PendingResults)
+		Size = Random.RandRange(0, MaxResultSize);
+
+	int32 NumInFlight = 0;
+	int32 NumImported = 0;
+	int32 NumTicks = 0;
+	int32 MaxImportsInATick = 0;
+	int64 MaxBytesInATick = 0;
+	int32 MaxObservedInFlight = 0;
+	while ((PendingResults.Num() > 0 || NumInFlight > 0) && NumTicks < 100000)
+	{
+		NumTicks++;
+
+		// The commandlet sends results back
+		const int32 NumCompleted = FMath::Min(NumInFlight, CompletedPerTick);
+		NumInFlight -= NumCompleted;
+		NumImported += NumCompleted;
+
+		FHoudiniPDGImportBudget Budget(0.0, MaxBytesPerTick, MaxInFlight, NumInFlight);
+		while (PendingResults.Num() > 0 && Budget.CanStartImport())
+		{
+			Budget.AddImport(PendingResults.Pop(), true);
+		}
+
+		NumInFlight = Budget.GetNumInFlight();
+		MaxImportsInATick = FMath::Max(MaxImportsInATick, Budget.GetNumImports());
+		MaxBytesInATick = FMath::Max(MaxBytesInATick, Budget.GetNumBytes());
+		MaxObservedInFlight = FMath::Max(MaxObservedInFlight, NumInFlight);
+	}
+
+	AddInfo(FString::Printf(TEXT("Imported %d results in %d ticks, at most %d imports / %lld bytes per tick"), NumImported, NumTicks, MaxImportsInATick, MaxBytesInATick));
+
+	TestEqual(TEXT("All results imported"), NumImported, NumResults);
+	TestTrue(TEXT("In flight imports are bounded"), MaxObservedInFlight <= MaxInFlight);
+	TestTrue(TEXT("Bytes per tick are bounded"), MaxBytesInATick < MaxBytesPerTick + MaxResultSize);
+
+	// Without a commandlet, the first import of a tick is always allowed, even when over the size budget
+	FHoudiniPDGImportBudget SyncBudget(0.0, 1, 0, 0);
+	TestTrue(TEXT("First import allowed"), SyncBudget.CanStartImport());
+	SyncBudget.AddImport(MaxResultSize, false);
+	TestFalse(TEXT("Next import deferred"), SyncBudget.CanStartImport());
+
+	// Drive the PDG manager with stand-in work items, and a stand-in commandlet that only records the import messages
+	IConsoleVariable* MaxImportsCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.PDGMaxCommandletImports"));
+	if (!TestNotNull(TEXT("Max commandlet imports CVar"), MaxImportsCVar))
+		return false;
+	const int32 PreviousMaxImports = MaxImportsCVar->GetInt();
+	MaxImportsCVar->Set(4, ECVF_SetByCode);
+	ON_SCOPE_EXIT { MaxImportsCVar->Set(PreviousMaxImports, ECVF_SetByCode); };
+
+	UHoudiniPDGAssetLink* AssetLink = NewObject<UHoudiniPDGAssetLink>(GetTransientPackage());
+	AssetLink->AddToRoot();
+	ON_SCOPE_EXIT { AssetLink->RemoveFromRoot(); };
+
+	UTOPNetwork* TOPNetwork = NewObject<UTOPNetwork>(AssetLink);
+	TOPNetwork->NodeId = 100;
+	TOPNetwork->NodeName = TEXT("topnet");
+	UTOPNode* TOPNode = NewObject<UTOPNode>(TOPNetwork);
+	TOPNode->NodeId = 101;
+	TOPNode->NodeName = TEXT("geometry");
+	TOPNetwork->AllTOPNodes.Add(TOPNode);
+	AssetLink->AllTOPNetworks.Add(TOPNetwork);
+
+	const int32 NumWorkItems = 10;
+	for (int32 Idx = 0; Idx < NumWorkItems; Idx++)
+	{
+		FTOPWorkResult& WorkResult = TOPNode->WorkResult.AddDefaulted_GetRef();
+		WorkResult.WorkItemIndex = Idx;
+		WorkResult.WorkItemID = 1000 + Idx;
+
+		FTOPWorkResultObject& ResultObject = WorkResult.ResultObjects.AddDefaulted_GetRef();
+		ResultObject.Name = FString::Printf(TEXT("result_%d"), Idx);
+		ResultObject.FilePath = FPaths::ProjectIntermediateDir() / FString::Printf(TEXT("HoudiniEngine/Tests/result_%d.bgeo.sc"), Idx);
+		ResultObject.State = EPDGWorkResultState::ToLoad;
+	}
+
+	FHoudiniPDGManager PDGManager;
+	PDGManager.PDGAssetLinks.Add(AssetLink);
+
+	TArray<TUniquePtr<FHoudiniPDGImportBGEOMessage>> SentMessages;
+	auto Tick = [&PDGManager, &SentMessages]()
+	{
+		const int32 NumSent = SentMessages.Num();
+		PDGManager.ImportWorkItemResults(true, [&SentMessages](FHoudiniPDGImportBGEOMessage* InMessage)
+		{
+			SentMessages.Emplace(InMessage);
+		});
+		return SentMessages.Num() - NumSent;
+	};
+
+	auto CountResults = [TOPNode](const EPDGWorkResultState& InState)
+	{
+		int32 Count = 0;
+		for (const FTOPWorkResult& WorkResult : TOPNode->WorkResult)
+			Count += WorkResult.ResultObjects[0].State == InState ? 1 : 0;
+		return Count;
+	};
+
+	// Returns the commandlet's reply to a sent import message
+	auto MakeResult = [](const FHoudiniPDGImportBGEOMessage& InSent, const EHoudiniPDGImportBGEOResult& InResult)
+	{
+		FHoudiniPDGImportBGEOResultMessage Result;
+		static_cast<FHoudiniPDGImportBGEOMessage&>(Result) = InSent;
+		Result.ImportResult = InResult;
+		return Result;
+	};
+
+	TestEqual(TEXT("A tick sends as many imports as the commandlet can have in flight"), Tick(), 4);
+	TestEqual(TEXT("Imports in flight"), PDGManager.NumCommandletImportsInFlight, 4);
+	TestEqual(TEXT("Sent results are loading"), CountResults(EPDGWorkResultState::Loading), 4);
+	TestEqual(TEXT("Other results wait"), CountResults(EPDGWorkResultState::ToLoad), NumWorkItems - 4);
+	if (!TestTrue(TEXT("Messages identify the work items"), SentMessages[0]->TOPNodeId == 101 && SentMessages[0]->WorkItemId == 1000))
+		return false;
+
+	TestEqual(TEXT("Nothing is sent while the commandlet is busy"), Tick(), 0);
+
+	// Two imports complete: one failed, one for a TOP node that is gone
+	AddExpectedError(TEXT("Commandlet failed to import bgeo"), EAutomationExpectedErrorFlags::Contains, 0);
+	AddExpectedError(TEXT("Failed to find TOP node with id 999"), EAutomationExpectedErrorFlags::Contains, 1);
+	PDGManager.HandleImportBGEOResult(MakeResult(*SentMessages[0], EHoudiniPDGImportBGEOResult::HPIBR_Failed));
+	FHoudiniPDGImportBGEOResultMessage UnknownNodeResult = MakeResult(*SentMessages[1], EHoudiniPDGImportBGEOResult::HPIBR_Success);
+	UnknownNodeResult.TOPNodeId = 999;
+	PDGManager.HandleImportBGEOResult(UnknownNodeResult);
+	TestEqual(TEXT("Completed imports are no longer in flight"), PDGManager.NumCommandletImportsInFlight, 2);
+
+	TestEqual(TEXT("The next tick fills the freed slots"), Tick(), 2);
+	TestEqual(TEXT("Imports in flight after refill"), PDGManager.NumCommandletImportsInFlight, 4);
+	TestEqual(TEXT("Remaining results wait"), CountResults(EPDGWorkResultState::ToLoad), NumWorkItems - 6);
+
+	// Replies to imports that are no longer in flight are ignored
+	for (int32 Idx = 2; Idx < SentMessages.Num(); Idx++)
+		PDGManager.HandleImportBGEOResult(MakeResult(*SentMessages[Idx], EHoudiniPDGImportBGEOResult::HPIBR_Failed));
+	PDGManager.HandleImportBGEOResult(MakeResult(*SentMessages[0], EHoudiniPDGImportBGEOResult::HPIBR_Failed));
+	TestEqual(TEXT("Extra results don't make the in flight count negative"), PDGManager.NumCommandletImportsInFlight, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_ParameterValueRuns, "Houdini.Core.Parameters.LoadedValueRuns", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_ParameterValueRuns::RunTest(const FString & Parameters)
+{
+	TBitArray<> Dirty(false, 16);
+	TestEqual(TEXT("No runs when nothing changed"), FHoudiniParameterTranslator::GetDirtyValueRuns(Dirty).Num(), 0);
+
+	// [0, 3) [5, 6) [10, 16)
+	Dirty.SetRange(0, 3, true);
+	Dirty[5] = true;
+	Dirty.SetRange(10, 6, true);
+
+	const TArray<FIntPoint> Runs = FHoudiniParameterTranslator::GetDirtyValueRuns(Dirty);
+	if (!TestEqual(TEXT("Three runs"), Runs.Num(), 3))
+		return false;
+
+	TestTrue(TEXT("First run"), Runs[0] == FIntPoint(0, 3));
+	TestTrue(TEXT("Second run"), Runs[1] == FIntPoint(5, 1));
+	TestTrue(TEXT("Last run reaches the end"), Runs[2] == FIntPoint(10, 6));
+
+	// A parameter heavy HDA where most values are left to their defaults only needs a few calls
+	const int32 NumValues = 10000;
+	TBitArray<> SparseDirty(false, NumValues);
+	for (int32 Idx = 0; Idx < NumValues; Idx += 100)
+		SparseDirty.SetRange(Idx, 3, true);
+
+	TestEqual(TEXT("One call per modified tuple"), FHoudiniParameterTranslator::GetDirtyValueRuns(SparseDirty).Num(), NumValues / 100);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_IndexedStringAttributes, "Houdini.Core.Strings.IndexedStringAttributes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_IndexedStringAttributes::RunTest(const FString & Parameters)
+{
+	// Mimic landscape spline point attributes: mostly empty strings with a few repeated layer names / mesh paths
+	const int32 NumPoints = 10000;
+	TArray<FString> Values;
+	Values.SetNum(NumPoints);
+	for (int32 Idx = 0; Idx < NumPoints; Idx += 10)
+		Values[Idx] = FString::Printf(TEXT("/Game/Meshes/Road_%d.Road_%d"), Idx % 3, Idx % 3);
+
+	FHoudiniEngineIndexedStringMap IndexedStrings;
+	IndexedStrings.SetStrings(Values);
+
+	TestEqual(TEXT("One index per value"), IndexedStrings.GetIds().Num(), NumPoints);
+	TestEqual(TEXT("Only unique strings are stored"), IndexedStrings.GetNumUniqueStrings(), 4);
+
+	bool bAllEqual = true;
+	for (int32 Idx = 0; Idx < NumPoints; Idx++)
+		bAllEqual &= IndexedStrings.GetStringForIndex(Idx) == Values[Idx];
+	TestTrue(TEXT("Indexed values match the input"), bAllEqual);
+
+	// Setting new values replaces the previous content
+	IndexedStrings.SetStrings({ TEXT("a"), TEXT("b"), TEXT("a") });
+	TestEqual(TEXT("Previous ids are discarded"), IndexedStrings.GetIds().Num(), 3);
+	TestEqual(TEXT("Previous strings are discarded"), IndexedStrings.GetNumUniqueStrings(), 2);
+	TestEqual(TEXT("Repeated value"), IndexedStrings.GetStringForIndex(2), FString(TEXT("a")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_SplineSampling, "Houdini.Core.Splines.Sampling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_SplineSampling::RunTest(const FString & Parameters)
+{
+	USplineComponent* SplineComponent = NewObject<USplineComponent>();
+	SplineComponent->SetSplinePoints(
+		{ FVector(0, 0, 0), FVector(500, 200, 0), FVector(900, -300, 100), FVector(1500, 0, 50) },
+		ESplineCoordinateSpace::Local);
+
+	const float SplineResolution = 50.0f;
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Scales;
+	TestTrue(TEXT("Spline sampled"), FUnrealSplineTranslator::SampleSplineComponent(SplineComponent, SplineResolution, Positions, Rotations, Scales));
+
+	const int32 NumSamples = FMath::CeilToInt(SplineComponent->GetSplineLength() / SplineResolution) + 1;
+	TestEqual(TEXT("One sample per resolution step"), Positions.Num(), NumSamples);
+	TestEqual(TEXT("One rotation per sample"), Rotations.Num(), NumSamples);
+	TestEqual(TEXT("One scale per sample"), Scales.Num(), NumSamples);
+
+	// The forward walk must match the per-sample distance lookups
+	bool bAllMatch = true;
+	float Distance = 0.0f;
+	for (int32 Idx = 0; Idx < Positions.Num(); Idx++, Distance += SplineResolution)
+	{
+		bAllMatch &= Positions[Idx].Equals(SplineComponent->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::Local), 0.01);
+		bAllMatch &= Rotations[Idx].Equals(SplineComponent->GetQuaternionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World), 0.0001);
+		bAllMatch &= Scales[Idx].Equals(SplineComponent->GetScaleAtDistanceAlongSpline(Distance), 0.0001);
+	}
+	TestTrue(TEXT("Samples match the distance lookups"), bAllMatch);
+
+	// Moving a point invalidates the cached samples
+	SplineComponent->SetLocationAtSplinePoint(3, FVector(3000, 0, 50), ESplineCoordinateSpace::Local);
+	TArray<FVector> NewPositions;
+	FUnrealSplineTranslator::SampleSplineComponent(SplineComponent, SplineResolution, NewPositions, Rotations, Scales);
+	TestTrue(TEXT("Samples are recomputed when the spline changes"), NewPositions.Num() > Positions.Num());
+	TestTrue(TEXT("Last sample follows the moved point"), NewPositions.Last().X > Positions.Last().X);
+
+	// The cache never grows past its maximum size
+	IConsoleVariable* CacheSizeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.SplineSamplesCacheSize"));
+	TestNotNull(TEXT("Cache size CVar registered"), CacheSizeCVar);
+	if (CacheSizeCVar)
+	{
+		const int32 PreviousCacheSize = CacheSizeCVar->GetInt();
+		CacheSizeCVar->Set(4, ECVF_SetByCode);
+
+		FUnrealSplineTranslator::ClearSplineSamplesCache();
+		bool bWithinLimit = true;
+		for (int32 Idx = 0; Idx < 10; Idx++)
+		{
+			USplineComponent* OtherSpline = NewObject<USplineComponent>();
+			FUnrealSplineTranslator::SampleSplineComponent(OtherSpline, SplineResolution, NewPositions, Rotations, Scales);
+			bWithinLimit &= FUnrealSplineTranslator::GetNumCachedSplineSamples() <= 4;
+		}
+		TestTrue(TEXT("Cache stays within its maximum size"), bWithinLimit);
+
+		CacheSizeCVar->Set(PreviousCacheSize, ECVF_SetByCode);
+	}
+
+	FUnrealSplineTranslator::ClearSplineSamplesCache();
+	TestEqual(TEXT("Cache cleared"), FUnrealSplineTranslator::GetNumCachedSplineSamples(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_LandscapeTiledExport, "Houdini.Core.Landscape.TiledHeightExport", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_LandscapeTiledExport::RunTest(const FString & Parameters)
+{
+	// Generate a landscape's height data, laid out as returned by GetHeightDataFast
+	const int32 XSize = 1009;
+	const int32 YSize = 505;
+	TArray<uint16> HeightData;
+	HeightData.SetNumUninitialized(XSize * YSize);
+	for (int32 Y = 0; Y < YSize; Y++)
+	{
+		for (int32 X = 0; X < XSize; X++)
+			HeightData[X + Y * XSize] = (uint16)((X * 37 + Y * 11) % UINT16_MAX);
+	}
+
+	const FTransform LandscapeTransform(FQuat::Identity, FVector::ZeroVector, FVector(100.0, 100.0, 50.0));
+
+	TArray<float> FullValues;
+	HAPI_VolumeInfo FullVolumeInfo;
+	FVector CenterOffset = FVector::ZeroVector;
+	TestTrue(TEXT("Whole landscape converted"), FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
+		HeightData, XSize, YSize, FVector::ZeroVector, FVector::ZeroVector, LandscapeTransform, FullValues, FullVolumeInfo, CenterOffset));
+
+	HAPI_VolumeInfo TiledVolumeInfo;
+	TestTrue(TEXT("Volume info created"), FUnrealLandscapeTranslator::GetHeightfieldVolumeInfo(XSize, YSize, LandscapeTransform, TiledVolumeInfo));
+	TestEqual(TEXT("Same volume width"), TiledVolumeInfo.xLength, FullVolumeInfo.xLength);
+	TestEqual(TEXT("Same volume height"), TiledVolumeInfo.yLength, FullVolumeInfo.yLength);
+
+	// Convert the landscape in tiles of columns, that don't divide the landscape evenly
+	const int32 TileXSize = 64;
+	TArray<float> TiledValues;
+	TiledValues.SetNumZeroed(XSize * YSize);
+	TArray<uint16> TileData;
+	for (int32 TileMinX = 0; TileMinX < XSize; TileMinX += TileXSize)
+	{
+		const int32 CurTileXSize = FMath::Min(TileXSize, XSize - TileMinX);
+		TileData.SetNumUninitialized(CurTileXSize * YSize);
+		for (int32 Y = 0; Y < YSize; Y++)
+		{
+			for (int32 X = 0; X < CurTileXSize; X++)
+				TileData[X + Y * CurTileXSize] = HeightData[TileMinX + X + Y * XSize];
+		}
+
+		FUnrealLandscapeTranslator::ConvertLandscapeTileToHeightfieldData(
+			TileData.GetData(), CurTileXSize, YSize, LandscapeTransform, &TiledValues[TileMinX * YSize]);
+	}
+
+	TestTrue(TEXT("Tiles match the whole landscape conversion"), TiledValues == FullValues);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_HapiInfoCache, "Houdini.Core.Outputs.HapiInfoCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_HapiInfoCache::RunTest(const FString & Parameters)
+{
+	// Simulate a cooked asset with a single geo node and several parts, and count the queries sent to Houdini
+	const HAPI_NodeId GeoId = 42;
+	const int32 NumParts = 8;
+	const TArray<FString> AttributeNames = { TEXT("P"), TEXT("N"), TEXT("uv"), TEXT("Cd"), TEXT("unreal_material") };
+
+	int32 CookCount = 1;
+	int32 NumSentQueries = 0;
+
+	FHoudiniHapiInfoCache::FQueries Queries;
+	Queries.GetCookCount = [&](const HAPI_NodeId&, int32& OutCookCount)
+	{
+		NumSentQueries++;
+		OutCookCount = CookCount;
+		return HAPI_RESULT_SUCCESS;
+	};
+	Queries.GetGeoInfo = [&](const HAPI_NodeId& NodeId, HAPI_GeoInfo& OutGeoInfo)
+	{
+		NumSentQueries++;
+		FMemory::Memzero(OutGeoInfo);
+		OutGeoInfo.nodeId = NodeId;
+		OutGeoInfo.partCount = NumParts;
+		return HAPI_RESULT_SUCCESS;
+	};
+	Queries.GetPartInfo = [&](const HAPI_NodeId&, const HAPI_PartId& PartId, HAPI_PartInfo& OutPartInfo)
+	{
+		NumSentQueries++;
+		FMemory::Memzero(OutPartInfo);
+		OutPartInfo.id = PartId;
+		OutPartInfo.pointCount = 100 * CookCount;
+		OutPartInfo.attributeCounts[HAPI_ATTROWNER_POINT] = AttributeNames.Num();
+		return HAPI_RESULT_SUCCESS;
+	};
+	Queries.GetAttributeInfo = [&](const HAPI_NodeId&, const HAPI_PartId&, const char*, const HAPI_AttributeOwner& Owner, HAPI_AttributeInfo& OutAttributeInfo)
+	{
+		NumSentQueries++;
+		FMemory::Memzero(OutAttributeInfo);
+		OutAttributeInfo.exists = Owner == HAPI_ATTROWNER_POINT;
+		OutAttributeInfo.owner = Owner;
+		return HAPI_RESULT_SUCCESS;
+	};
+	Queries.GetAttributeNames = [&](const HAPI_NodeId&, const HAPI_PartId&, const HAPI_AttributeOwner&, const int32& Count, TArray<FString>& OutAttributeNames)
+	{
+		NumSentQueries++;
+		OutAttributeNames = AttributeNames;
+		OutAttributeNames.SetNum(Count);
+		return HAPI_RESULT_SUCCESS;
+	};
+
+	// Mimic an output pass: the output translator and the mesh translator query the same infos several times per part
+	auto RunOutputPass = [&](FHoudiniHapiInfoCache& Cache)
+	{
+		HAPI_GeoInfo GeoInfo;
+		Cache.GetGeoInfo(GeoId, GeoInfo);
+		for (int32 PartId = 0; PartId < NumParts; PartId++)
+		{
+			HAPI_PartInfo PartInfo;
+			for (int32 Pass = 0; Pass < 3; Pass++)
+				Cache.GetPartInfo(GeoId, PartId, PartInfo);
+
+			TArray<FString> Names;
+			Cache.GetAttributeNames(GeoId, PartId, HAPI_ATTROWNER_POINT, Names);
+			Cache.GetAttributeNames(GeoId, PartId, HAPI_ATTROWNER_POINT, Names);
+
+			for (const FString& Name : Names)
+			{
+				HAPI_AttributeInfo AttributeInfo;
+				for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; Owner++)
+					Cache.GetAttributeInfo(GeoId, PartId, TCHAR_TO_UTF8(*Name), (HAPI_AttributeOwner)Owner, AttributeInfo);
+				Cache.GetAttributeInfo(GeoId, PartId, TCHAR_TO_UTF8(*Name), HAPI_ATTROWNER_POINT, AttributeInfo);
+			}
+		}
+	};
+
+	FHoudiniHapiInfoCache Cache(Queries);
+	RunOutputPass(Cache);
+
+	// One cook count, one geo info, and for each part: one part info, one attribute name list and one info per attribute/owner
+	const int32 NumUniqueQueries = 2 + NumParts * (2 + AttributeNames.Num() * HAPI_ATTROWNER_MAX);
+	const int32 NumUncachedQueries = 1 + NumParts * (3 + 2 * 2 + AttributeNames.Num() * (HAPI_ATTROWNER_MAX + 1));
+	TestEqual(TEXT("Each info is only queried once"), NumSentQueries, NumUniqueQueries);
+	TestTrue(TEXT("Fewer queries than without the cache"), NumSentQueries < NumUncachedQueries);
+	TestEqual(TEXT("Queries sent by the cache"), Cache.GetNumQueries(), NumSentQueries);
+
+	// A cook that didn't change the node only costs a cook count query
+	NumSentQueries = 0;
+	Cache.Invalidate();
+	RunOutputPass(Cache);
+	TestEqual(TEXT("Unchanged node keeps its infos"), NumSentQueries, 1);
+
+	// Once the node has been recooked, its infos are queried again
+	NumSentQueries = 0;
+	CookCount++;
+	Cache.Invalidate();
+	HAPI_PartInfo PartInfo;
+	Cache.GetPartInfo(GeoId, 0, PartInfo);
+	TestEqual(TEXT("Recooked node's part info is updated"), PartInfo.pointCount, 200);
+	RunOutputPass(Cache);
+	TestEqual(TEXT("Recooked node's infos are queried again"), NumSentQueries, NumUniqueQueries);
+
+	// Without an active scope, no cache is used
+	TestNull(TEXT("No active cache outside of a scope"), FHoudiniHapiInfoCache::Get());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_PrewarmedNodePool, "Houdini.Core.Scheduler.PrewarmedNodePool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_PrewarmedNodePool::RunTest(const FString & Parameters)
+{
+	// Use an asset name and library ids that can't collide with a pool of the current session.
+	// The pools are emptied before being discarded, so that no node of a running session gets deleted.
+	const FString AssetName = FString::Printf(TEXT("Test_%s"), *FGuid::NewGuid().ToString());
+	const HAPI_AssetLibraryId LibraryId = -10;
+	const HAPI_AssetLibraryId ReloadedLibraryId = -11;
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+
+	HAPI_NodeId NodeId = -1;
+	TestFalse(TEXT("Empty pool has no node to claim"), HoudiniEngine.ClaimPrewarmedNode(AssetName, LibraryId, NodeId));
+	TestEqual(TEXT("Empty pool size"), HoudiniEngine.GetNumPrewarmedNodes(AssetName, LibraryId), 0);
+
+	// Pools are only refilled for the HDAs that are placed repeatedly
+	TestEqual(TEXT("First instantiation"), HoudiniEngine.AddAssetInstantiation(AssetName, LibraryId), 1);
+	TestEqual(TEXT("Second instantiation"), HoudiniEngine.AddAssetInstantiation(AssetName, LibraryId), 2);
+
+	HoudiniEngine.AddPrewarmedNode(AssetName, LibraryId, 10);
+	HoudiniEngine.AddPrewarmedNode(AssetName, LibraryId, 11);
+	TestEqual(TEXT("Pool size"), HoudiniEngine.GetNumPrewarmedNodes(AssetName, LibraryId), 2);
+	TestEqual(TEXT("No node for another library"), HoudiniEngine.GetNumPrewarmedNodes(AssetName, ReloadedLibraryId), 0);
+	TestFalse(TEXT("Nodes of another library can't be claimed"), HoudiniEngine.ClaimPrewarmedNode(AssetName, ReloadedLibraryId, NodeId));
+
+	// Nodes are claimed in the order they were prewarmed
+	TestTrue(TEXT("First claim"), HoudiniEngine.ClaimPrewarmedNode(AssetName, LibraryId, NodeId));
+	TestEqual(TEXT("First claimed node"), NodeId, 10);
+	TestTrue(TEXT("Second claim"), HoudiniEngine.ClaimPrewarmedNode(AssetName, LibraryId, NodeId));
+	TestEqual(TEXT("Second claimed node"), NodeId, 11);
+	TestFalse(TEXT("Exhausted pool has no node to claim"), HoudiniEngine.ClaimPrewarmedNode(AssetName, LibraryId, NodeId));
+
+	// Reloading the HDA's library starts a new pool
+	TestEqual(TEXT("Instantiation count restarts with the new library"), HoudiniEngine.AddAssetInstantiation(AssetName, ReloadedLibraryId), 1);
+	TestEqual(TEXT("Previous library's pool is discarded"), HoudiniEngine.GetNumPrewarmedNodes(AssetName, LibraryId), 0);
+
+	// Discarding the pool also forgets the HDA's instantiations
+	HoudiniEngine.DiscardPrewarmedNodes(AssetName);
+	TestEqual(TEXT("Discarded pool starts over"), HoudiniEngine.AddAssetInstantiation(AssetName, ReloadedLibraryId), 1);
+	HoudiniEngine.DiscardPrewarmedNodes(AssetName);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_SessionSnapshot, "Houdini.Core.Session.SnapshotRestore", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_SessionSnapshot::RunTest(const FString & Parameters)
+{
+	// Stand-in session: node ids change when the saved scene is loaded, node paths don't
+	TMap<HAPI_NodeId, FString> SessionNodes = {
+		{ 5, TEXT("/obj/asset_a") }, { 7, TEXT("/obj/asset_a_input0") }, { 8, TEXT("/obj/asset_a/sop_input") } };
+	TMap<FString, HAPI_NodeId> RestoredSessionNodes;
+	FString SavedHIPFilePath;
+	FString DeletedHIPFilePath;
+
+	FHoudiniSessionSnapshot::FQueries Queries;
+	Queries.GetNodePath = [&SessionNodes](const HAPI_NodeId& NodeId, FString& OutPath)
+	{
+		const FString* Path = SessionNodes.Find(NodeId);
+		if (Path)
+			OutPath = *Path;
+		return Path != nullptr;
+	};
+	Queries.GetNodeFromPath = [&RestoredSessionNodes](const FString& Path, HAPI_NodeId& OutNodeId)
+	{
+		const HAPI_NodeId* NodeId = RestoredSessionNodes.Find(Path);
+		if (NodeId)
+			OutNodeId = *NodeId;
+		return NodeId != nullptr;
+	};
+	Queries.SaveHIPFile = [&SavedHIPFilePath](const FString& Path)
+	{
+		SavedHIPFilePath = Path;
+		return true;
+	};
+	Queries.LoadHIPFile = [&SavedHIPFilePath, &SessionNodes, &RestoredSessionNodes](const FString& Path)
+	{
+		if (Path != SavedHIPFilePath)
+			return false;
+
+		// The saved scene also contains a node that was never captured, like the input manager's
+		RestoredSessionNodes = {
+			{ TEXT("/obj/asset_a"), 12 }, { TEXT("/obj/asset_a_input0"), 15 },
+			{ TEXT("/obj/asset_a/sop_input"), 16 }, { TEXT("/obj/input_manager"), 20 } };
+		SessionNodes.Empty();
+		for (const auto& RestoredNode : RestoredSessionNodes)
+			SessionNodes.Add(RestoredNode.Value, RestoredNode.Key);
+		return true;
+	};
+	Queries.DeleteHIPFile = [&DeletedHIPFilePath](const FString& Path)
+	{
+		DeletedHIPFilePath = Path;
+		return true;
+	};
+	Queries.GetChildNodeIds = [&RestoredSessionNodes](const FString& Path, TArray<HAPI_NodeId>& OutNodeIds)
+	{
+		OutNodeIds.Empty();
+		for (const auto& RestoredNode : RestoredSessionNodes)
+		{
+			FString ChildName;
+			if (RestoredNode.Key.Split(TEXT("/"), &ChildName, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd) && ChildName == Path)
+				OutNodeIds.Add(RestoredNode.Value);
+		}
+		return true;
+	};
+
+	FHoudiniSessionSnapshot Snapshot(Queries);
+	TestFalse(TEXT("Unsaved snapshot can't be restored"), Snapshot.Restore());
+
+	// Node 9 doesn't exist in the session
+	Snapshot.CaptureNodes({ 5, 7, 8, 9, -1 });
+	TestTrue(TEXT("Snapshot saved"), Snapshot.SaveHIPFile(TEXT("/tmp/snapshot.hip")));
+	TestTrue(TEXT("Snapshot is saved"), Snapshot.IsSaved());
+	TestTrue(TEXT("Snapshot restored"), Snapshot.Restore());
+
+	HAPI_NodeId NodeId = -1;
+	TestTrue(TEXT("Asset node remapped"), Snapshot.RemapNodeId(5, NodeId));
+	TestEqual(TEXT("Asset node id in the restored session"), NodeId, 12);
+	TestTrue(TEXT("Input node remapped"), Snapshot.RemapNodeId(7, NodeId));
+	TestEqual(TEXT("Input node id in the restored session"), NodeId, 15);
+	TestFalse(TEXT("Missing node isn't remapped"), Snapshot.RemapNodeId(9, NodeId));
+	TestTrue(TEXT("Invalid node id is kept"), Snapshot.RemapNodeId(-1, NodeId));
+	TestEqual(TEXT("Invalid node id"), NodeId, -1);
+
+	// Components that were never instantiated are not captured
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+	TestEqual(TEXT("Uninstantiated component isn't captured"), Snapshot.CaptureComponents({ HAC }), 0);
+	TestFalse(TEXT("Uninstantiated component can't be restored"), Snapshot.RestoreComponent(HAC));
+
+	// Restored nodes that no component uses are orphans, so are the uncaptured nodes under /obj.
+	// Nodes inside an orphaned network are deleted with it and aren't listed.
+	TArray<HAPI_NodeId> OrphanedNodeIds;
+	Snapshot.GetOrphanedNodeIds(OrphanedNodeIds);
+	OrphanedNodeIds.Sort();
+	TestTrue(TEXT("Unused restored nodes are orphans"), OrphanedNodeIds == TArray<HAPI_NodeId>({ 12, 15, 20 }));
+
+	// The snapshot file is deleted once restored
+	Snapshot.DeleteHIPFile();
+	TestEqual(TEXT("Snapshot file deleted"), DeletedHIPFilePath, SavedHIPFilePath);
+	TestFalse(TEXT("Deleted snapshot isn't saved"), Snapshot.IsSaved());
+	TestFalse(TEXT("Deleted snapshot can't be restored"), Snapshot.Restore());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_CookGraph, "Houdini.Core.Scheduler.CookGraph", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_CookGraph::RunTest(const FString & Parameters)
+{
+	// Two independent chains: 0 <- 2 <- 4 and 1 <- 3, and an isolated node 5
+	{
+		FHoudiniCookGraph Graph({ { 2 }, { 3 }, { 4 }, {}, {}, {} });
+		const TArray<int32> Order = Graph.GetDependencyOrder();
+		TestEqual(TEXT("All nodes are ordered"), Order.Num(), 6);
+		TestTrue(TEXT("Upstream nodes come first, independent nodes keep their order"), Order == TArray<int32>({ 4, 2, 0, 3, 1, 5 }));
+	}
+
+	// Nodes without dependencies are left untouched
+	{
+		FHoudiniCookGraph Graph({ {}, {}, {} });
+		TestTrue(TEXT("Independent nodes keep their order"), Graph.GetDependencyOrder() == TArray<int32>({ 0, 1, 2 }));
+	}
+
+	// A node used by several nodes is only ordered once, before the first of them
+	{
+		FHoudiniCookGraph Graph({ { 3 }, {}, { 3 }, {} });
+		TestTrue(TEXT("Shared upstream node"), Graph.GetDependencyOrder() == TArray<int32>({ 3, 0, 1, 2 }));
+	}
+
+	// Cycles don't prevent the nodes from being ordered
+	{
+		FHoudiniCookGraph Graph({ { 1 }, { 0 }, { 5 } });
+		const TArray<int32> Order = Graph.GetDependencyOrder();
+		TestTrue(TEXT("Cycle is broken and invalid dependencies ignored"), Order == TArray<int32>({ 1, 0, 2 }));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_QuantizedStaticMesh, "Houdini.Core.ProxyMesh.Quantization", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_QuantizedStaticMesh::RunTest(const FString & Parameters)
+{
+	// Octahedral encoding of directions spread over the whole sphere
+	const int32 NumDirections = 1000;
+	float MinDot = 1.0f;
+	for (int32 Index = 0; Index < NumDirections; ++Index)
+	{
+		const float Z = 1.0f - 2.0f * (Index + 0.5f) / NumDirections;
+		const float Radius = FMath::Sqrt(1.0f - Z * Z);
+		const float Angle = Index * PI * (3.0f - FMath::Sqrt(5.0f));
+		const FVector3f Direction(Radius * FMath::Cos(Angle), Radius * FMath::Sin(Angle), Z);
+		const FVector3f Decoded = UHoudiniStaticMesh::DecodeOctahedral(UHoudiniStaticMesh::EncodeOctahedral(Direction));
+		MinDot = FMath::Min(MinDot, FVector3f::DotProduct(Direction, Decoded));
+	}
+	TestTrue(TEXT("Octahedral round trip is within 0.01 degree"), MinDot > FMath::Cos(FMath::DegreesToRadians(0.01f)));
+
+	const FVector3f Axes[] = { FVector3f(1, 0, 0), FVector3f(-1, 0, 0), FVector3f(0, 1, 0), FVector3f(0, -1, 0), FVector3f(0, 0, 1), FVector3f(0, 0, -1) };
+	for (const FVector3f& Axis : Axes)
+		TestTrue(TEXT("Axes round trip"), UHoudiniStaticMesh::DecodeOctahedral(UHoudiniStaticMesh::EncodeOctahedral(Axis)).Equals(Axis, 1e-4f));
+	TestTrue(TEXT("Zero vector decodes to up"), UHoudiniStaticMesh::DecodeOctahedral(UHoudiniStaticMesh::EncodeOctahedral(FVector3f::ZeroVector)).Equals(FVector3f(0, 0, 1), 1e-4f));
+
+	// Coordinates relative to the bounds
+	TestEqual(TEXT("Min of the range"), UHoudiniStaticMesh::QuantizeCoordinate(-50.0f, -50.0f, 100.0f), (uint16)0);
+	TestEqual(TEXT("Max of the range"), UHoudiniStaticMesh::QuantizeCoordinate(50.0f, -50.0f, 100.0f), (uint16)65535);
+	TestEqual(TEXT("Values outside the range are clamped"), UHoudiniStaticMesh::QuantizeCoordinate(75.0f, -50.0f, 100.0f), (uint16)65535);
+	TestEqual(TEXT("Flat range"), UHoudiniStaticMesh::DequantizeCoordinate(UHoudiniStaticMesh::QuantizeCoordinate(3.0f, 3.0f, 0.0f), 3.0f, 0.0f), 3.0f);
+
+	// Quantize a mesh: two triangles, two UV layers
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+	Mesh->Initialize(4, 2, 2, 0, true, true, false, false);
+
+	const FVector3f Positions[] = { FVector3f(-500, -100, 10), FVector3f(500, -100, 10), FVector3f(500, 100, 60), FVector3f(-500, 100, 33.3f) };
+	for (int32 VertexIndex = 0; VertexIndex < 4; ++VertexIndex)
+		Mesh->SetVertexPosition(VertexIndex, Positions[VertexIndex]);
+	Mesh->SetTriangleVertexIndices(0, FIntVector(0, 1, 2));
+	Mesh->SetTriangleVertexIndices(1, FIntVector(0, 2, 3));
+
+	const FVector3f Normal = FVector3f(0.3f, -0.2f, -0.9f).GetSafeNormal();
+	for (int32 TriangleIndex = 0; TriangleIndex < 2; ++TriangleIndex)
+	{
+		for (uint8 Corner = 0; Corner < 3; ++Corner)
+		{
+			Mesh->SetTriangleVertexNormal(TriangleIndex, Corner, Normal);
+			Mesh->SetTriangleVertexUV(TriangleIndex, Corner, 0, FVector2f(0.25f * Corner, 0.5f * TriangleIndex));
+			Mesh->SetTriangleVertexUV(TriangleIndex, Corner, 1, FVector2f(-3.125f, 7.5f + Corner));
+		}
+	}
+	Mesh->CalculateTangents();
+
+	const FBox Bounds = Mesh->CalcBounds();
+	const TArray<FVector3f> UTangents = Mesh->GetVertexInstanceUTangents();
+	const TArray<FVector2f> UVs = Mesh->GetVertexInstanceUVs();
+
+	Mesh->Quantize();
+	TestTrue(TEXT("Mesh is quantized"), Mesh->IsQuantized());
+	TestTrue(TEXT("Quantized mesh is valid"), Mesh->IsValid());
+	TestEqual(TEXT("Number of vertices"), Mesh->GetNumVertices(), (uint32)4);
+	TestEqual(TEXT("Full precision positions are released"), Mesh->GetVertexPositions().Num(), 0);
+	TestTrue(TEXT("Bounds are kept"), Mesh->CalcBounds().Min.Equals(Bounds.Min) && Mesh->CalcBounds().Max.Equals(Bounds.Max));
+
+	auto CheckQuantizedMesh = [this, &Positions, &Normal, &UTangents, &UVs, &Bounds](const UHoudiniStaticMesh* InMesh, const TCHAR* InWhat)
+	{
+		// The position error is at most half a step of the quantization grid on each axis
+		const FVector3f Tolerance = FVector3f(Bounds.GetSize()) / 65535.0f;
+		for (int32 VertexIndex = 0; VertexIndex < 4; ++VertexIndex)
+		{
+			const FVector3f Error = (InMesh->GetVertexPosition(VertexIndex) - Positions[VertexIndex]).GetAbs();
+			TestTrue(FString::Printf(TEXT("%s: position %d"), InWhat, VertexIndex), Error.X <= Tolerance.X && Error.Y <= Tolerance.Y && Error.Z <= Tolerance.Z);
+		}
+
+		const TArray<uint32>& Normals = InMesh->GetQuantizedVertexInstanceNormals();
+		const TArray<uint32>& QuantizedUTangents = InMesh->GetQuantizedVertexInstanceUTangents();
+		TestEqual(FString::Printf(TEXT("%s: number of normals"), InWhat), Normals.Num(), 6);
+		for (int32 Index = 0; Index < Normals.Num(); ++Index)
+		{
+			TestTrue(FString::Printf(TEXT("%s: normal %d"), InWhat, Index), UHoudiniStaticMesh::DecodeOctahedral(Normals[Index]).Equals(Normal, 1e-3f));
+			TestTrue(FString::Printf(TEXT("%s: tangent %d"), InWhat, Index), UHoudiniStaticMesh::DecodeOctahedral(QuantizedUTangents[Index]).Equals(UTangents[Index], 1e-3f));
+		}
+
+		// Half floats have 11 significant bits
+		const TArray<FVector2DHalf>& QuantizedUVs = InMesh->GetQuantizedVertexInstanceUVs();
+		TestEqual(FString::Printf(TEXT("%s: number of UVs"), InWhat), QuantizedUVs.Num(), UVs.Num());
+		for (int32 Index = 0; Index < FMath::Min(QuantizedUVs.Num(), UVs.Num()); ++Index)
+		{
+			const FVector2f UV = QuantizedUVs[Index];
+			TestTrue(FString::Printf(TEXT("%s: UV %d"), InWhat, Index), UV.Equals(UVs[Index], UVs[Index].GetAbsMax() / 1024.0f));
+		}
+	};
+
+	CheckQuantizedMesh(Mesh, TEXT("Quantized"));
+
+	// The quantized data survives serialization
+	TArray<uint8> Bytes;
+	FObjectWriter Writer(Mesh, Bytes);
+	UHoudiniStaticMesh* LoadedMesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+	FObjectReader Reader(LoadedMesh, Bytes);
+	TestTrue(TEXT("Loaded mesh is quantized"), LoadedMesh->IsQuantized());
+	TestTrue(TEXT("Loaded mesh is valid"), LoadedMesh->IsValid());
+	CheckQuantizedMesh(LoadedMesh, TEXT("Loaded"));
+
+	// Initializing the mesh again goes back to full precision
+	Mesh->Initialize(3, 1, 1, 0, true, false, false, false);
+	TestFalse(TEXT("Reinitialized mesh isn't quantized"), Mesh->IsQuantized());
+	TestEqual(TEXT("Reinitialized mesh vertices"), Mesh->GetNumVertices(), (uint32)3);
+
+	// A large proxy: a 256 x 256 vertices terrain spanning 10 km, with normals, tangents and one UV layer
+	const int32 GridSize = 256;
+	const float GridExtent = 1000000.0f;
+	auto CreateTerrainMesh = [&GridSize, &GridExtent]()
+	{
+		UHoudiniStaticMesh* TerrainMesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage());
+		const int32 NumCells = GridSize - 1;
+		TerrainMesh->Initialize(GridSize * GridSize, NumCells * NumCells * 2, 1, 0, true, true, false, false);
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			for (int32 X = 0; X < GridSize; ++X)
+			{
+				const float Height = 5000.0f * FMath::Sin(X * 0.05f) * FMath::Cos(Y * 0.07f);
+				TerrainMesh->SetVertexPosition(Y * GridSize + X, FVector3f(X * GridExtent / NumCells, Y * GridExtent / NumCells, Height));
+			}
+		}
+
+		int32 TriangleIndex = 0;
+		for (int32 Y = 0; Y < NumCells; ++Y)
+		{
+			for (int32 X = 0; X < NumCells; ++X)
+			{
+				const int32 V0 = Y * GridSize + X;
+				const FIntVector Triangles[] = { FIntVector(V0, V0 + 1, V0 + GridSize + 1), FIntVector(V0, V0 + GridSize + 1, V0 + GridSize) };
+				for (const FIntVector& Triangle : Triangles)
+				{
+					TerrainMesh->SetTriangleVertexIndices(TriangleIndex, Triangle);
+					for (uint8 Corner = 0; Corner < 3; ++Corner)
+					{
+						const int32 VertexIndex = Triangle[Corner];
+						TerrainMesh->SetTriangleVertexNormal(TriangleIndex, Corner, FVector3f(0, 0, 1));
+						TerrainMesh->SetTriangleVertexUV(TriangleIndex, Corner, 0,
+							FVector2f((VertexIndex % GridSize) / (float)NumCells, (VertexIndex / GridSize) / (float)NumCells));
+					}
+					TriangleIndex++;
+				}
+			}
+		}
+		TerrainMesh->CalculateTangents();
+		return TerrainMesh;
+	};
+
+	UHoudiniStaticMesh* FullPrecisionMesh = CreateTerrainMesh();
+	UHoudiniStaticMesh* QuantizedMesh = CreateTerrainMesh();
+	QuantizedMesh->Quantize();
+	TestTrue(TEXT("Large mesh is quantized"), QuantizedMesh->IsQuantized() && QuantizedMesh->IsValid());
+
+	// A single 16-bit grid over the bounds: the steps are about 15 cm on the 10 km sides
+	const FVector3f StepSize = FVector3f(FullPrecisionMesh->CalcBounds().GetSize()) / 65535.0f;
+	TestTrue(TEXT("Step size on a 10 km proxy"), FMath::IsNearlyEqual(StepSize.X, 15.26f, 0.01f));
+	float MaxPositionError = 0.0f;
+	for (uint32 VertexIndex = 0; VertexIndex < FullPrecisionMesh->GetNumVertices(); ++VertexIndex)
+	{
+		const FVector3f Error = (QuantizedMesh->GetVertexPosition(VertexIndex) - FullPrecisionMesh->GetVertexPosition(VertexIndex)).GetAbs();
+		MaxPositionError = FMath::Max(MaxPositionError, Error.GetMax());
+		if (Error.X > StepSize.X || Error.Y > StepSize.Y || Error.Z > StepSize.Z)
+		{
+			AddError(FString::Printf(TEXT("Large mesh: position %d is off by more than a step"), VertexIndex));
+			break;
+		}
+	}
+
+	TArray<uint8> FullPrecisionBytes;
+	FObjectWriter FullPrecisionWriter(FullPrecisionMesh, FullPrecisionBytes);
+	TArray<uint8> QuantizedBytes;
+	FObjectWriter QuantizedWriter(QuantizedMesh, QuantizedBytes);
+
+	const SIZE_T FullPrecisionResourceSize = FullPrecisionMesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	const SIZE_T QuantizedResourceSize = QuantizedMesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+
+	AddInfo(FString::Printf(TEXT("Serialized size: %d bytes full precision, %d bytes quantized"), FullPrecisionBytes.Num(), QuantizedBytes.Num()));
+	AddInfo(FString::Printf(TEXT("Resource size: %llu bytes full precision, %llu bytes quantized"), (uint64)FullPrecisionResourceSize, (uint64)QuantizedResourceSize));
+	AddInfo(FString::Printf(TEXT("Max position error: %.2f cm"), MaxPositionError));
+
+	// Positions, normals, tangents and UVs shrink to about a third of their full precision size, the triangle indices are unchanged
+	TestTrue(TEXT("Quantized mesh serializes to less than half the bytes"), QuantizedBytes.Num() * 2 < FullPrecisionBytes.Num());
+	TestTrue(TEXT("Quantized mesh uses less than half the memory"), QuantizedResourceSize * 2 < FullPrecisionResourceSize);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_LandscapeSplineCurveAttributes, "Houdini.Core.LandscapeSplines.CopyCurveAttributes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_LandscapeSplineCurveAttributes::RunTest(const FString & Parameters)
+{
+	// Ranges of tuples
+	const TArray<int32> Values = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	TArray<int32> Range;
+	CopyLandscapeSplineAttributeRange(true, Values, 2, 1, 2, Range);
+	TestEqual(TEXT("Tuples 1 and 2"), Range, TArray<int32>({ 2, 3, 4, 5 }));
+
+	CopyLandscapeSplineAttributeRange(true, Values, 2, 3, 5, Range);
+	TestEqual(TEXT("A range past the end is truncated"), Range, TArray<int32>({ 6, 7, 8, 9 }));
+
+	CopyLandscapeSplineAttributeRange(true, Values, 2, 5, 1, Range);
+	TestEqual(TEXT("A range starting past the end is empty"), Range.Num(), 0);
+
+	Range = { 42 };
+	CopyLandscapeSplineAttributeRange(false, Values, 1, 0, 2, Range);
+	TestEqual(TEXT("A missing attribute gives an empty range"), Range.Num(), 0);
+
+	// Two curves of 3 and 2 points. The rotations are missing, and the raise terrain fetch failed (flagged but empty).
+	FLandscapeSplineCurveAttributes PartPointAttributes;
+	FLandscapeSplinePrimAttributes PartPrimAttributes;
+	for (int32 PointIdx = 0; PointIdx < 5; PointIdx++)
+	{
+		PartPointAttributes.PointPositions.Append({ (float)PointIdx, 0.0f, 0.0f });
+		PartPointAttributes.PointIds.Add(100 + PointIdx);
+	}
+	PartPointAttributes.bHasPointIdAttribute = true;
+	PartPrimAttributes.bHasPaintLayerNameAttribute = true;
+	PartPrimAttributes.PaintLayerNames = { TEXT("Grass"), TEXT("Road") };
+	PartPrimAttributes.bHasRaiseTerrainAttribute = true;
+
+	FLandscapeSplineCurveAttributes CurveAttributes;
+	FHoudiniLandscapeSplineTranslator::CopyCurveAttributes(PartPointAttributes, PartPrimAttributes, 1, 3, 2, CurveAttributes);
+	TestEqual(TEXT("Second curve positions"), CurveAttributes.PointPositions, TArray<float>({ 3.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f }));
+	TestTrue(TEXT("Second curve has ids"), CurveAttributes.bHasPointIdAttribute);
+	TestEqual(TEXT("Second curve ids"), CurveAttributes.PointIds, TArray<int32>({ 103, 104 }));
+	TestFalse(TEXT("No rotations"), CurveAttributes.bHasPointRotationAttribute);
+	TestEqual(TEXT("Empty rotations"), CurveAttributes.PointRotations.Num(), 0);
+	TestTrue(TEXT("Second curve has a paint layer"), CurveAttributes.bHasPrimPaintLayerNameAttribute);
+	TestEqual(TEXT("Second curve paint layer"), CurveAttributes.PrimPaintLayerName, FString(TEXT("Road")));
+	TestFalse(TEXT("A failed prim attribute fetch is treated as missing"), CurveAttributes.bHasPrimRaiseTerrainAttribute);
+
+	// A part where no attribute could be fetched gives empty curves instead of failing
+	FLandscapeSplineCurveAttributes EmptyCurveAttributes;
+	FHoudiniLandscapeSplineTranslator::CopyCurveAttributes(
+		FLandscapeSplineCurveAttributes(), FLandscapeSplinePrimAttributes(), 0, 0, 3, EmptyCurveAttributes);
+	TestEqual(TEXT("No positions"), EmptyCurveAttributes.PointPositions.Num(), 0);
+	TestFalse(TEXT("No ids"), EmptyCurveAttributes.bHasPointIdAttribute);
+	TestFalse(TEXT("No paint layer"), EmptyCurveAttributes.bHasPrimPaintLayerNameAttribute);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_BrushBlockoutCSG, "Houdini.Core.Brushes.BlockoutCSG", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_BrushBlockoutCSG::RunTest(const FString & Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("World created"), World))
+		return false;
+
+	// Same setup as the editor's box brushes
+	auto SpawnBoxBrush = [World](const FVector& InLocation, const float InSize, const EBrushType InBrushType)
+	{
+		ABrush* Brush = World->SpawnActor<ABrush>(InLocation, FRotator::ZeroRotator);
+		Brush->BrushType = InBrushType;
+		Brush->Brush = NewObject<UModel>(Brush, NAME_None, RF_Transactional);
+		Brush->Brush->Initialize(nullptr, true);
+		Brush->Brush->Polys = NewObject<UPolys>(Brush->Brush, NAME_None, RF_Transactional);
+		Brush->GetBrushComponent()->Brush = Brush->Brush;
+
+		UCubeBuilder* Builder = NewObject<UCubeBuilder>(Brush);
+		Builder->X = InSize;
+		Builder->Y = InSize;
+		Builder->Z = InSize;
+		Brush->BrushBuilder = Builder;
+		Builder->Build(World, Brush);
+		return Brush;
+	};
+
+	// Generated blockout: a grid of rooms, each with a door cut out of one of its walls. The rooms are far enough
+	// apart that each door only overlaps its own room.
+	const int32 GridSize = 6;
+	const double Spacing = 1000.0;
+	const float RoomSize = 800.0f;
+	TArray<ABrush*> Rooms;
+	TArray<ABrush*> Doors;
+	for (int32 X = 0; X < GridSize; X++)
+	{
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			const FVector Location(X * Spacing, Y * Spacing, 0.0);
+			Rooms.Add(SpawnBoxBrush(Location, RoomSize, Brush_Add));
+			Doors.Add(SpawnBoxBrush(Location + FVector(RoomSize * 0.5, 0.0, 0.0), 200.0f, Brush_Subtract));
+		}
+	}
+
+	auto ModelsMatch = [](const UModel* InA, const UModel* InB)
+	{
+		return IsValid(InA) && IsValid(InB)
+			&& InA->Points == InB->Points
+			&& InA->Nodes.Num() == InB->Nodes.Num()
+			&& InA->Verts.Num() == InB->Verts.Num();
+	};
+
+	TArray<UHoudiniInputBrush*> Inputs;
+	TArray<TArray<ABrush*>> InputBrushes;
+	for (ABrush* Room : Rooms)
+	{
+		Inputs.Add(CastChecked<UHoudiniInputBrush>(
+			UHoudiniInputBrush::Create(Room, GetTransientPackage(), Room->GetName(), FHoudiniInputObjectSettings())));
+		UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(Inputs.Last(), InputBrushes.AddDefaulted_GetRef());
+	}
+
+	TestEqual(TEXT("Each room only intersects its own door"), InputBrushes[0].Num(), 2);
+
+	// First upload: the CSG of every room is built, as the brush translator does
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < Inputs.Num(); Idx++)
+		Inputs[Idx]->UpdateCachedData(UHCsgUtils::BuildModelFromBrushes(InputBrushes[Idx]), InputBrushes[Idx]);
+	const double FullBuildTime = FPlatformTime::Seconds() - StartTime;
+
+	TArray<ABrush*> RoomOnly = { Rooms[0] };
+	TestFalse(TEXT("The door is cut out of the room"), ModelsMatch(Inputs[0]->GetCachedModel(), UHCsgUtils::BuildModelFromBrushes(RoomOnly)));
+
+	// Move a single door: only its room needs its CSG to be rebuilt
+	const int32 MovedDoor = GridSize + 1;
+	Doors[MovedDoor]->SetActorLocation(Doors[MovedDoor]->GetActorLocation() + FVector(0.0, 100.0, 0.0));
+
+	int32 NumRebuilt = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < Inputs.Num(); Idx++)
+	{
+		UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(Inputs[Idx], InputBrushes[Idx]);
+		if (!IsValid(Inputs[Idx]->GetCachedModel()) || Inputs[Idx]->HasBrushesChanged(InputBrushes[Idx]))
+		{
+			Inputs[Idx]->UpdateCachedData(UHCsgUtils::BuildModelFromBrushes(InputBrushes[Idx]), InputBrushes[Idx]);
+			NumRebuilt++;
+		}
+	}
+	const double IncrementalBuildTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("CSG of %d rooms: %.3fs full build, %.3fs after moving one door"), Inputs.Num(), FullBuildTime, IncrementalBuildTime));
+	TestEqual(TEXT("Only the room of the moved door is rebuilt"), NumRebuilt, 1);
+
+	// The reused models must match what a full rebuild gives
+	for (int32 Idx = 0; Idx < Inputs.Num(); Idx++)
+	{
+		if (!TestTrue(FString::Printf(TEXT("Room %d matches a full rebuild"), Idx),
+				ModelsMatch(Inputs[Idx]->GetCachedModel(), UHCsgUtils::BuildModelFromBrushes(InputBrushes[Idx]))))
+			break;
+	}
+
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest_GeometryCollectionPieceAttributes, "Houdini.Core.GeometryCollection.PieceAttributes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTest_GeometryCollectionPieceAttributes::RunTest(const FString & Parameters)
+{
+	// Four pieces in two clusters under a root. The first two pieces have swapped geometry indices, and the last
+	// piece is not simulated.
+	FGeometryCollection Collection;
+	Collection.AddElements(7, FGeometryCollection::TransformGroup);
+	Collection.AddElements(4, FGeometryCollection::GeometryGroup);
+	if (!Collection.HasAttribute("Level", FGeometryCollection::TransformGroup))
+		Collection.AddAttribute<int32>("Level", FGeometryCollection::TransformGroup);
+
+	const int32 ClusterA = 4;
+	const int32 ClusterB = 5;
+	const int32 Root = 6;
+	const TArray<int32> TransformToGeometryIndex = { 1, 0, 2, 3, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	const TArray<int32> Parents = { ClusterA, ClusterA, ClusterB, ClusterB, Root, Root, FGeometryCollection::Invalid };
+	for (int32 TransformIdx = 0; TransformIdx < TransformToGeometryIndex.Num(); TransformIdx++)
+	{
+		Collection.TransformToGeometryIndex[TransformIdx] = TransformToGeometryIndex[TransformIdx];
+		Collection.Parent[TransformIdx] = Parents[TransformIdx];
+		if (Parents[TransformIdx] != FGeometryCollection::Invalid)
+			Collection.Children[Parents[TransformIdx]].Add(TransformIdx);
+
+		Collection.SimulationType[TransformIdx] = TransformToGeometryIndex[TransformIdx] == INDEX_NONE
+			? FGeometryCollection::ESimulationTypes::FST_Clustered
+			: FGeometryCollection::ESimulationTypes::FST_Rigid;
+	}
+	Collection.SimulationType[3] = FGeometryCollection::ESimulationTypes::FST_None;
+
+	// Number of triangles of each geometry
+	const TArray<int32> FaceCounts = { 2, 1, 1, 3 };
+	for (int32 GeometryIdx = 0; GeometryIdx < FaceCounts.Num(); GeometryIdx++)
+		Collection.FaceCount[GeometryIdx] = FaceCounts[GeometryIdx];
+
+	TArray<int32> PieceObjectIndices;
+	TArray<FString> PrimNames;
+	TArray<int32> PrimLevels;
+	TArray<int32> PrimClusters;
+	FUnrealGeometryCollectionTranslator::GetGeometryCollectionPieceAttributes(
+		&Collection, PieceObjectIndices, PrimNames, PrimLevels, PrimClusters);
+
+	// The primitives are written in geometry index order, one per triangle of each piece
+	TestEqual(TEXT("Pieces in geometry index order"), PieceObjectIndices, TArray<int32>({ 1, 0, 2, 3 }));
+	TestEqual(TEXT("name"), PrimNames, TArray<FString>({
+		TEXT("gc_piece_1"), TEXT("gc_piece_1"), TEXT("gc_piece_0"), TEXT("gc_piece_2"),
+		TEXT("gc_piece_3"), TEXT("gc_piece_3"), TEXT("gc_piece_3") }));
+
+	// The pieces are at level 2 below the root, and the piece that is not simulated is at level 0
+	TestEqual(TEXT("unreal_gc_piece"), PrimLevels, TArray<int32>({ 2, 2, 2, 2, 0, 0, 0 }));
+
+	// Clusters are numbered per level, in transform order
+	TestEqual(TEXT("unreal_gc_cluster"), PrimClusters, TArray<int32>({ 0, 0, 0, 1, 0, 0, 0 }));
+
+	return true;
+}
+
 #endif
\ No newline at end of file
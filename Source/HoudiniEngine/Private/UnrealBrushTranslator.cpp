@@ -44,6 +44,7 @@
 #include "HCsgUtils.h"
 #include "ActorEditorUtils.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
 
 #include "Engine/Level.h"
 
@@ -155,9 +156,18 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	//--------------------------------------------------------------------------------------------------
 	TArray<ABrush*> BrushActors;
 	UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(InputBrushObject, BrushActors);
-	
-	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
-	InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
+
+	// Only redo the CSG if the brush or one of the subtractive brushes overlapping it has changed since
+	// the model was last built. Other brushes in the same input or in the level can change without
+	// requiring this brush's model to be rebuilt.
+	UModel* BrushModel = InputBrushObject->GetCachedModel();
+	if (!IsValid(BrushModel) || InputBrushObject->HasBrushesChanged(BrushActors))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealBrushTranslator::BuildModelFromBrushes);
+
+		BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
+		InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
+	}
 	
 	// DEBUG: Upload the level model (baked by UE) to Houdini
 	// ULevel* Level = BrushActor->GetTypedOuter<ULevel>();
@@ -184,6 +194,8 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 
 	int NumIndices = 0;
 	TArray<int32> FaceCountBuffer;
+	// Index of the first vertex of each node in the vertex buffers.
+	TArray<int32> NodeVertexOffsets;
 
 	{
 		// Calculate the size of the vertex buffer and the base vertex index of each node.
@@ -194,11 +206,13 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 		int32 NumNodes = Nodes.Num();
 
 		FaceCountBuffer.SetNumUninitialized(NumNodes);
+		NodeVertexOffsets.SetNumUninitialized(NumNodes);
 		// Build the face counts buffer by iterating over the BSP nodes.
 		for(int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
 		{
 			FBspNode& Node = Nodes[NodeIndex];
 			FaceCountBuffer[NodeIndex] = Node.NumVertices;
+			NodeVertexOffsets[NodeIndex] = NumIndices;
 			NumIndices += Node.NumVertices;
 		}
 	}
@@ -277,13 +291,13 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 		FVector3f Scale = FVector3f(1.f, 1.f, 1.f); // TODO: Extract from actor transform.
 		OutPosition.SetNum(NumPoints);
 
-		for (int32 PosIndex = 0; PosIndex < NumPoints; ++PosIndex)
+		ParallelFor(NumPoints, [&](int32 PosIndex)
 		{
 			FVector3f Point = BrushModel->Points[PosIndex];
 			Point = (FVector3f)ActorTransform.InverseTransformPosition((FVector3d)Point);
 			FVector3f Pos(Point.X, Point.Z, Point.Y);
 			OutPosition[PosIndex] = Pos/HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		}
+		});
 
 		// Upload point positions.
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
@@ -315,12 +329,13 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 
 		MaterialIndices.SetNumUninitialized(NumNodes);
 
-		// Populate the vertex index buffer.
-		int32 iVertex = 0;
-		for(int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		// Populate the vertex index buffer. Each node writes to its own range of the buffers so the nodes
+		// can be processed in parallel.
+		ParallelFor(NumNodes, [&](int32 NodeIndex)
 		{
-			FBspNode& Node = Nodes[NodeIndex];
-			FBspSurf& Surf = Surfs[Node.iSurf];
+			const FBspNode& Node = Nodes[NodeIndex];
+			const FBspSurf& Surf = Surfs[Node.iSurf];
+			int32 iVertex = NodeVertexOffsets[NodeIndex];
 			for (int32 NodeVertexIndex = 0; NodeVertexIndex < Node.NumVertices; ++NodeVertexIndex)
 			{
 				// Vertex Index
@@ -341,6 +356,11 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 				OutUV[iVertex] = FVector3f(U, V, 0.f);
 				++iVertex;
 			}
+		});
+
+		for(int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+		{
+			const FBspSurf& Surf = Surfs[Nodes[NodeIndex].iSurf];
 
 			// Face Material
 			// Construct a material index array for the faces
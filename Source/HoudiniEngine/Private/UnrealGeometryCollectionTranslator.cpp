@@ -261,6 +261,116 @@ FUnrealGeometryCollectionTranslator::SetGeometryCollectionAttributesForPart(
 	return true;
 }
 
+void
+FUnrealGeometryCollectionTranslator::GetGeometryCollectionPieceAttributes(
+	FGeometryCollection* GeometryCollection,
+	TArray<int32>& OutPieceObjectIndices,
+	TArray<FString>& OutPrimNames,
+	TArray<int32>& OutPrimLevels,
+	TArray<int32>& OutPrimClusters)
+{
+	OutPieceObjectIndices.Reset();
+	OutPrimNames.Reset();
+	OutPrimLevels.Reset();
+	OutPrimClusters.Reset();
+
+	// Level -> ( ParentId -> ClusterLevel )
+	TMap<int32, TMap<int32, int32>> LevelToClusterArray;
+	TMap<int32, int32> LevelToNewClusterIndex;
+
+	const TManagedArray<int32>& Parent = GeometryCollection->Parent;
+	const TManagedArray<int32>& SimulationType = GeometryCollection->SimulationType;
+	const TManagedArray<int32>& FaceCountArray = GeometryCollection->FaceCount;
+	const TManagedArray<int32>& TransformToGeometryIndexArray = GeometryCollection->TransformToGeometryIndex;
+
+	// Need to update hierarchy level otherwise sometimes level would be out of date!
+	FGeometryCollectionClusteringUtility::UpdateHierarchyLevelOfChildren(GeometryCollection, -1);
+
+	const int32 NumTransforms = TransformToGeometryIndexArray.Num();
+
+	// Identify the level and cluster of each piece, in transform order.
+	TArray<int32> PieceLevels;
+	TArray<int32> PieceClusters;
+	PieceLevels.SetNumUninitialized(NumTransforms);
+	PieceClusters.SetNumUninitialized(NumTransforms);
+
+	const TManagedArray<int32>* Levels = nullptr;
+	if (GeometryCollection->HasAttribute("Level", FGeometryCollection::TransformGroup))
+		Levels = &GeometryCollection->GetAttribute<int32>("Level", FGeometryCollection::TransformGroup);
+
+	for (int32 ObjectIndex = 0; ObjectIndex < NumTransforms; ObjectIndex++)
+	{
+		const int32 GeometryIndex = TransformToGeometryIndexArray[ObjectIndex];
+		if (GeometryIndex == -1)
+		{
+			continue;
+		}
+
+		OutPieceObjectIndices.Add(ObjectIndex);
+
+		// unreal_gc_piece (required for packing)
+		int32 Level = 1;
+		if (Levels)
+		{
+			Level = (*Levels)[GeometryIndex];
+		}
+
+		// If simulation type is none, then disable it
+		if (SimulationType[GeometryIndex] == FGeometryCollection::ESimulationTypes::FST_None)
+		{
+			Level = 0;
+		}
+
+		// Identify the cluster level using the parent indices:
+		int32 ClusterIndex = -1;
+		TMap<int32, int32> & ClusterMap = LevelToClusterArray.FindOrAdd(Level);
+		int32 ParentIndex = Parent[GeometryIndex];
+		if (ParentIndex != FGeometryCollection::Invalid)
+		{
+			if (ClusterMap.Contains(ParentIndex))
+			{
+				ClusterIndex = ClusterMap[ParentIndex];
+			}
+			else
+			{
+				if (LevelToNewClusterIndex.Contains(Level))
+				{
+					LevelToNewClusterIndex[Level]++;
+					ClusterIndex = LevelToNewClusterIndex[Level];
+				}
+				else
+				{
+					ClusterIndex = 0;
+					LevelToNewClusterIndex.Add(Level, ClusterIndex);
+				}
+
+				ClusterMap.Add(ParentIndex, ClusterIndex);
+			}
+		}
+
+		PieceLevels[ObjectIndex] = Level;
+		PieceClusters[ObjectIndex] = ClusterIndex;
+	}
+
+	// The pieces used to be merged in geometry index order, keep that order for the primitives.
+	OutPieceObjectIndices.Sort([&TransformToGeometryIndexArray](const int32 A, const int32 B)
+	{
+		return TransformToGeometryIndexArray[A] < TransformToGeometryIndexArray[B];
+	});
+
+	for (const int32 ObjectIndex : OutPieceObjectIndices)
+	{
+		const FString PieceName = FString::Printf(TEXT("gc_piece_%d"), ObjectIndex);
+		const int32 FaceCount = FaceCountArray[TransformToGeometryIndexArray[ObjectIndex]];
+		for (int32 FaceIdx = 0; FaceIdx < FaceCount; FaceIdx++)
+		{
+			OutPrimNames.Add(PieceName);
+			OutPrimLevels.Add(PieceLevels[ObjectIndex]);
+			OutPrimClusters.Add(PieceClusters[ObjectIndex]);
+		}
+	}
+}
+
 bool 
 FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 	UGeometryCollection* GeometryCollectionObject,
@@ -275,10 +385,6 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 		return false;
 	}
 
-	// Level -> ( ParentId -> ClusterLevel )
-	TMap<int32, TMap<int32, int32>> LevelToClusterArray;
-	TMap<int32, int32> LevelToNewClusterIndex;
-
 	TSharedPtr<FGeometryCollection, ESPMode::ThreadSafe> GeometryCollectionPtr = GeometryCollectionObject->GetGeometryCollection();
 	FGeometryCollection* GeometryCollection = GeometryCollectionPtr.Get();
 	check(GeometryCollection);
@@ -304,8 +410,6 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 	TManagedArray<int32>& MaterialIndex = GeometryCollection->MaterialIndex;
 
 	TManagedArray<FTransform>& Transform = GeometryCollection->Transform;
-	TManagedArray<int32>& Parent = GeometryCollection->Parent;
-	TManagedArray<int32>& SimulationType = GeometryCollection->SimulationType;
 	
 	TManagedArray<int32>& TransformIndex = GeometryCollection->TransformIndex;
 	TManagedArray<FBox>& BoundingBox = GeometryCollection->BoundingBox;
@@ -320,154 +424,143 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 
 	TManagedArray<FGeometryCollectionSection>& Sections = GeometryCollection->Sections;
 
-	// Need to update hierarchy level otherwise sometimes level would be out of date!
-	FGeometryCollectionClusteringUtility::UpdateHierarchyLevelOfChildren(GeometryCollection, -1);
-	
 	if (Sections.Num() == 0)
 	{
 		HOUDINI_LOG_ERROR(TEXT("No triangles in mesh"));
 		return false;
 	}
 
+	// All the pieces are uploaded as a single part, with a name attribute identifying the piece each primitive
+	// belongs to. The pack node then rebuilds one packed primitive per piece. This avoids creating a node and
+	// doing a full set of attribute uploads for every fracture piece.
 	// See: FUnrealMeshTranslator::CreateInputNodeForRawMesh for reference.
-	for (int32 ObjectIndex = 0; ObjectIndex < GeometryCollection->TransformToGeometryIndex.Num(); ObjectIndex++)
-	{
-		int32& GeometryIndex = TransformToGeometryIndexArray[ObjectIndex];
-		if (GeometryIndex == -1)
-		{
-			continue;
-		}
-		
-		int32& VertexStart = VertexStartArray[GeometryIndex];
-		int32& VertexCount = VertexCountArray[GeometryIndex];
-		int32& FaceStart = FaceStartArray[GeometryIndex];
-		int32& FaceCount = FaceCountArray[GeometryIndex];
-
-		HAPI_NodeId GeometryNodeId = -1;
-		FString OutputName = FString::Printf( TEXT("gc_piece_%d"), ObjectIndex);
-		// Create the node in this input object's OBJ node
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-                        InParentNodeId, TEXT("null"), OutputName, false, &GeometryNodeId), false);		
-		HAPI_PartInfo Part;
-		FHoudiniApi::PartInfo_Init(&Part);
-
-		Part.id = 0;
-		Part.nameSH = 0;
-		Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
-		Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
-		Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
-		Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
-
-		Part.vertexCount = FaceCount * 3; // In GC, "FaceCount" == number of indices.
-		Part.faceCount = FaceCount; //1; ///FaceCountArray // FaceCount; //FaceCount / 3; // TODO GC: In GC indices count == faces count. This is not the same in Regular meshes. Double check this.
-		Part.pointCount = VertexCount;
-		Part.type = HAPI_PARTTYPE_MESH;
-
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-                        FHoudiniEngine::Get().GetSession(), GeometryNodeId, 0, &Part), false);
+	TArray<int32> PieceObjectIndices;
+	TArray<FString> PrimNames;
+	TArray<int32> PrimLevels;
+	TArray<int32> PrimClusters;
+	GetGeometryCollectionPieceAttributes(GeometryCollection, PieceObjectIndices, PrimNames, PrimLevels, PrimClusters);
 
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// POSITION (P)
-		//--------------------------------------------------------------------------------------------------------------------- 
-		if (VertexCount > 3)
-		{
+	int32 TotalVertexCount = 0;
+	for (const int32 ObjectIndex : PieceObjectIndices)
+		TotalVertexCount += VertexCountArray[TransformToGeometryIndexArray[ObjectIndex]];
 
-			HAPI_AttributeInfo AttributeInfoPoint;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
-			AttributeInfoPoint.count = VertexCount;
-			AttributeInfoPoint.tupleSize = 3;
-			AttributeInfoPoint.exists = true;
-			AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-			AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+	const int32 TotalFaceCount = PrimNames.Num();
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-                                FHoudiniEngine::Get().GetSession(), GeometryNodeId, 0,
-                                HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
-			
-			TArray<float> StaticMeshVertices;
-			StaticMeshVertices.SetNumZeroed(VertexCount * 3);
-			for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-			{
-				int32 IndexInArray = VertexStart + VertexIdx;
-				const FVector3f& PositionVector = Vertex[IndexInArray];
+	HAPI_NodeId GeometryNodeId = -1;
+	// Create the node in this input object's OBJ node
+	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
+		InParentNodeId, TEXT("null"), TEXT("gc_pieces"), false, &GeometryNodeId), false);
 
-				// Convert Unreal to Houdini
-				StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			}
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
 
-			// Now that we have raw positions, we can upload them for our attribute.
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				StaticMeshVertices, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
-		}
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
 
-		TArray<UMaterialInterface*> MaterialInterfaces;
-		TArray<int32> TriangleMaterialIndices;
+	Part.vertexCount = TotalFaceCount * 3; // In GC, "FaceCount" == number of indices.
+	Part.faceCount = TotalFaceCount; // TODO GC: In GC indices count == faces count. This is not the same in Regular meshes. Double check this.
+	Part.pointCount = TotalVertexCount;
+	Part.type = HAPI_PARTTYPE_MESH;
 
-		int32 UEDefaultMaterialIndex = INDEX_NONE;
-		
-		const int32 NumMaterials = GeometryCollectionObject->Materials.Num();
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), GeometryNodeId, 0, &Part), false);
 
-		if (NumMaterials > 0)
-		{
-			for (int32 Index = 0; Index < NumMaterials; ++Index)
-			{
-				UMaterialInterface* CurrMaterial = GeometryCollectionObject->Materials[Index];
+	TArray<UMaterialInterface*> MaterialInterfaces;
+	TArray<int32> TriangleMaterialIndices;
 
-				// Possible we have a null entry - replace with default
-				if (!IsValid(CurrMaterial))
-				{
-					CurrMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
-					UEDefaultMaterialIndex = Index;
-				}
+	int32 UEDefaultMaterialIndex = INDEX_NONE;
+
+	const int32 NumMaterials = GeometryCollectionObject->Materials.Num();
 
-				MaterialInterfaces.Add(CurrMaterial);
+	if (NumMaterials > 0)
+	{
+		for (int32 Index = 0; Index < NumMaterials; ++Index)
+		{
+			UMaterialInterface* CurrMaterial = GeometryCollectionObject->Materials[Index];
+
+			// Possible we have a null entry - replace with default
+			if (!IsValid(CurrMaterial))
+			{
+				CurrMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+				UEDefaultMaterialIndex = Index;
 			}
 
-			TriangleMaterialIndices.Reserve(Part.faceCount);
-		} 
-		
-		// Setup for vertex instance attributes
-		int32 HoudiniVertexIdx = 0;
+			MaterialInterfaces.Add(CurrMaterial);
+		}
+
+		TriangleMaterialIndices.Reserve(Part.faceCount);
+	}
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
-		const bool HasUVs = GeometryCollection->NumUVLayers() > 0; 
+	const bool HasUVs = GeometryCollection->NumUVLayers() > 0; 
 #else
-		const bool HasUVs = UV.Num() == Vertex.Num();
+	const bool HasUVs = UV.Num() == Vertex.Num();
 #endif
-		TArray<float> UVs;
-		if (HasUVs)
-			UVs.SetNumZeroed(Part.vertexCount * 3);
-		
-		const bool HasNormals = Normal.Num() == Vertex.Num();
-		TArray<float> Normals;
-		if (HasNormals)
-			Normals.SetNumZeroed(Part.vertexCount * 3);
-
-		const bool HasTangentU = TangentU.Num() == Vertex.Num();
-		TArray<float> Tangents;
-		if (HasTangentU)
-			Tangents.SetNumZeroed(Part.vertexCount * 3);
-
-		const bool HasTangentV = TangentV.Num() == Vertex.Num();
-		TArray<float> Binormals;
-		if (HasTangentV)
-			Binormals.SetNumZeroed(Part.vertexCount * 3);
-
-		TArray<float> RGBColors;
-		TArray<float> Alphas;
-		const bool HasColor = Color.Num() == Vertex.Num();
-		if (HasColor)
+	TArray<float> UVs;
+	if (HasUVs)
+		UVs.SetNumZeroed(Part.vertexCount * 3);
+
+	const bool HasNormals = Normal.Num() == Vertex.Num();
+	TArray<float> Normals;
+	if (HasNormals)
+		Normals.SetNumZeroed(Part.vertexCount * 3);
+
+	const bool HasTangentU = TangentU.Num() == Vertex.Num();
+	TArray<float> Tangents;
+	if (HasTangentU)
+		Tangents.SetNumZeroed(Part.vertexCount * 3);
+
+	const bool HasTangentV = TangentV.Num() == Vertex.Num();
+	TArray<float> Binormals;
+	if (HasTangentV)
+		Binormals.SetNumZeroed(Part.vertexCount * 3);
+
+	TArray<float> RGBColors;
+	TArray<float> Alphas;
+	const bool HasColor = Color.Num() == Vertex.Num();
+	if (HasColor)
+	{
+		RGBColors.SetNumZeroed(Part.vertexCount * 3);
+		Alphas.SetNumZeroed(Part.vertexCount);
+	}
+
+	TArray<float> StaticMeshVertices;
+	StaticMeshVertices.SetNumUninitialized(Part.pointCount * 3);
+
+	TArray<int32> MeshTriangleVertexIndices;
+	MeshTriangleVertexIndices.SetNumUninitialized(Part.vertexCount);
+
+	// Setup for vertex instance attributes
+	int32 HoudiniVertexIdx = 0;
+	int32 HoudiniPointIdx = 0;
+
+	for (const int32 ObjectIndex : PieceObjectIndices)
+	{
+		const int32 GeometryIndex = TransformToGeometryIndexArray[ObjectIndex];
+
+		const int32 VertexStart = VertexStartArray[GeometryIndex];
+		const int32 VertexCount = VertexCountArray[GeometryIndex];
+		const int32 FaceStart = FaceStartArray[GeometryIndex];
+		const int32 FaceCount = FaceCountArray[GeometryIndex];
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// POSITION (P)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
 		{
-			RGBColors.SetNumZeroed(Part.vertexCount * 3);
-			Alphas.SetNumZeroed(Part.vertexCount);
+			const FVector3f& PositionVector = Vertex[VertexStart + VertexIdx];
+			const int32 PointFloat3Index = (HoudiniPointIdx + VertexIdx) * 3;
+
+			// Convert Unreal to Houdini
+			StaticMeshVertices[PointFloat3Index + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			StaticMeshVertices[PointFloat3Index + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			StaticMeshVertices[PointFloat3Index + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
 		}
 
-		TArray<int32> MeshTriangleVertexIndices;
-		MeshTriangleVertexIndices.SetNumUninitialized(Part.vertexCount);
-		
 		// For each face:
 		for (int32 i = 0; i < FaceCount; i++)
 		{
@@ -546,7 +639,7 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 				//--------------------------------------------------------------------------------------------------------------------- 
 				// TRIANGLE/FACE VERTEX INDICES
 				//---------------------------------------------------------------------------------------------------------------------
-				MeshTriangleVertexIndices[HoudiniVertexIdx] = VertexIndex - VertexStart;
+				MeshTriangleVertexIndices[HoudiniVertexIdx] = VertexIndex - VertexStart + HoudiniPointIdx;
 
 				HoudiniVertexIdx++;
 			}
@@ -554,337 +647,323 @@ FUnrealGeometryCollectionTranslator::UploadGeometryCollection(
 			//--------------------------------------------------------------------------------------------------------------------- 
 			// TRIANGLE MATERIAL ASSIGNMENT
 			//---------------------------------------------------------------------------------------------------------------------
-			const int32 MatIndex = MaterialID[FaceStart + i];
-			if (MaterialInterfaces.IsValidIndex(MatIndex))
-			{
-				TriangleMaterialIndices.Add(MatIndex);
-			}
-			else
+			if (NumMaterials > 0)
 			{
-				TriangleMaterialIndices.Add(UEDefaultMaterialIndex);
+				const int32 MatIndex = MaterialID[FaceStart + i];
+				if (MaterialInterfaces.IsValidIndex(MatIndex))
+				{
+					TriangleMaterialIndices.Add(MatIndex);
+				}
+				else
+				{
+					TriangleMaterialIndices.Add(UEDefaultMaterialIndex);
+				}
 			}
-			
+
 		}
 
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// UVS (uvX)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (HasUVs)
-		{
-			// Create attribute for uvs.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+		HoudiniPointIdx += VertexCount;
+	}
 
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = UVs.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITION (P)
+	//--------------------------------------------------------------------------------------------------------------------- 
+	if (Part.pointCount > 0)
+	{
+		HAPI_AttributeInfo AttributeInfoPoint;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+		AttributeInfoPoint.count = Part.pointCount;
+		AttributeInfoPoint.tupleSize = 3;
+		AttributeInfoPoint.exists = true;
+		AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_UV, &AttributeInfoVertex), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), GeometryNodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				UVs, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_UV, AttributeInfoVertex), false);
-		}
-		
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// NORMALS (N)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (HasNormals)
-		{
-			// Create attribute for normals.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+		// Now that we have raw positions, we can upload them for our attribute.
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			StaticMeshVertices, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfoPoint), false);
+	}
 
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Normals.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// UVS (uvX)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (HasUVs)
+	{
+		// Create attribute for uvs.
+		HAPI_AttributeInfo AttributeInfoVertex;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
+		AttributeInfoVertex.tupleSize = 3;
+		AttributeInfoVertex.count = UVs.Num() / AttributeInfoVertex.tupleSize;
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				Normals, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, AttributeInfoVertex), false);
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_UV, &AttributeInfoVertex), false);
 
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// TANGENT (tangentu)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (HasTangentU)
-		{
-			// Create attribute for tangentu.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			UVs, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_UV, AttributeInfoVertex), false);
+	}
+	
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// NORMALS (N)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (HasNormals)
+	{
+		// Create attribute for normals.
+		HAPI_AttributeInfo AttributeInfoVertex;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Tangents.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+		AttributeInfoVertex.tupleSize = 3;
+		AttributeInfoVertex.count = Normals.Num() / AttributeInfoVertex.tupleSize;
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				Tangents, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, AttributeInfoVertex), false);
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			Normals, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, AttributeInfoVertex), false);
+	}
 
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// BINORMAL (tangentv)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (HasTangentV)
-		{
-			// Create attribute for normals.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// TANGENT (tangentu)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (HasTangentU)
+	{
+		// Create attribute for tangentu.
+		HAPI_AttributeInfo AttributeInfoVertex;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Binormals.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+		AttributeInfoVertex.tupleSize = 3;
+		AttributeInfoVertex.count = Tangents.Num() / AttributeInfoVertex.tupleSize;
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-                                FHoudiniEngine::Get().GetSession(),
-                                GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				Binormals, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, AttributeInfoVertex), false);
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			Tangents, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, AttributeInfoVertex), false);
+	}
 
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// COLORS (Cd)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (HasColor)
-		{
-			// Create attribute for colors.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// BINORMAL (tangentv)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (HasTangentV)
+	{
+		// Create attribute for normals.
+		HAPI_AttributeInfo AttributeInfoVertex;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = RGBColors.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+		AttributeInfoVertex.tupleSize = 3;
+		AttributeInfoVertex.count = Binormals.Num() / AttributeInfoVertex.tupleSize;
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+                            FHoudiniEngine::Get().GetSession(),
+                            GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				RGBColors, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, AttributeInfoVertex, true), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			Binormals, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, AttributeInfoVertex), false);
+	}
 
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-			AttributeInfoVertex.tupleSize = 1;
-			AttributeInfoVertex.count = Alphas.Num();
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// COLORS (Cd)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (HasColor)
+	{
+		// Create attribute for colors.
+		HAPI_AttributeInfo AttributeInfoVertex;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex), false);
+		AttributeInfoVertex.tupleSize = 3;
+		AttributeInfoVertex.count = RGBColors.Num() / AttributeInfoVertex.tupleSize;
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
-				Alphas, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, AttributeInfoVertex, true), false);
-		}
-			
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// INDICES (VertexList)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (FaceCount > 0)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetVertexList(
-				MeshTriangleVertexIndices, GeometryNodeId, 0), false);
-			
-			// We need to generate array of face counts.
-			TArray<int32> StaticMeshFaceCounts;
-			StaticMeshFaceCounts.SetNumUninitialized(Part.faceCount);
-			for (int32 n = 0; n < Part.faceCount; n++)
-				StaticMeshFaceCounts[n] = 3;
-
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetFaceCounts(
-				StaticMeshFaceCounts, GeometryNodeId, 0), false);
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex), false);
 
-		// Materials - Reuse code from FHoudiniMeshTranslator
-		if (NumMaterials > 0)
-		{
-			// List of materials, one for each face.
-			FHoudiniEngineIndexedStringMap TriangleMaterials;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			RGBColors, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, AttributeInfoVertex, true), false);
 
-			//Lists of material parameters
-			TMap<FString, TArray<float>> ScalarMaterialParameters;
-			TMap<FString, TArray<float>> VectorMaterialParameters;
-            TMap<FString, FHoudiniEngineIndexedStringMap> TextureMaterialParameters;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+		AttributeInfoVertex.tupleSize = 1;
+		AttributeInfoVertex.count = Alphas.Num();
+		AttributeInfoVertex.exists = true;
+		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+		AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			bool bAttributeSuccess = false;
-			if (bInExportMaterialParametersAsAttributes)
-			{
-				// Create attributes for the material and all its parameters
-				// Get material attribute data, and all material parameters data
-				FUnrealMeshTranslator::CreateFaceMaterialArray(
-                                        MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials,
-                                        ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters);
-			}
-			else
-			{
-				// Create attributes only for the materials
-				// Only get the material attribute data
-				FUnrealMeshTranslator::CreateFaceMaterialArray(
-					MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials);
-			}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, &AttributeInfoVertex), false);
 
-			// Create all the needed attributes for materials
-			bAttributeSuccess = FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
-				GeometryNodeId,
-				0,
-				TriangleMaterials.GetIds().Num(),
-				TriangleMaterials,
-				ScalarMaterialParameters,
-				VectorMaterialParameters,
-				TextureMaterialParameters);
-
-			if (!bAttributeSuccess)
-			{
-				return false;
-			}
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeFloatData(
+			Alphas, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_ALPHA, AttributeInfoVertex, true), false);
+	}
+		
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// INDICES (VertexList)
+	//---------------------------------------------------------------------------------------------------------------------
+	if (Part.faceCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetVertexList(
+			MeshTriangleVertexIndices, GeometryNodeId, 0), false);
+		
+		// We need to generate array of face counts.
+		TArray<int32> StaticMeshFaceCounts;
+		StaticMeshFaceCounts.SetNumUninitialized(Part.faceCount);
+		for (int32 n = 0; n < Part.faceCount; n++)
+			StaticMeshFaceCounts[n] = 3;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetFaceCounts(
+			StaticMeshFaceCounts, GeometryNodeId, 0), false);
+	}
 
-		// Geometry collection input attributes
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// name (required for packing)
-		//---------------------------------------------------------------------------------------------------------------------
-		{
-			// Create point attribute info.
-			HAPI_AttributeInfo AttributeInfo;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-			AttributeInfo.count = Part.faceCount;
-			AttributeInfo.tupleSize = 1;
-			AttributeInfo.exists = true;
-			AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
-			AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-			AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+	// Materials - Reuse code from FHoudiniMeshTranslator
+	if (NumMaterials > 0)
+	{
+		// List of materials, one for each face.
+		FHoudiniEngineIndexedStringMap TriangleMaterials;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(), GeometryNodeId, Part.id,
-				HAPI_ATTRIB_NAME, &AttributeInfo), false);
+		//Lists of material parameters
+		TMap<FString, TArray<float>> ScalarMaterialParameters;
+		TMap<FString, TArray<float>> VectorMaterialParameters;
+        TMap<FString, FHoudiniEngineIndexedStringMap> TextureMaterialParameters;
 
-			// Upload them for our attribute.
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeStringData(
-				OutputName, GeometryNodeId, Part.id, HAPI_ATTRIB_NAME, AttributeInfo), false);
+		bool bAttributeSuccess = false;
+		if (bInExportMaterialParametersAsAttributes)
+		{
+			// Create attributes for the material and all its parameters
+			// Get material attribute data, and all material parameters data
+			FUnrealMeshTranslator::CreateFaceMaterialArray(
+                                    MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials,
+                                    ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters);
 		}
-
-
-		// Geometry collection input attributes
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// unreal_gc_piece (required for packing)
-		//---------------------------------------------------------------------------------------------------------------------
-		int32 Level = 1;	
-		if (GeometryCollection->HasAttribute("Level", FGeometryCollection::TransformGroup))
+		else
 		{
-			const TManagedArray<int32>& Levels = GeometryCollection->GetAttribute<int32>("Level", FGeometryCollection::TransformGroup);
-			Level = Levels[GeometryIndex];
+			// Create attributes only for the materials
+			// Only get the material attribute data
+			FUnrealMeshTranslator::CreateFaceMaterialArray(
+				MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials);
 		}
 
-		// If simulation type is none, then disable it
-		if (SimulationType[GeometryIndex] == FGeometryCollection::ESimulationTypes::FST_None)
+		// Create all the needed attributes for materials
+		bAttributeSuccess = FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
+			GeometryNodeId,
+			0,
+			TriangleMaterials.GetIds().Num(),
+			TriangleMaterials,
+			ScalarMaterialParameters,
+			VectorMaterialParameters,
+			TextureMaterialParameters);
+
+		if (!bAttributeSuccess)
 		{
-			Level = 0;
+			return false;
 		}
+	}
 
-		{
-			HAPI_AttributeInfo AttributeInfoPrim;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoPrim);
+	// Geometry collection input attributes
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// name (required for packing)
+	//---------------------------------------------------------------------------------------------------------------------
+	{
+		// Create primitive attribute info.
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		AttributeInfo.count = Part.faceCount;
+		AttributeInfo.tupleSize = 1;
+		AttributeInfo.exists = true;
+		AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+		AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			AttributeInfoPrim.count = Part.faceCount;
-			AttributeInfoPrim.tupleSize = 1;
-			AttributeInfoPrim.exists = true;
-			AttributeInfoPrim.owner = HAPI_ATTROWNER_PRIM;
-			AttributeInfoPrim.storage = HAPI_STORAGETYPE_INT;
-			AttributeInfoPrim.originalOwner = HAPI_ATTROWNER_INVALID;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), GeometryNodeId, Part.id,
+			HAPI_ATTRIB_NAME, &AttributeInfo), false);
+
+		// Upload them for our attribute, each piece name is only sent once.
+		FHoudiniEngineIndexedStringMap PieceNames;
+		PieceNames.SetStrings(PrimNames);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeStringMap(
+			PieceNames, GeometryNodeId, Part.id, HAPI_ATTRIB_NAME, AttributeInfo), false);
+	}
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(), 
-				GeometryNodeId,	0, HAPI_UNREAL_ATTRIB_GC_PIECE, &AttributeInfoPrim), false);
+	// Geometry collection input attributes
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// unreal_gc_piece (required for packing)
+	//---------------------------------------------------------------------------------------------------------------------
+	{
+		HAPI_AttributeInfo AttributeInfoPrim;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPrim);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeIntUniqueData(
-				Level, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_GC_PIECE, AttributeInfoPrim), false);
-		}
+		AttributeInfoPrim.count = Part.faceCount;
+		AttributeInfoPrim.tupleSize = 1;
+		AttributeInfoPrim.exists = true;
+		AttributeInfoPrim.owner = HAPI_ATTROWNER_PRIM;
+		AttributeInfoPrim.storage = HAPI_STORAGETYPE_INT;
+		AttributeInfoPrim.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		// Identify the cluster level using the parent indices:
-	
-		int32 ClusterIndex = -1;
-		TMap<int32, int32> & ClusterMap = LevelToClusterArray.FindOrAdd(Level);
-		int32 ParentIndex = Parent[GeometryIndex];
-		if (ParentIndex != FGeometryCollection::Invalid)
-		{
-			if (ClusterMap.Contains(ParentIndex))
-			{
-				ClusterIndex = ClusterMap[ParentIndex];
-			}
-			else
-			{
-				if (LevelToNewClusterIndex.Contains(Level))
-				{
-					LevelToNewClusterIndex[Level]++;
-					ClusterIndex = LevelToNewClusterIndex[Level];
-				}
-				else
-				{
-					ClusterIndex = 0;
-					LevelToNewClusterIndex.Add(Level, ClusterIndex);
-				}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), 
+			GeometryNodeId,	0, HAPI_UNREAL_ATTRIB_GC_PIECE, &AttributeInfoPrim), false);
 
-				ClusterMap.Add(ParentIndex, ClusterIndex);
-			}
-		}
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeIntData(
+			PrimLevels, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_GC_PIECE, AttributeInfoPrim, true), false);
+	}
 
-		// Add the unreal_gc_cluster attribute
-		{	
-			HAPI_AttributeInfo AttributeInfoPrim;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoPrim);
+	// Add the unreal_gc_cluster attribute
+	{	
+		HAPI_AttributeInfo AttributeInfoPrim;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPrim);
 
-			AttributeInfoPrim.count = Part.faceCount;
-			AttributeInfoPrim.tupleSize = 1;
-			AttributeInfoPrim.exists = true;
-			AttributeInfoPrim.owner = HAPI_ATTROWNER_PRIM;
-			AttributeInfoPrim.storage = HAPI_STORAGETYPE_INT;
-			AttributeInfoPrim.originalOwner = HAPI_ATTROWNER_INVALID;
+		AttributeInfoPrim.count = Part.faceCount;
+		AttributeInfoPrim.tupleSize = 1;
+		AttributeInfoPrim.exists = true;
+		AttributeInfoPrim.owner = HAPI_ATTROWNER_PRIM;
+		AttributeInfoPrim.storage = HAPI_STORAGETYPE_INT;
+		AttributeInfoPrim.originalOwner = HAPI_ATTROWNER_INVALID;
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(), 
-				GeometryNodeId,	0, HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE, &AttributeInfoPrim), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), 
+			GeometryNodeId,	0, HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE, &AttributeInfoPrim), false);
 
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeIntUniqueData(
-				ClusterIndex, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE, AttributeInfoPrim), false);
-		}
-		
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeIntData(
+			PrimClusters, GeometryNodeId, 0, HAPI_UNREAL_ATTRIB_GC_CLUSTER_PIECE, AttributeInfoPrim, true), false);
+	}
 
-		AddGeometryCollectionDetailAttributes(GeometryCollectionObject, GeometryNodeId, Part.id, Part, InName, GeometryCollectionComponent);
+	AddGeometryCollectionDetailAttributes(GeometryCollectionObject, GeometryNodeId, Part.id, Part, InName, GeometryCollectionComponent);
 
-		// Commit the geo.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-                        FHoudiniEngine::Get().GetSession(), GeometryNodeId), false);
+	// Commit the geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), GeometryNodeId), false);
 
-		// Connect the LOD node to the merge node.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
-			FHoudiniEngine::Get().GetSession(),
-			InMergeNodeId, GeometryIndex, GeometryNodeId, 0), false);
-		
-	}
+	// Connect the pieces node to the merge node.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(),
+		InMergeNodeId, 0, GeometryNodeId, 0), false);
 
 	return true;
 }
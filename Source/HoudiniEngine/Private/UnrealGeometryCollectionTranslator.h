@@ -32,6 +32,7 @@
 
 
 class UGeometryCollection;
+class FGeometryCollection;
 class AGeometryCollectionActor;
 class FUnrealObjectInputHandle;
 
@@ -54,6 +55,16 @@ struct HOUDINIENGINE_API FUnrealGeometryCollectionTranslator
 			HAPI_NodeId InNodeId,
 			FString InName);
 
+		// Fills the per primitive piece attributes of the single part uploaded by UploadGeometryCollection: the
+		// piece name, unreal_gc_piece and unreal_gc_cluster. OutPieceObjectIndices gets the transform index of each
+		// piece, in the order their primitives are written (geometry index order).
+		static void GetGeometryCollectionPieceAttributes(
+			FGeometryCollection* GeometryCollection,
+			TArray<int32>& OutPieceObjectIndices,
+			TArray<FString>& OutPrimNames,
+			TArray<int32>& OutPrimLevels,
+			TArray<int32>& OutPrimClusters);
+
 		static bool UploadGeometryCollection(
 			UGeometryCollection * GeometryCollectionObject, 
 			HAPI_NodeId InParentNodeId, 
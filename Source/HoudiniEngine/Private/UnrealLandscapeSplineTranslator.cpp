@@ -28,6 +28,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
 #include "UnrealObjectInputRuntimeTypes.h"
@@ -92,9 +93,21 @@ public:
 	/** The control point end-falloff. */
 	TArray<float> ControlPointEndFalloffs;
 
+	/**
+	 * Returns the path name of InObject, or an empty string if it is invalid. Path names are cached per object until
+	 * the next Init(), and are also used for the meshes / materials of the segments.
+	 */
+	const FString& GetCachedPathName(UObject const* InObject);
+
 private:
 	/** The expected number of points to store attributes for. Set in Init() when reserving space in the arrays. */ 
 	int32 ExpectedPointCount = 0;
+
+	/**
+	 * Path names of the meshes / materials referenced by the control points and segments. The same few assets are
+	 * usually referenced by most of them, so we avoid rebuilding their path names for every point / segment.
+	 */
+	TMap<UObject const*, FString> PathNames;
 };
 
 
@@ -226,6 +239,20 @@ FLandscapeSplineControlPointAttributes::Init(const int32 InExpectedPointCount)
 	ControlPointHalfWidths.Empty(ExpectedPointCount);
 	ControlPointSideFalloffs.Empty(ExpectedPointCount);
 	ControlPointEndFalloffs.Empty(ExpectedPointCount);
+	PathNames.Reset();
+}
+
+const FString&
+FLandscapeSplineControlPointAttributes::GetCachedPathName(UObject const* const InObject)
+{
+	static const FString EmptyPathName;
+	if (!IsValid(InObject))
+		return EmptyPathName;
+
+	if (FString const* const PathName = PathNames.Find(InObject))
+		return *PathName;
+
+	return PathNames.Add(InObject, InObject->GetPathName());
 }
 
 void
@@ -280,7 +307,7 @@ FLandscapeSplineControlPointAttributes::AddControlPointData(
 	ControlPointLowerTerrains.Add(InControlPoint->bLowerTerrain);
 
 	// Set the static mesh reference 
-	ControlPointMeshRefs.Emplace(IsValid(InControlPoint->Mesh) ? InControlPoint->Mesh->GetPathName() : FString());
+	ControlPointMeshRefs.Add(GetCachedPathName(InControlPoint->Mesh));
 
 	const int32 NumMaterialOverrides = InControlPoint->MaterialOverrides.Num();
 	if (PerMaterialOverrideControlPointRefs.Num() < NumMaterialOverrides)
@@ -294,7 +321,7 @@ FLandscapeSplineControlPointAttributes::AddControlPointData(
 			PerCPMaterialOverrideRefs.SetNum(ExpectedPointCount);
 
 		// Set the material ref or empty string if the material is invalid
-		PerCPMaterialOverrideRefs[InControlPointIndex] = IsValid(Material) ? Material->GetPathName() : FString(); 
+		PerCPMaterialOverrideRefs[InControlPointIndex] = GetCachedPathName(Material); 
 	}
 
 	ControlPointMeshScales.Add(InControlPoint->MeshScale.X);
@@ -1383,7 +1410,7 @@ bool FUnrealLandscapeSplineTranslator::ExtractLandscapeSplineData(
 				// Set mesh reference (if there is a valid mesh for this entry) 
 				if (IsValid(SplineMeshEntry.Mesh))
 				{
-					SegmentMeshData.MeshRefs[SegmentData.GlobalSegmentIndex] = SplineMeshEntry.Mesh->GetPathName();
+					SegmentMeshData.MeshRefs[SegmentData.GlobalSegmentIndex] = OutSplinesData.ControlPointAttributes.GetCachedPathName(SplineMeshEntry.Mesh);
 				}
 
 				// Material overrides: initialize the array to num material overrides
@@ -1410,7 +1437,7 @@ bool FUnrealLandscapeSplineTranslator::ExtractLandscapeSplineData(
 						continue;
 					}
 
-					MaterialOverrideRefs[SegmentData.GlobalSegmentIndex] = MaterialOverride->GetPathName();
+					MaterialOverrideRefs[SegmentData.GlobalSegmentIndex] = OutSplinesData.ControlPointAttributes.GetCachedPathName(MaterialOverride);
 				}
 				
 				// Initialize mesh scale per segment array if needed
@@ -1603,7 +1630,7 @@ FUnrealLandscapeSplineTranslator::AddLandscapeSplinePaintLayerNameAttribute(
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 		Session, InNodeId, 0, TCHAR_TO_ANSI(*AttributeName), &LayerNameAttrInfo), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeStringData(
+	HOUDINI_CHECK_ERROR_RETURN(SetLandscapeSplineStringAttributeData(
 		InPaintLayerNames, InNodeId, 0, AttributeName, LayerNameAttrInfo), false);
 
 	return true;
@@ -1730,7 +1757,7 @@ bool FUnrealLandscapeSplineTranslator::AddLandscapeSplineSegmentMeshesAttributes
 		if (HAPI_RESULT_SUCCESS == Result)
 		{
 			// Send the values to Houdini
-			HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniEngineUtils::HapiSetAttributeStringData(
+			HOUDINI_CHECK_ERROR_GET(&Result, SetLandscapeSplineStringAttributeData(
 				MeshSegmentData.MeshRefs, InNodeId, 0, MeshAttrName, MeshAttrInfo));
 			if (HAPI_RESULT_SUCCESS == Result)
 				bNeedToCommit = true;
@@ -1762,7 +1789,7 @@ bool FUnrealLandscapeSplineTranslator::AddLandscapeSplineSegmentMeshesAttributes
 				if (HAPI_RESULT_SUCCESS == FHoudiniApi::AddAttribute(Session, InNodeId, 0, TCHAR_TO_ANSI(*MaterialOverrideAttrName), &MatOverrideAttrInfo))
 				{
 					// Send the values to Houdini
-					HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniEngineUtils::HapiSetAttributeStringData(
+					HOUDINI_CHECK_ERROR_GET(&Result, SetLandscapeSplineStringAttributeData(
 						MeshSegmentData.MeshMaterialOverrideRefs[MaterialOverrideIdx], InNodeId, 0, MaterialOverrideAttrName, MatOverrideAttrInfo));
 					if (HAPI_RESULT_SUCCESS == Result)
 						bNeedToCommit = true;
@@ -1796,7 +1823,7 @@ FUnrealLandscapeSplineTranslator::AddLandscapeSplineConnectionSocketNameAttribut
 		Session, InNodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SOCKET_NAME,
 		&SocketNameAttrInfo), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeStringData(
+	HOUDINI_CHECK_ERROR_RETURN(SetLandscapeSplineStringAttributeData(
 		InPointConnectionSocketNames, InNodeId, 0, TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_MESH_SOCKET_NAME),
 		SocketNameAttrInfo), false);
 
@@ -1853,7 +1880,7 @@ FUnrealLandscapeSplineTranslator::AddLandscapeSplineControlPointMeshAttribute(
 		Session, InNodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH,
 		&MeshAttrInfo), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetAttributeStringData(
+	HOUDINI_CHECK_ERROR_RETURN(SetLandscapeSplineStringAttributeData(
 		InMeshRefs, InNodeId, 0, TEXT(HAPI_UNREAL_ATTRIB_LANDSCAPE_SPLINE_CONTROL_POINT_MESH),
 		MeshAttrInfo), false);
 
@@ -1900,7 +1927,7 @@ FUnrealLandscapeSplineTranslator::AddLandscapeSplineControlPointMaterialOverride
 		{
 			// Send the values to Houdini
 			HAPI_Result Result;
-			HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniEngineUtils::HapiSetAttributeStringData(
+			HOUDINI_CHECK_ERROR_GET(&Result, SetLandscapeSplineStringAttributeData(
 				InMaterialOverrideRefs[MaterialOverrideIdx], InNodeId, 0, MaterialOverrideAttrName, MatOverrideAttrInfo));
 			if (HAPI_RESULT_SUCCESS == Result)
 				bNeedToCommit = true;
@@ -2125,3 +2152,21 @@ FUnrealLandscapeSplineTranslator::AddLandscapeSplineControlPointAttributes(
 
 	return bNeedToCommit;
 }
+
+
+HAPI_Result
+FUnrealLandscapeSplineTranslator::SetLandscapeSplineStringAttributeData(
+	const TArray<FString>& InStrings,
+	const HAPI_NodeId& InNodeId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttributeName,
+	const HAPI_AttributeInfo& InAttributeInfo)
+{
+	// Landscape spline string attributes are mostly empty strings, layer names and the same handful of asset paths,
+	// so only send each unique value once and index into it.
+	FHoudiniEngineIndexedStringMap IndexedStrings;
+	IndexedStrings.SetStrings(InStrings);
+
+	return FHoudiniEngineUtils::HapiSetAttributeStringMap(
+		IndexedStrings, InNodeId, InPartId, InAttributeName, InAttributeInfo);
+}
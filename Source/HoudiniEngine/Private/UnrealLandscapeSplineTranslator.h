@@ -130,6 +130,9 @@ public:
 		HAPI_NodeId& OutNodeId);
 
 private:
+	// Sends indexed string attributes to a stand-in input node
+	friend class HoudiniEditorInputTest_LandscapeSpline_IndexedStrings;
+
 	/**
 	 * @brief Extract landscape splines data arrays: positions, and various attributes.
 	 * @param InSplinesComponent The landscape splines component.
@@ -235,4 +238,15 @@ private:
 
 	static bool AddLandscapeSplineControlPointAttributes(
 		const HAPI_NodeId& InNodeId, const FLandscapeSplineControlPointAttributes& InControlPointAttributes);
+
+	/**
+	 * Sends InStrings as indexed string attribute data: each unique string is only sent once.
+	 * The attribute must already have been added with InAttributeInfo.
+	 */
+	static HAPI_Result SetLandscapeSplineStringAttributeData(
+		const TArray<FString>& InStrings,
+		const HAPI_NodeId& InNodeId,
+		const HAPI_PartId& InPartId,
+		const FString& InAttributeName,
+		const HAPI_AttributeInfo& InAttributeInfo);
 };
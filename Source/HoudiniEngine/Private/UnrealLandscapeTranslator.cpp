@@ -53,6 +53,16 @@
 #include "HoudiniHLODLayerUtils.h"
 #include "HoudiniLandscapeUtils.h"
 
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeExportTileBudget(
+	TEXT("HoudiniEngine.LandscapeExportTileBudget"),
+	4 * 1024 * 1024,
+	TEXT("Maximum number of height values read and converted at once when sending a landscape to Houdini as a heightfield.\n")
+	TEXT("Two tiles are kept in memory, so that a tile can be converted while the previous one is being sent.\n")
+	TEXT("0: Send the whole landscape as a single tile\n")
+);
 
 bool 
 FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
@@ -295,18 +305,22 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	FString NodeName = InputNodeNameStr;
 
 	//--------------------------------------------------------------------------------------------------
-	// Extracting the height data
+	// Get the extent of the height data
 	//--------------------------------------------------------------------------------------------------
-	TArray<uint16> HeightData;
-	int32 XSize, YSize;
-	FVector Min, Max;
-	if (!GetLandscapeData(LandscapeProxy, HeightData, XSize, YSize, Min, Max))
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
 		return false;
 
+	int32 XSize = MaxX - MinX + 1;
+	int32 YSize = MaxY - MinY + 1;
+
 	//--------------------------------------------------------------------------------------------------
-	// Convert the height uint16 data to float
+	// Get the heightfield's volume info
 	//--------------------------------------------------------------------------------------------------
-	TArray<float> HeightfieldFloatValues;
 	HAPI_VolumeInfo HeightfieldVolumeInfo;
 	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
 
@@ -315,10 +329,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	// components.
 	FTransform LandscapeTransform = FHoudiniEngineRuntimeUtils::CalculateHoudiniLandscapeTransform(LandscapeProxy);
 
-	FVector CenterOffset = FVector::ZeroVector;
-	if (!ConvertLandscapeDataToHeightfieldData(
-		HeightData, XSize, YSize, Min, Max, LandscapeTransform,
-		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
+	if (!GetHeightfieldVolumeInfo(XSize, YSize, LandscapeTransform, HeightfieldVolumeInfo))
 		return false;
 
 	//--------------------------------------------------------------------------------------------------
@@ -335,9 +346,11 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	//--------------------------------------------------------------------------------------------------
 	// Set the HeightfieldData in Houdini
 	//--------------------------------------------------------------------------------------------------    
-	// Set the Height volume's data
+	// Set the Height volume's data, the height values are read, converted and sent one tile at a time
 	HAPI_PartId PartId = 0;
-	if (!SetHeightfieldData(HeightId, PartId, HeightfieldFloatValues, HeightfieldVolumeInfo, TEXT("height")))
+	if (!SetHeightfieldDataFromLandscape(
+		LandscapeInfo, MinX, MinY, MaxX, MaxY, LandscapeTransform,
+		HeightId, PartId, HeightfieldVolumeInfo, TEXT("height")))
 		return false;
 
 	// Apply attributes to the heightfield
@@ -351,8 +364,8 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	// Add Data Layers and HLODS
 	//--------------------------------------------------------------------------------------------------
 
-	int PrevNode = FHoudiniHLODLayerUtils::AddHLODAttributes(LandscapeProxy, ParentNodeId, HeightFieldId);
-	FHoudiniDataLayerUtils::AddGroupsFromDataLayers(LandscapeProxy, ParentNodeId, PrevNode);
+	// Data layers are added as groups directly on each volume, see ApplyAttributesToHeightfieldNode().
+	FHoudiniHLODLayerUtils::AddHLODAttributes(LandscapeProxy, ParentNodeId, HeightFieldId);
 
 	//--------------------------------------------------------------------------------------------------
 	// Define merge lambda, used below.
@@ -475,24 +488,16 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer.Guid ); // Scope landscape access to the current layer
 
-			TArray<uint16> LayerHeightData;
-			TArray<float> LayerHeightFloatData;
 			//--------------------------------------------------------------------------------------------------
-			// Extracting height data
+			// Extract, convert and send the layer's height data
 			//--------------------------------------------------------------------------------------------------
-			if (!GetLandscapeData(LandscapeProxy, LayerHeightData, XSize, YSize, Min, Max))
-				return false;
-
-			//--------------------------------------------------------------------------------------------------
-			// Convert the height uint16 data to float
-			//--------------------------------------------------------------------------------------------------
-			if (!ConvertLandscapeDataToHeightfieldData(
-				LayerHeightData, XSize, YSize, Min, Max, LandscapeTransform,
-				LayerHeightFloatData, LayerVolumeInfo, CenterOffset))
+			if (!GetHeightfieldVolumeInfo(XSize, YSize, LandscapeTransform, LayerVolumeInfo))
 				return false;
 
 			HAPI_PartId LayerPartId = 0;
-			SetHeightfieldData(LandscapeLayerNodeId, LayerPartId, LayerHeightFloatData, LayerVolumeInfo, LayerVolumeName);
+			SetHeightfieldDataFromLandscape(
+				LandscapeInfo, MinX, MinY, MaxX, MaxY, LandscapeTransform,
+				LandscapeLayerNodeId, LayerPartId, LayerVolumeInfo, LayerVolumeName);
 
 			// Apply attributes to the heightfield input node
 			ApplyAttributesToHeightfieldNode(LandscapeLayerNodeId, 0, LandscapeProxy);
@@ -1107,10 +1112,43 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		return false;
 
 	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
+		return false;
+
+	// Get the landscape Min/Max values
+	// Do not use Landscape->GetActorBounds() here as instanced geo
+	// (due to grass layers for example) can cause it to return incorrect bounds!
+	FVector3d Origin, Extent;
+	GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
+
+	// Get the landscape Min/Max values
+	Min = Origin - Extent;
+	Max = Origin + Extent;
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::GetLandscapeExtent(
+	ALandscapeProxy* LandscapeProxy,
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
+{
+	if (!LandscapeProxy)
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
 	
 	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
 	if (LandscapeProxy == Landscape)
@@ -1130,20 +1168,8 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		}
 	}
 
-	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
-		return false;
-
-	// Get the landscape Min/Max values
-	// Do not use Landscape->GetActorBounds() here as instanced geo
-	// (due to grass layers for example) can cause it to return incorrect bounds!
-	FVector3d Origin, Extent;
-	GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
-
-	// Get the landscape Min/Max values
-	Min = Origin - Extent;
-	Max = Origin + Extent;
-
-	return true;
+	// We need at least 2 points in each direction
+	return (MaxX > MinX) && (MaxY > MinY);
 }
 
 bool
@@ -1230,6 +1256,9 @@ FUnrealLandscapeTranslator::ApplyAttributesToHeightfieldNode(
 
 	// Add streaming poxy attribute
 	FHoudiniEngineUtils::AddLandscapeTypeAttribute(HeightId, PartId, LandscapeProxy, 1);
+
+	// Add the landscape's data layers as groups on the volume primitive
+	FHoudiniDataLayerUtils::AddGroupsFromDataLayers(LandscapeProxy, HeightId, PartId, 1);
 }
 
 
@@ -1256,22 +1285,27 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	if (IntHeightData.Num() != SizeInPoints)
 		return false;
 
-	// Use default unreal scaling for marshalling landscapes
-	// A lot of precision will be lost in order to keep the same transform as the landscape input
-	bool bUseDefaultUE4Scaling = false;
-	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling)
-		bUseDefaultUE4Scaling = HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling;
-
 	//--------------------------------------------------------------------------------------------------
 	// 1. Convert values to float
 	//--------------------------------------------------------------------------------------------------
+	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
+	ConvertLandscapeTileToHeightfieldData(
+		IntHeightData.GetData(), XSize, YSize, LandscapeTransform, HeightfieldFloatValues.GetData());
 
+	//--------------------------------------------------------------------------------------------------
+	// 2. Fill the volume info
+	//--------------------------------------------------------------------------------------------------
+	return GetHeightfieldVolumeInfo(XSize, YSize, LandscapeTransform, HeightfieldVolumeInfo);
+}
 
-	// Convert the min/max values from cm to meters
-	Min /= 100.0;
-	Max /= 100.0;
-
+void
+FUnrealLandscapeTranslator::ConvertLandscapeTileToHeightfieldData(
+	const uint16* IntHeightData,
+	const int32& TileXSize,
+	const int32& YSize,
+	const FTransform& LandscapeTransform,
+	float* HeightfieldFloatValues)
+{
 	// Unreal's landscape uses 16bits precision and range from -256m to 256m with the default scale of 100.0
 	// To convert the uint16 values to float "metric" values, offset the int by 32768 to center it,
 	// then scale it
@@ -1282,16 +1316,16 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 
 	// Center value in meters (Landscape ranges from [-255:257] meters at default scale
 	double ZCenterOffset = 32767;
-	double ZPositionOffset = LandscapeTransform.GetLocation().Z / 100.0f;
-	// Convert the Int data to Float
-	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+
+	// Houdini's X axis is Unreal's Y axis, so each column of the tile is a row of the heightfield
+	int32 HoudiniXSize = YSize;
+	for (int32 nY = 0; nY < TileXSize; nY++)
 	{
 		for (int32 nX = 0; nX < HoudiniXSize; nX++)
 		{
 			// We need to invert X/Y when reading the value from Unreal
 			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
+			int32 nUnreal = nY + nX * TileXSize;
 
 			// Convert the int values to meter
 			// Unreal's digit value have a zero value of 32768
@@ -1301,9 +1335,29 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
 		}
 	}
+}
+
+bool
+FUnrealLandscapeTranslator::GetHeightfieldVolumeInfo(
+	const int32& XSize,
+	const int32& YSize,
+	const FTransform& LandscapeTransform,
+	HAPI_VolumeInfo& HeightfieldVolumeInfo)
+{
+	int32 HoudiniXSize = YSize;
+	int32 HoudiniYSize = XSize;
+	if ((HoudiniXSize < 2) || (HoudiniYSize < 2))
+		return false;
+
+	// Use default unreal scaling for marshalling landscapes
+	// A lot of precision will be lost in order to keep the same transform as the landscape input
+	bool bUseDefaultUE4Scaling = false;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling)
+		bUseDefaultUE4Scaling = HoudiniRuntimeSettings->MarshallingLandscapesUseDefaultUnrealScaling;
 
 	//--------------------------------------------------------------------------------------------------
-	// 2. Convert the Unreal Transform to a HAPI_transform
+	// 1. Convert the Unreal Transform to a HAPI_transform
 	//--------------------------------------------------------------------------------------------------
 	HAPI_Transform HapiTransform;
 	FHoudiniApi::Transform_Init(&HapiTransform);
@@ -1349,7 +1403,7 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	}
 
 	//--------------------------------------------------------------------------------------------------
-	// 3. Fill the volume info
+	// 2. Fill the volume info
 	//--------------------------------------------------------------------------------------------------
 	HeightfieldVolumeInfo.xLength = HoudiniXSize;
 	HeightfieldVolumeInfo.yLength = HoudiniYSize;
@@ -1438,6 +1492,126 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::SetHeightfieldDataFromLandscape(
+	ULandscapeInfo* LandscapeInfo,
+	const int32& MinX, const int32& MinY,
+	const int32& MaxX, const int32& MaxY,
+	const FTransform& LandscapeTransform,
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const HAPI_VolumeInfo& VolumeInfo,
+	const FString& HeightfieldName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealLandscapeTranslator::SetHeightfieldDataFromLandscape);
+
+	if (!LandscapeInfo)
+		return false;
+
+	const int32 XSize = MaxX - MinX + 1;
+	const int32 YSize = MaxY - MinY + 1;
+	if ((XSize < 2) || (YSize < 2))
+		return false;
+
+	// Cook the node to get proper infos on it
+	if (!FHoudiniEngineUtils::HapiCookNode(VolumeNodeId, nullptr, true))
+		return false;
+
+	// Read the geo/part/volume info from the volume node
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniApi::GeoInfo_Init(&GeoInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(
+		FHoudiniEngine::Get().GetSession(),
+		VolumeNodeId, &GeoInfo), false);
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(),
+		GeoInfo.nodeId, PartId, &PartInfo), false);
+
+	// Update the volume infos
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVolumeInfo(
+		FHoudiniEngine::Get().GetSession(),
+		VolumeNodeId, PartInfo.id, &VolumeInfo), false);
+
+	// Each tile covers all the rows of a range of columns, since that maps to a contiguous range of the heightfield's values
+	const int32 TileBudget = CVarHoudiniEngineLandscapeExportTileBudget.GetValueOnAnyThread();
+	const int32 TileXSize = TileBudget > 0 ? FMath::Clamp(TileBudget / YSize, 1, XSize) : XSize;
+
+	// Extracting the uint16 values from the landscape 
+	FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+	// Ensure we're not triggering a checkout, as we're just reading data
+	LandscapeEdit.SetShouldDirtyPackage(false);
+
+	// Double buffer the tiles, so that a tile can be converted while the previous one is being sent
+	TArray<uint16> TileIntData[2];
+	TArray<float> TileFloatData[2];
+	TFuture<void> PendingConversion;
+	int32 PendingBuffer = INDEX_NONE;
+	int32 PendingStart = 0;
+
+	auto SendPendingTile = [&]() -> bool
+	{
+		if (PendingBuffer == INDEX_NONE)
+			return true;
+
+		const TArray<float>& FloatValues = TileFloatData[PendingBuffer];
+		PendingBuffer = INDEX_NONE;
+		return FHoudiniEngineUtils::HapiSetHeightFieldData(
+			GeoInfo.nodeId, PartInfo.id, FloatValues.GetData(), PendingStart, FloatValues.Num(), HeightfieldName) == HAPI_RESULT_SUCCESS;
+	};
+
+	bool bSuccess = true;
+	int32 TileIndex = 0;
+	for (int32 TileMinX = MinX; TileMinX <= MaxX; TileMinX += TileXSize, TileIndex++)
+	{
+		const int32 TileMaxX = FMath::Min(TileMinX + TileXSize - 1, MaxX);
+		const int32 CurTileXSize = TileMaxX - TileMinX + 1;
+		const int32 Buffer = TileIndex % 2;
+
+		// Read this tile while the previous one is being converted
+		TArray<uint16>& IntData = TileIntData[Buffer];
+		IntData.SetNumUninitialized(CurTileXSize * YSize);
+		LandscapeEdit.GetHeightDataFast(TileMinX, MinY, TileMaxX, MaxY, IntData.GetData(), 0);
+
+		if (PendingConversion.IsValid())
+			PendingConversion.Wait();
+
+		// Convert this tile in the background, and send the previous one meanwhile
+		TArray<float>& FloatData = TileFloatData[Buffer];
+		FloatData.SetNumUninitialized(CurTileXSize * YSize);
+		PendingConversion = Async(EAsyncExecution::ThreadPool, [&IntData, &FloatData, CurTileXSize, YSize, &LandscapeTransform]()
+		{
+			ConvertLandscapeTileToHeightfieldData(IntData.GetData(), CurTileXSize, YSize, LandscapeTransform, FloatData.GetData());
+		});
+
+		if (!SendPendingTile())
+		{
+			bSuccess = false;
+			break;
+		}
+
+		PendingBuffer = Buffer;
+		PendingStart = (TileMinX - MinX) * YSize;
+	}
+
+	// Send the last tile
+	if (PendingConversion.IsValid())
+		PendingConversion.Wait();
+
+	if (bSuccess)
+		bSuccess = SendPendingTile();
+
+	if (!bSuccess)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to set the heightfield data for volume %s."), *HeightfieldName);
+		return false;
+	}
+
+	return true;
+}
+
 bool FUnrealLandscapeTranslator::AddLandscapeMaterialAttributesToVolume(
 	const HAPI_NodeId& VolumeNodeId, 
 	const HAPI_PartId& PartId,
@@ -109,6 +109,12 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			int32& XSize, int32& YSize,
 			FVector3d& Min, FVector3d& Max);
 
+		// Gets the extent, in landscape quads, of the data to export for a given landscape proxy
+		static bool GetLandscapeExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
 		static bool GetLandscapeData(
 			ULandscapeInfo* LandscapeInfo,
 			const int32& MinX,
@@ -134,6 +140,36 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			FVector& CenterOffset);
 
+		// Fills the volume info of the heightfield matching a XSize by YSize landscape
+		static bool GetHeightfieldVolumeInfo(
+			const int32& XSize,
+			const int32& YSize,
+			const FTransform& LandscapeTransform,
+			HAPI_VolumeInfo& HeightfieldVolumeInfo);
+
+		// Converts a tile of Unreal uint16 values, TileXSize columns wide and YSize rows high, to Houdini float.
+		// Since X/Y are swapped in Houdini, the converted values are a contiguous range of the heightfield values,
+		// starting at the tile's first column * YSize.
+		static void ConvertLandscapeTileToHeightfieldData(
+			const uint16* IntHeightData,
+			const int32& TileXSize,
+			const int32& YSize,
+			const FTransform& LandscapeTransform,
+			float* HeightfieldFloatValues);
+
+		// Reads, converts and sends the height values of a landscape region to a heightfield volume, one tile of
+		// columns at a time. Each tile is converted while the previous one is being sent, and the tile size is
+		// limited by HoudiniEngine.LandscapeExportTileBudget.
+		static bool SetHeightfieldDataFromLandscape(
+			ULandscapeInfo* LandscapeInfo,
+			const int32& MinX, const int32& MinY,
+			const int32& MaxX, const int32& MaxY,
+			const FTransform& LandscapeTransform,
+			const HAPI_NodeId& VolumeNodeId,
+			const HAPI_PartId& PartId,
+			const HAPI_VolumeInfo& VolumeInfo,
+			const FString& HeightfieldName);
+
 		// Converts Unreal uint8 values to Houdini Float
 		static bool ConvertLandscapeLayerDataToHeightfieldData(
 			const TArray<uint8>& IntHeightData,
@@ -36,6 +36,7 @@
 
 FUnrealObjectInputManagerImpl::FUnrealObjectInputManagerImpl()
 	: WorldOriginNodeId()
+	, BatchDepth(0)
 {
 }
 
@@ -390,8 +391,12 @@ FUnrealObjectInputManagerImpl::EnsureParentsExist(
 		
 	FUnrealObjectInputHandle ParentHandle;
 	const bool bParentEntryExists = FindNode(ParentIdentifier, ParentHandle);
-	if (bParentEntryExists && AreHAPINodesValid(ParentIdentifier))
+	// In a batch, only validate the HAPI nodes of each container once
+	if (bParentEntryExists && (BatchValidatedContainers.Contains(ParentIdentifier) || AreHAPINodesValid(ParentIdentifier)))
 	{
+		if (BatchDepth > 0)
+			BatchValidatedContainers.Add(ParentIdentifier);
+
 		// Make sure we prevent node destruction if needed
 		if (!bInputNodesCanBeDeleted)
 			FUnrealObjectInputUtils::UpdateInputNodeCanBeDeleted(ParentHandle, bInputNodesCanBeDeleted);
@@ -444,6 +449,9 @@ FUnrealObjectInputManagerImpl::EnsureParentsExist(
 	else
 		UpdateContainer(ParentIdentifier, ParentNodeId);
 
+	if (BatchDepth > 0)
+		BatchValidatedContainers.Add(ParentIdentifier);
+
 	// Make sure we prevent node destruction if needed
 	if (!bInputNodesCanBeDeleted)
 		FUnrealObjectInputUtils::UpdateInputNodeCanBeDeleted(ParentHandle, bInputNodesCanBeDeleted);
@@ -476,6 +484,17 @@ FUnrealObjectInputManagerImpl::MarkAsDirty(const FUnrealObjectInputIdentifier& I
 	if (!Node)
 		return false;
 
+	// In a batch, only visit each node once (unless its referenced nodes must now be dirtied as well)
+	if (BatchDepth > 0)
+	{
+		const bool* const bDirtiedReferencedNodes = BatchDirtiedNodes.Find(InIdentifier);
+		if (bDirtiedReferencedNodes && Node->IsDirty() && (*bDirtiedReferencedNodes || !bInAlsoDirtyReferencedNodes))
+			return true;
+
+		const bool bAlsoDirtiedReferencedNodes = bInAlsoDirtyReferencedNodes || (bDirtiedReferencedNodes && *bDirtiedReferencedNodes);
+		BatchDirtiedNodes.Add(InIdentifier, bAlsoDirtiedReferencedNodes);
+	}
+
 	if (bInAlsoDirtyReferencedNodes && InIdentifier.GetNodeType() == EUnrealObjectInputNodeType::Reference)
 	{
 		FUnrealObjectInputReferenceNode* const RefNode = static_cast<FUnrealObjectInputReferenceNode*>(Node);
@@ -505,6 +524,94 @@ FUnrealObjectInputManagerImpl::ClearDirtyFlag(const FUnrealObjectInputIdentifier
 	return true;
 }
 
+void
+FUnrealObjectInputManagerImpl::BeginBatch()
+{
+	BatchDepth++;
+}
+
+int32
+FUnrealObjectInputManagerImpl::EndBatch()
+{
+	if (!ensure(BatchDepth > 0))
+		return 0;
+
+	BatchDepth--;
+	if (BatchDepth > 0)
+		return 0;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealObjectInputManagerImpl::EndBatch);
+
+	TArray<FUnrealObjectInputIdentifier> NodesToReconnect = BatchPendingReconnects.Array();
+	BatchPendingReconnects.Empty();
+	BatchDirtiedNodes.Empty();
+	BatchValidatedContainers.Empty();
+
+	// Reconnect the referenced reference nodes before the nodes that reference them
+	TMap<FUnrealObjectInputIdentifier, int32> Depths;
+	for (const FUnrealObjectInputIdentifier& Identifier : NodesToReconnect)
+		GetReferenceDepth(Identifier, Depths);
+	NodesToReconnect.StableSort([&Depths](const FUnrealObjectInputIdentifier& A, const FUnrealObjectInputIdentifier& B)
+	{
+		return Depths.FindRef(A) < Depths.FindRef(B);
+	});
+
+	// The nodes were validated when their reconnect was deferred, but they could have been deleted since
+	int32 NumReconnected = 0;
+	for (const FUnrealObjectInputIdentifier& Identifier : NodesToReconnect)
+	{
+		if (FUnrealObjectInputUtils::ConnectReferencedNodesToMerge(Identifier))
+		{
+			NumReconnected++;
+		}
+		else
+		{
+			HOUDINI_LOG_WARNING(
+				TEXT("[FUnrealObjectInputManagerImpl::EndBatch] Failed to reconnect the referenced nodes of %s."),
+				*Identifier.GetNormalizedObjectPath().ToString());
+		}
+	}
+
+	return NumReconnected;
+}
+
+bool
+FUnrealObjectInputManagerImpl::DeferReferenceNodeReconnect(const FUnrealObjectInputIdentifier& InIdentifier)
+{
+	if (BatchDepth <= 0)
+		return false;
+
+	if (!InIdentifier.IsValid() || InIdentifier.GetNodeType() != EUnrealObjectInputNodeType::Reference)
+		return false;
+
+	BatchPendingReconnects.Add(InIdentifier);
+	return true;
+}
+
+int32
+FUnrealObjectInputManagerImpl::GetReferenceDepth(
+	const FUnrealObjectInputIdentifier& InIdentifier,
+	TMap<FUnrealObjectInputIdentifier, int32>& InOutDepths) const
+{
+	if (const int32* const CachedDepth = InOutDepths.Find(InIdentifier))
+		return *CachedDepth;
+
+	// Record a depth before recursing, in case of reference cycles
+	InOutDepths.Add(InIdentifier, 0);
+
+	int32 Depth = 0;
+	FUnrealObjectInputNode const* Node = nullptr;
+	if (InIdentifier.GetNodeType() == EUnrealObjectInputNodeType::Reference && GetNodeByIdentifier(InIdentifier, Node) && Node)
+	{
+		FUnrealObjectInputReferenceNode const* const RefNode = static_cast<FUnrealObjectInputReferenceNode const*>(Node);
+		for (const FUnrealObjectInputHandle& Handle : RefNode->GetReferencedNodes())
+			Depth = FMath::Max(Depth, GetReferenceDepth(Handle.GetIdentifier(), InOutDepths) + 1);
+	}
+
+	InOutDepths.Add(InIdentifier, Depth);
+	return Depth;
+}
+
 bool
 FUnrealObjectInputManagerImpl::GetHAPINodeIds(const FUnrealObjectInputIdentifier& InIdentifier, TArray<FUnrealObjectInputHAPINodeId>& OutNodeIds) const
 {
@@ -589,6 +696,11 @@ FUnrealObjectInputManagerImpl::Clear()
 		Entry.Value = nullptr;
 	}
 	InputNodes.Empty();
+
+	BatchDirtiedNodes.Empty();
+	BatchValidatedContainers.Empty();
+	BatchPendingReconnects.Empty();
+
 	return true;
 }
 
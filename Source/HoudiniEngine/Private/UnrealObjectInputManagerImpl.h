@@ -142,6 +142,11 @@ public:
 	virtual bool MarkAsDirty(const FUnrealObjectInputIdentifier& InIdentifier, bool bInAlsoDirtyReferencedNodes) override;
 	virtual bool ClearDirtyFlag(const FUnrealObjectInputIdentifier& InIdentifier) override;
 
+	virtual void BeginBatch() override;
+	virtual int32 EndBatch() override;
+	virtual bool IsBatching() const override { return BatchDepth > 0; }
+	virtual bool DeferReferenceNodeReconnect(const FUnrealObjectInputIdentifier& InIdentifier) override;
+
 	virtual bool Clear() override;
 
 	virtual FUnrealObjectInputHAPINodeId GetWorldOriginNodeId(const bool bInCreateIfMissingOrInvalid=true) override;
@@ -165,6 +170,12 @@ protected:
 	/** Helper function to get FUnrealObjectInputNode entries by identifier (FUnrealObjectInputIdentifier). */
 	virtual bool GetNodeByIdentifier(const FUnrealObjectInputIdentifier& InputIdentifier, FUnrealObjectInputNode*& OutNode) const;
 
+	/**
+	 * Helper function that returns the reference depth of a node: 0 for nodes that do not reference other nodes,
+	 * otherwise 1 + the highest depth of its referenced nodes. InOutDepths caches the depths that were computed.
+	 */
+	int32 GetReferenceDepth(const FUnrealObjectInputIdentifier& InIdentifier, TMap<FUnrealObjectInputIdentifier, int32>& InOutDepths) const;
+
 private:
 	/** The input node entries by identifier. */
 	TMap<FUnrealObjectInputIdentifier, FUnrealObjectInputNode*> InputNodes;
@@ -178,4 +189,16 @@ private:
 	FOnNodeAddUpdateDelete OnNodeAddedDelegate;
 	FOnNodeAddUpdateDelete OnNodeUpdatedDelegate;
 	FOnNodeAddUpdateDelete OnNodeDeletedDelegate;
+
+	/** The number of nested batches that are open. See BeginBatch(). */
+	int32 BatchDepth;
+
+	/** Nodes dirtied in the current batch, and if their referenced nodes were dirtied as well. */
+	TMap<FUnrealObjectInputIdentifier, bool> BatchDirtiedNodes;
+
+	/** Container nodes that were validated (or created) in the current batch. */
+	TSet<FUnrealObjectInputIdentifier> BatchValidatedContainers;
+
+	/** Reference nodes that must be reconnected to their merge node when the batch ends. */
+	TSet<FUnrealObjectInputIdentifier> BatchPendingReconnects;
 };
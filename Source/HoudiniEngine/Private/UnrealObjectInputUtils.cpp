@@ -566,15 +566,19 @@ FUnrealObjectInputUtils::ConnectReferencedNodesToMerge(const FUnrealObjectInputI
 	if (!InRefNodeIdentifier.IsValid() || InRefNodeIdentifier.GetNodeType() != EUnrealObjectInputNodeType::Reference)
 		return false;
 
+	IUnrealObjectInputManager* const Manager = FUnrealObjectInputManager::Get();
+	if (!Manager)
+		return false;
+
 	if (!AreHAPINodesValid(InRefNodeIdentifier))
 		return false;
 	
 	if (!AreReferencedHAPINodesValid(InRefNodeIdentifier))
 		return false;
 
-	IUnrealObjectInputManager* const Manager = FUnrealObjectInputManager::Get();
-	if (!Manager)
-		return false;
+	// In a batch, the reconnect is done once for the node when the batch ends
+	if (Manager->DeferReferenceNodeReconnect(InRefNodeIdentifier))
+		return true;
 
 	FUnrealObjectInputNode* Node = nullptr;
 	if (!Manager->GetNode(InRefNodeIdentifier, Node))
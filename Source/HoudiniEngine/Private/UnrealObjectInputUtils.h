@@ -130,7 +130,8 @@ struct HOUDINIENGINE_API FUnrealObjectInputUtils
 		// Helper to set the node that references connect to (such as a Merge SOP) for a reference node in the input system	
 		static bool SetReferencesNodeConnectToNodeId(const FUnrealObjectInputIdentifier& InRefNodeIdentifier, HAPI_NodeId InNodeId);
 
-		// Helper to connect a reference node's referenced nodes to its merge SOP
+		// Helper to connect a reference node's referenced nodes to its merge SOP. Deferred to the end of the batch if the
+		// manager has an open batch (see IUnrealObjectInputManager::BeginBatch()).
 		static bool ConnectReferencedNodesToMerge(const FUnrealObjectInputIdentifier& InRefNodeIdentifier);
 
 		// Helper to create a SOP/merge for merging InReferencedNodes.
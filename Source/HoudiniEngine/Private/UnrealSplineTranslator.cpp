@@ -36,6 +36,94 @@
 #include "UnrealObjectInputRuntimeUtils.h"
 
 #include "Components/SplineComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineSplineSamplesCacheSize(
+	TEXT("HoudiniEngine.SplineSamplesCacheSize"),
+	1024,
+	TEXT("Maximum number of spline components whose samples are kept, to be reused when a spline input is re-exported unchanged.\n")
+	TEXT("0: Disabled, splines are sampled on every export\n")
+	TEXT("1024: Default\n"));
+
+// Samples of a spline component, as returned by FUnrealSplineTranslator::SampleSplineComponent().
+struct FHoudiniCachedSplineSamples
+{
+	// Hash of the spline data and resolution the samples were computed from.
+	uint32 Hash = 0;
+
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Scales;
+};
+
+static TMap<TObjectKey<USplineComponent>, FHoudiniCachedSplineSamples> CachedSplineSamples;
+
+// Number of cached samples left after the last sweep of the destroyed components.
+static int32 NumCachedSplineSamplesAfterSweep = 0;
+
+static uint32
+HashSplineVector(uint32 Hash, const FVector& Vector)
+{
+	Hash = HashCombine(Hash, GetTypeHash(Vector.X));
+	Hash = HashCombine(Hash, GetTypeHash(Vector.Y));
+	return HashCombine(Hash, GetTypeHash(Vector.Z));
+}
+
+static uint32
+HashSplineQuat(uint32 Hash, const FQuat& Quat)
+{
+	Hash = HashSplineVector(Hash, FVector(Quat.X, Quat.Y, Quat.Z));
+	return HashCombine(Hash, GetTypeHash(Quat.W));
+}
+
+// Hashes everything that affects the samples: the spline curves and their reparam table, the up vector used
+// to build the rotations, the component's world rotation and the sampling resolution.
+static uint32
+GetSplineSamplesHash(const USplineComponent* SplineComponent, const float SplineResolution)
+{
+	const FSplineCurves& Curves = SplineComponent->SplineCurves;
+
+	uint32 Hash = GetTypeHash(SplineResolution);
+	Hash = HashCombine(Hash, GetTypeHash(SplineComponent->IsClosedLoop()));
+	Hash = HashSplineVector(Hash, SplineComponent->DefaultUpVector);
+	Hash = HashSplineQuat(Hash, SplineComponent->GetComponentTransform().GetRotation());
+
+	for (const FInterpCurvePoint<FVector>& Point : Curves.Position.Points)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+		Hash = HashSplineVector(Hash, Point.OutVal);
+		Hash = HashSplineVector(Hash, Point.ArriveTangent);
+		Hash = HashSplineVector(Hash, Point.LeaveTangent);
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Point.InterpMode));
+	}
+
+	for (const FInterpCurvePoint<FQuat>& Point : Curves.Rotation.Points)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+		Hash = HashSplineQuat(Hash, Point.OutVal);
+		Hash = HashSplineQuat(Hash, Point.ArriveTangent);
+		Hash = HashSplineQuat(Hash, Point.LeaveTangent);
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Point.InterpMode));
+	}
+
+	for (const FInterpCurvePoint<FVector>& Point : Curves.Scale.Points)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+		Hash = HashSplineVector(Hash, Point.OutVal);
+		Hash = HashSplineVector(Hash, Point.ArriveTangent);
+		Hash = HashSplineVector(Hash, Point.LeaveTangent);
+		Hash = HashCombine(Hash, GetTypeHash((uint8)Point.InterpMode));
+	}
+
+	for (const FInterpCurvePoint<float>& Point : Curves.ReparamTable.Points)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+		Hash = HashCombine(Hash, GetTypeHash(Point.OutVal));
+	}
+
+	return Hash;
+}
 
 
 bool
@@ -121,46 +209,11 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(
 		}
 	}
 	
-	int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
-	float SplineLength = SplineComponent->GetSplineLength();
-
-	// Calculate the number of refined point we want
-	int32 NumberOfRefinedSplinePoints = SplineResolution > 0.0f ? ceil(SplineLength / SplineResolution) + 1 : NumberOfControlPoints;
-
 	TArray<FVector> RefinedSplinePositions;
 	TArray<FQuat> RefinedSplineRotations;
 	TArray<FVector> RefinedSplineScales;
-	if (NumberOfRefinedSplinePoints <= NumberOfControlPoints) 
-	{
-		// There's not enough refined points, so we'll use the control points instead
-		RefinedSplinePositions.SetNumZeroed(NumberOfControlPoints);
-		RefinedSplineRotations.SetNumZeroed(NumberOfControlPoints);
-		RefinedSplineScales.SetNumZeroed(NumberOfControlPoints);
-
-		for (int32 n = 0; n < NumberOfControlPoints; ++n) 
-		{
-			RefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-			RefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
-			RefinedSplineScales[n] = SplineComponent->GetScaleAtSplinePoint(n);
-		}
-	}
-	else 
-	{
-		// Calculate the refined spline component
-		RefinedSplinePositions.SetNumZeroed(NumberOfRefinedSplinePoints);
-		RefinedSplineRotations.SetNumZeroed(NumberOfRefinedSplinePoints);
-		RefinedSplineScales.SetNumZeroed(NumberOfRefinedSplinePoints);
-
-		float CurrentDistance = 0.0f;
-		for (int32 n = 0; n < NumberOfRefinedSplinePoints; ++n) 
-		{
-			RefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(CurrentDistance, ESplineCoordinateSpace::Local);
-			RefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(CurrentDistance, ESplineCoordinateSpace::World);
-			RefinedSplineScales[n] = SplineComponent->GetScaleAtDistanceAlongSpline(CurrentDistance);
-
-			CurrentDistance += SplineResolution;
-		}
-	}
+	if (!SampleSplineComponent(SplineComponent, SplineResolution, RefinedSplinePositions, RefinedSplineRotations, RefinedSplineScales))
+		return false;
 
 	// Currently, we must create legacy curves when using the new input system
 	// as the new HAPI_CreateInputCurveNode function does not support choosing a parent node!
@@ -237,3 +290,145 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(
 
 	return true;
 }
+
+bool
+FUnrealSplineTranslator::SampleSplineComponent(
+	const USplineComponent* SplineComponent,
+	const float& SplineResolution,
+	TArray<FVector>& OutPositions,
+	TArray<FQuat>& OutRotations,
+	TArray<FVector>& OutScales)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealSplineTranslator::SampleSplineComponent);
+
+	if (!IsValid(SplineComponent))
+		return false;
+
+	// Reuse the previous samples if neither the spline nor the resolution have changed
+	const uint32 Hash = GetSplineSamplesHash(SplineComponent, SplineResolution);
+	const TObjectKey<USplineComponent> CacheKey(SplineComponent);
+	if (const FHoudiniCachedSplineSamples* CachedSamples = CachedSplineSamples.Find(CacheKey))
+	{
+		if (CachedSamples->Hash == Hash)
+		{
+			OutPositions = CachedSamples->Positions;
+			OutRotations = CachedSamples->Rotations;
+			OutScales = CachedSamples->Scales;
+			return true;
+		}
+	}
+
+	int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+	float SplineLength = SplineComponent->GetSplineLength();
+
+	// Calculate the number of refined point we want
+	int32 NumberOfRefinedSplinePoints = SplineResolution > 0.0f ? ceil(SplineLength / SplineResolution) + 1 : NumberOfControlPoints;
+
+	if (NumberOfRefinedSplinePoints <= NumberOfControlPoints) 
+	{
+		// There's not enough refined points, so we'll use the control points instead
+		OutPositions.SetNumZeroed(NumberOfControlPoints);
+		OutRotations.SetNumZeroed(NumberOfControlPoints);
+		OutScales.SetNumZeroed(NumberOfControlPoints);
+
+		for (int32 n = 0; n < NumberOfControlPoints; ++n) 
+		{
+			OutPositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
+			OutRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+			OutScales[n] = SplineComponent->GetScaleAtSplinePoint(n);
+		}
+	}
+	else 
+	{
+		// Calculate the refined spline component
+		OutPositions.SetNumZeroed(NumberOfRefinedSplinePoints);
+		OutRotations.SetNumZeroed(NumberOfRefinedSplinePoints);
+		OutScales.SetNumZeroed(NumberOfRefinedSplinePoints);
+
+		// The reparam table maps distances along the spline to input keys, with linear interpolation between its
+		// points. Since the sampled distances only increase, we can walk the table forward once instead of searching
+		// it for every sample, and then evaluate the location, rotation and scale at the same input key.
+		const TArray<FInterpCurvePoint<float>>& ReparamPoints = SplineComponent->SplineCurves.ReparamTable.Points;
+		const int32 NumReparamPoints = ReparamPoints.Num();
+		int32 ReparamIndex = 0;
+
+		float CurrentDistance = 0.0f;
+		for (int32 n = 0; n < NumberOfRefinedSplinePoints; ++n) 
+		{
+			float InputKey = 0.0f;
+			if (NumReparamPoints > 0)
+			{
+				while (ReparamIndex < NumReparamPoints - 1 && ReparamPoints[ReparamIndex + 1].InVal <= CurrentDistance)
+					ReparamIndex++;
+
+				const FInterpCurvePoint<float>& Start = ReparamPoints[ReparamIndex];
+				if (ReparamIndex == NumReparamPoints - 1 || CurrentDistance <= Start.InVal)
+				{
+					InputKey = Start.OutVal;
+				}
+				else
+				{
+					const FInterpCurvePoint<float>& End = ReparamPoints[ReparamIndex + 1];
+					const float SegmentLength = End.InVal - Start.InVal;
+					const float Alpha = SegmentLength > 0.0f ? (CurrentDistance - Start.InVal) / SegmentLength : 0.0f;
+					InputKey = FMath::Lerp(Start.OutVal, End.OutVal, Alpha);
+				}
+			}
+
+			OutPositions[n] = SplineComponent->GetLocationAtSplineInputKey(InputKey, ESplineCoordinateSpace::Local);
+			OutRotations[n] = SplineComponent->GetQuaternionAtSplineInputKey(InputKey, ESplineCoordinateSpace::World);
+			OutScales[n] = SplineComponent->GetScaleAtSplineInputKey(InputKey);
+
+			CurrentDistance += SplineResolution;
+		}
+	}
+
+	const int32 MaxCachedSplineSamples = CVarHoudiniEngineSplineSamplesCacheSize.GetValueOnAnyThread();
+	if (MaxCachedSplineSamples <= 0)
+	{
+		ClearSplineSamplesCache();
+		return true;
+	}
+
+	if (!CachedSplineSamples.Contains(CacheKey))
+	{
+		// Only sweep the samples of destroyed components once the cache has doubled since the last sweep,
+		// so that misses don't have to walk the whole cache.
+		if (CachedSplineSamples.Num() >= FMath::Max(2 * NumCachedSplineSamplesAfterSweep, 64)
+			|| CachedSplineSamples.Num() >= MaxCachedSplineSamples)
+		{
+			for (auto It = CachedSplineSamples.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().ResolveObjectPtr())
+					It.RemoveCurrent();
+			}
+
+			// All the cached components are still alive, start over rather than growing past the limit
+			if (CachedSplineSamples.Num() >= MaxCachedSplineSamples)
+				CachedSplineSamples.Reset();
+
+			NumCachedSplineSamplesAfterSweep = CachedSplineSamples.Num();
+		}
+	}
+
+	FHoudiniCachedSplineSamples& NewSamples = CachedSplineSamples.FindOrAdd(CacheKey);
+	NewSamples.Hash = Hash;
+	NewSamples.Positions = OutPositions;
+	NewSamples.Rotations = OutRotations;
+	NewSamples.Scales = OutScales;
+
+	return true;
+}
+
+void
+FUnrealSplineTranslator::ClearSplineSamplesCache()
+{
+	CachedSplineSamples.Empty();
+	NumCachedSplineSamplesAfterSweep = 0;
+}
+
+int32
+FUnrealSplineTranslator::GetNumCachedSplineSamples()
+{
+	return CachedSplineSamples.Num();
+}
@@ -44,4 +44,19 @@ public:
 		const bool& bInUseLegacyInputCurves,
 		const bool& bInputNodesCanBeDeleted = true);
 
+	// Samples the spline every SplineResolution units along its length, or at its control points if that would
+	// produce fewer points. Positions are in local space, rotations in world space.
+	// The samples are cached per component and reused as long as the spline and the resolution are unchanged.
+	static bool SampleSplineComponent(
+		const USplineComponent* SplineComponent,
+		const float& SplineResolution,
+		TArray<FVector>& OutPositions,
+		TArray<FQuat>& OutRotations,
+		TArray<FVector>& OutScales);
+
+	// Removes all cached spline samples.
+	static void ClearSplineSamplesCache();
+
+	// Returns the number of spline components whose samples are cached.
+	static int32 GetNumCachedSplineSamples();
 };
\ No newline at end of file
@@ -1237,9 +1237,13 @@ FHoudiniEngineCommands::RestartSession()
 		return;
 
 	// We've successfully restarted the Houdini Engine session,
-	// We now need to notify all the HoudiniAssetComponent that they need to re instantiate 
+	// Restore the HoudiniAssetComponents that were saved in the last snapshot of the previous session.
+	TSet<UHoudiniAssetComponent*> RestoredHACs;
+	FHoudiniEngineUtils::RestoreSessionSnapshot(RestoredHACs);
+
+	// We now need to notify all the other HoudiniAssetComponent that they need to re instantiate 
 	// themselves in the new Houdini engine session.
-	FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation();
+	FHoudiniEngineUtils::MarkAllHACsAsNeedInstantiation(RestoredHACs);
 }
 
 void 
@@ -1162,6 +1162,10 @@ FHoudiniEngineDetails::CreateAssetOptionsWidgets(
 
 			NextHAC->bCookOnParameterChange = bChecked;
 			NextHAC->MarkPackageDirty();
+
+			// Let the manager look for the changes made while cooking on change was disabled
+			if (bChecked && FHoudiniEngineRuntime::IsInitialized())
+				FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(NextHAC.Get());
 		}
 	};
 
@@ -38,6 +38,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineCommands.h"
 #include "HoudiniEngineEditorUtils.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineStyle.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniGeoPartObject.h"
@@ -1720,6 +1721,8 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 	PreBeginPIEEditorDelegateHandle = FEditorDelegates::PreBeginPIE.AddLambda([this](const bool bIsSimulating){	this->HandleOnBeginPIE(); });
 
+	OnMapOpenedEditorDelegateHandle = FEditorDelegates::OnMapOpened.AddLambda([this](const FString& Filename, bool bAsTemplate){ this->HandleOnMapOpened(); });
+
 	OnDeleteActorsBegin = FEditorDelegates::OnDeleteActorsBegin.AddLambda([this](){ this->HandleOnDeleteActorsBegin(); });
 	OnDeleteActorsEnd = FEditorDelegates::OnDeleteActorsEnd.AddLambda([this](){ this-> HandleOnDeleteActorsEnd(); });
 }
@@ -1739,6 +1742,9 @@ FHoudiniEngineEditor::UnregisterEditorDelegates()
 	if (EndPIEEditorDelegateHandle.IsValid())
 		FEditorDelegates::EndPIE.Remove(EndPIEEditorDelegateHandle);
 
+	if (OnMapOpenedEditorDelegateHandle.IsValid())
+		FEditorDelegates::OnMapOpened.Remove(OnMapOpenedEditorDelegateHandle);
+
 	if (OnDeleteActorsBegin.IsValid())
 		FEditorDelegates::OnDeleteActorsBegin.Remove(OnDeleteActorsBegin);
 
@@ -1921,6 +1927,30 @@ FHoudiniEngineEditor::HandleOnBeginPIE()
 	FHoudiniEngineCommands::RefineHoudiniProxyMeshesToStaticMeshes(bSelectedOnly, bSilent, bRefineAll, bOnPreSaveWorld, OnPreSaveWorld, bOnPreBeginPIE);
 }
 
+void
+FHoudiniEngineEditor::HandleOnMapOpened()
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	// Gather the distinct HDAs used by the components of the level
+	TArray<const UHoudiniAsset*> HoudiniAssets;
+	const int32 ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 Idx = 0; Idx < ComponentCount; Idx++)
+	{
+		UHoudiniAssetComponent* HAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(Idx);
+		if (!IsValid(HAC) || HAC->IsTemplate())
+			continue;
+
+		const UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+		if (IsValid(HoudiniAsset))
+			HoudiniAssets.AddUnique(HoudiniAsset);
+	}
+
+	// Load them in the background so they are ready when the HACs are instantiated
+	FHoudiniEngineUtils::PreloadHoudiniAssets(HoudiniAssets);
+}
+
 void
 FHoudiniEngineEditor::HandleOnDeleteActorsBegin()
 {
@@ -276,6 +276,10 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// This allows proper refinement of Proxies to Static Mesh
 		void HandleOnBeginPIE();
 
+		// Handle Map Opened event
+		// Preloads the HDAs used by the level in the current session
+		void HandleOnMapOpened();
+
 		// For the Houdini category sections in the UI
 		void RegisterSectionMappings();
 		void UnregisterSectionMappings();
@@ -391,6 +395,9 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Delegate handle for the EndPIE editor delegate
 		FDelegateHandle EndPIEEditorDelegateHandle;
 
+		// Delegate handle for the OnMapOpened editor delegate
+		FDelegateHandle OnMapOpenedEditorDelegateHandle;
+
 		// Delegate handle for OnDeleteActorsBegin
 		FDelegateHandle OnDeleteActorsBegin;
 
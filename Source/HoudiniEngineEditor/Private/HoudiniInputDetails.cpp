@@ -42,6 +42,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniPackageParams.h"
 #include "HoudiniSplineComponentVisualizer.h"
+#include "SHoudiniDetailsRowContent.h"
 #include "UnrealObjectInputRuntimeUtils.h"
 
 #include "ActorTreeItem.h"
@@ -200,12 +201,6 @@ FHoudiniInputDetails::CreateWidget(
 	if (!IsValidWeakPointer(MainInput))
 		return;
 
-	// Get thumbnail pool for this builder.
-	TSharedPtr< FAssetThumbnailPool > AssetThumbnailPool = HouInputCategory.GetParentLayout().GetThumbnailPool();
-	
-	EHoudiniInputType MainInputType = MainInput->GetInputType();
-	UHoudiniAssetComponent* HAC = MainInput->GetTypedOuter<UHoudiniAssetComponent>();
-
 	// Create a widget row, or get the given row.
 	FDetailWidgetRow* Row = InputRow;
 	FString InputRowString = MainInput->GetInputLabel() + " " + MainInput->GetInputName();
@@ -218,6 +213,35 @@ FHoudiniInputDetails::CreateWidget(
 	if (!InputRow)
 		CreateNameWidget(MainInput, *Row, true, InInputs.Num());
 
+	// The input's widgets are rebuilt in place when the input changes, without rebuilding the whole details panel
+	Row->ValueWidget.Widget = SNew(SHoudiniDetailsRowContent)
+		.RowObject(MainInput)
+		.OnBuildContent_Lambda([&HouInputCategory, InInputs]()
+		{
+			return FHoudiniInputDetails::CreateInputWidgets(HouInputCategory, InInputs);
+		});
+
+	Row->ValueWidget.MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
+	//Row.ValueWidget.Widget->SetEnabled(!MainParam->IsDisabled());
+
+}
+
+TSharedRef<SWidget>
+FHoudiniInputDetails::CreateInputWidgets(
+	IDetailCategoryBuilder& HouInputCategory,
+	const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputs)
+{
+	if (InInputs.Num() <= 0 || !IsValidWeakPointer(InInputs[0]))
+		return SNullWidget::NullWidget;
+
+	if (!HouInputCategory.IsParentLayoutValid())
+		return SNullWidget::NullWidget;
+
+	const TWeakObjectPtr<UHoudiniInput>& MainInput = InInputs[0];
+
+	// Get thumbnail pool for this builder.
+	TSharedPtr< FAssetThumbnailPool > AssetThumbnailPool = HouInputCategory.GetParentLayout().GetThumbnailPool();
+
 	// Create a vertical Box for storing the UI
 	TSharedRef< SVerticalBox > VerticalBox = SNew(SVerticalBox);
 
@@ -246,12 +270,23 @@ FHoudiniInputDetails::CreateWidget(
 		break;
 	}
 
+	return VerticalBox;
+}
 
-	Row->ValueWidget.Widget = VerticalBox;
-
-	Row->ValueWidget.MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
-	//Row.ValueWidget.Widget->SetEnabled(!MainParam->IsDisabled());
+void
+FHoudiniInputDetails::RefreshInputWidgets(
+	IDetailCategoryBuilder& CategoryBuilder,
+	const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputs)
+{
+	bool bRowFound = false;
+	for (const TWeakObjectPtr<UHoudiniInput>& CurInput : InInputs)
+	{
+		if (IsValidWeakPointer(CurInput))
+			bRowFound |= SHoudiniDetailsRowContent::RequestRebuildFor(CurInput.Get());
+	}
 
+	if (!bRowFound && CategoryBuilder.IsParentLayoutValid())
+		CategoryBuilder.GetParentLayout().ForceRefreshDetails();
 }
 
 void
@@ -274,7 +309,12 @@ FHoudiniInputDetails::CreateNameWidget(
 			SNew(STextBlock)
 			.Text(FinalInputLabelText)
 			.ToolTipText(InputTooltip)
-			.Font(_GetEditorStyle().GetFontStyle(!InInput->HasChanged() ? TEXT("PropertyWindow.NormalFont") : TEXT("PropertyWindow.BoldFont")));
+			.Font_Lambda([InInput]()
+			{
+				// Bound, as the name widget isn't rebuilt with the input's widgets
+				const bool bHasChanged = IsValidWeakPointer(InInput) && InInput->HasChanged();
+				return _GetEditorStyle().GetFontStyle(bHasChanged ? TEXT("PropertyWindow.BoldFont") : TEXT("PropertyWindow.NormalFont"));
+			});
 	}
 }
 
@@ -307,7 +347,7 @@ FHoudiniInputDetails::AddInputTypeComboBox(IDetailCategoryBuilder& CategoryBuild
 	};
 
 	// Lambda for changing inputs type
-	auto OnSelChanged = [DetailsPanelName](const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputsToUpdate, TSharedPtr<FString> InNewChoice)
+	auto OnSelChanged = [DetailsPanelName, &CategoryBuilder](const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputsToUpdate, TSharedPtr<FString> InNewChoice)
 	{
 		if (!InNewChoice.IsValid())
 			return;
@@ -334,6 +374,7 @@ FHoudiniInputDetails::AddInputTypeComboBox(IDetailCategoryBuilder& CategoryBuild
 			MainInput->GetOuter());
 
 		bool bBlueprintStructureModified = false;
+		bool bCurveComponentsChanged = NewInputType == EHoudiniInputType::Curve;
 
 		for (auto CurInput : InInputsToUpdate)
 		{
@@ -343,6 +384,9 @@ FHoudiniInputDetails::AddInputTypeComboBox(IDetailCategoryBuilder& CategoryBuild
 			if (CurInput->GetInputType() == NewInputType)
 				continue;
 
+			if (CurInput->GetInputType() == EHoudiniInputType::Curve)
+				bCurveComponentsChanged = true;
+
 			/*  This causes multiple issues. It does not set reset the previous type variable to Invalid sometimes
 				and it causes re-cook infinitely after few undo changing type.
 			{
@@ -361,9 +405,6 @@ FHoudiniInputDetails::AddInputTypeComboBox(IDetailCategoryBuilder& CategoryBuild
 				CurInput->SetInputType(NewInputType, bBlueprintStructureModified);   // pass in false for 2nd parameter in order to avoid creating default curve if empty
 			}
 			CurInput->MarkChanged(true);
-
-			FHoudiniEngineEditorUtils::ReselectSelectedActors();
-
 		}
 
 		if (HAB)
@@ -372,6 +413,12 @@ FHoudiniInputDetails::AddInputTypeComboBox(IDetailCategoryBuilder& CategoryBuild
 				HAB->MarkAsBlueprintStructureModified();
 		}
 
+		// Curve inputs add or remove spline components, which need the actors to be reselected to show up.
+		// Other input types only need their own widgets to be rebuilt.
+		if (bCurveComponentsChanged)
+			FHoudiniEngineEditorUtils::ReselectSelectedActors();
+		else
+			RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 	};
 
 	const TWeakObjectPtr<UHoudiniInput>& MainInput = InInputs[0];
@@ -3054,8 +3101,7 @@ FHoudiniInputDetails::AddCurveInputUI(
 		if (bBlueprintStructureModified)
 			FHoudiniEngineRuntimeUtils::MarkBlueprintAsStructurallyModified(OuterHAC);
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, { MainInput });
 	};
 
 	auto CurveInputsStateChanged = [MainInput, InInputs, &CategoryBuilder](bool bIsExpanded)
@@ -3087,8 +3133,7 @@ FHoudiniInputDetails::AddCurveInputUI(
 			if (GEditor)
 				GEditor->RedrawAllViewports();
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputs);
 		}
 	};
 
@@ -3221,8 +3266,7 @@ FHoudiniInputDetails::AddCurveInputUI(
 					FHoudiniEngineRuntimeUtils::MarkBlueprintAsStructurallyModified(OuterComponent);
 				}
 
-				if (CategoryBuilder.IsParentLayoutValid())
-					CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+				RefreshInputWidgets(CategoryBuilder, InInputs);
 				return FReply::Handled();
 			})
 			.Content()
@@ -3390,9 +3434,16 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 	bool bUseLegacyCurve = HoudiniSplineComponent->IsLegacyInputCurve();
 	FString CurveName = HoudiniSplineComponent->GetHoudiniSplineName();
 	int32 NumCurvePoints = HoudiniSplineComponent->GetCurvePointCount();
-	bool bIsClosed = HoudiniSplineComponent->IsClosedCurve();
-	bool bIsReversed = HoudiniSplineComponent->IsReversed();
-	bool bIsVisible = HoudiniSplineComponent->IsHoudiniSplineVisible();
+	// The closed / reversed / visible check boxes read the spline's current state, so toggling them
+	// does not require rebuilding the details panel.
+	TWeakObjectPtr<UHoudiniSplineComponent> WeakSplineComponent(HoudiniSplineComponent);
+	auto GetSplineCheckState = [WeakSplineComponent](bool (UHoudiniSplineComponent::*GetState)() const)
+	{
+		if (!IsValidWeakPointer(WeakSplineComponent))
+			return ECheckBoxState::Unchecked;
+
+		return (WeakSplineComponent.Get()->*GetState)() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	};
 
 	auto GetHoudiniSplineComponentAtIdx = [](const TWeakObjectPtr<UHoudiniInput>& InInput, int32 Idx)
 	{
@@ -3455,11 +3506,10 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 			CurInput->DeleteInputObjectAt(EHoudiniInputType::Curve, InObjIdx);
 		}
 		
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, InInputs);
 	};
 
-	auto ChangedClosedCurve = [GetHoudiniSplineComponentAtIdx, InInputs, InObjIdx, OuterHAC, &CategoryBuilder](ECheckBoxState NewState)
+	auto ChangedClosedCurve = [GetHoudiniSplineComponentAtIdx, InInputs, InObjIdx, OuterHAC](ECheckBoxState NewState)
 	{
 		if (!IsValid(OuterHAC))
 			return;
@@ -3488,12 +3538,9 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 			HoudiniSplineComponent->SetClosedCurve(bNewState);
 			HoudiniSplineComponent->MarkChanged(true);
 		}
-
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
 	};
 
-	auto ChangedReversedCurve = [GetHoudiniSplineComponentAtIdx, InInputs, InObjIdx, OuterHAC, &CategoryBuilder](ECheckBoxState NewState)
+	auto ChangedReversedCurve = [GetHoudiniSplineComponentAtIdx, InInputs, InObjIdx, OuterHAC](ECheckBoxState NewState)
 	{
 		if (!IsValid(OuterHAC))
 			return;
@@ -3521,12 +3568,9 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 			HoudiniSplineComponent->SetReversed(bNewState);
 			HoudiniSplineComponent->MarkChanged(true);
 		}
-
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
 	};
 
-	auto ChangedVisibleCurve = [GetHoudiniSplineComponentAtIdx, InInputs, OuterHAC, InObjIdx, &CategoryBuilder](ECheckBoxState NewState)
+	auto ChangedVisibleCurve = [GetHoudiniSplineComponentAtIdx, InInputs, OuterHAC, InObjIdx](ECheckBoxState NewState)
 	{
 		if (!IsValid(OuterHAC))
 			return;
@@ -3553,9 +3597,6 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 			HoudiniSplineComponent->SetHoudiniSplineVisible(bNewState);
 		}
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
-
 		if (GEditor)
 			GEditor->RedrawAllViewports();
 	};
@@ -3665,8 +3706,8 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 				.ToolTipText(LOCTEXT("CurveClosedCheckBoxTip", "Toggle whether this curve is closed."))
 				.Font(_GetEditorStyle().GetFontStyle(TEXT("PropertyWindow.NormalFont")))
 			]
-			.IsChecked_Lambda([bIsClosed]() {
-				return bIsClosed ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			.IsChecked_Lambda([GetSplineCheckState]() {
+				return GetSplineCheckState(&UHoudiniSplineComponent::IsClosedCurve);
 			})
 			.OnCheckStateChanged_Lambda([=](ECheckBoxState NewState)
 			{
@@ -3686,12 +3727,12 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 				.ToolTipText(LOCTEXT("CurveReversedCheckBoxTip", "Toggle whether this curve is reversed."))
 				.Font(_GetEditorStyle().GetFontStyle(TEXT("PropertyWindow.NormalFont")))
 			]
-			.IsChecked_Lambda([bIsReversed]() {
-				return bIsReversed ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			.IsChecked_Lambda([GetSplineCheckState]() {
+				return GetSplineCheckState(&UHoudiniSplineComponent::IsReversed);
 			})
 			.OnCheckStateChanged_Lambda([=](ECheckBoxState NewState)
 			{
-				return ChangedVisibleCurve(NewState);
+				return ChangedReversedCurve(NewState);
 			})
 		]
 		+ SHorizontalBox::Slot()
@@ -3707,8 +3748,8 @@ FHoudiniInputDetails::Helper_CreateCurveWidgetExpanded(
 				.ToolTipText(LOCTEXT("CurveVisibleCheckBoxTip", "Toggle whether this curve is visible."))
 				.Font(_GetEditorStyle().GetFontStyle(TEXT("PropertyWindow.NormalFont")))
 			]
-			.IsChecked_Lambda([bIsVisible]() {
-				return bIsVisible ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			.IsChecked_Lambda([GetSplineCheckState]() {
+				return GetSplineCheckState(&UHoudiniSplineComponent::IsHoudiniSplineVisible);
 			})
 			.OnCheckStateChanged_Lambda([=](ECheckBoxState NewState)
 			{
@@ -4778,8 +4819,7 @@ FHoudiniInputDetails::Helper_AddCurvePointSelectionUI(
 		if (GEditor)
 			GEditor->RedrawAllViewports();
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, InInputs);
 	};
 
 	InVerticalBox->AddSlot()
@@ -5154,8 +5194,7 @@ FHoudiniInputDetails::Helper_AddCurvePointSelectionUI(
 			CurInput->SetCurvePointSelectionUseAbsLocation(bNewState);
 		}
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 	};
 
 	FMenuBuilder LocationMenu(true, NULL, NULL);
@@ -5322,8 +5361,7 @@ FHoudiniInputDetails::Helper_AddCurvePointSelectionUI(
 			CurInput->SetCurvePointSelectionUseAbsRotation(bNewState);
 		}
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 	};
 
 	FMenuBuilder RotationMenu(true, NULL, NULL);
@@ -5542,8 +5580,7 @@ FHoudiniInputDetails::Helper_AddCurvePointSelectionUI(
 						CurInputObject->SwitchUniformScaleLock();
 					}
 
-					if (CategoryBuilder.IsParentLayoutValid())
-						CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+					RefreshInputWidgets(CategoryBuilder, InInputs);
 			
 					return FReply::Handled();
 				})
@@ -5756,8 +5793,7 @@ FHoudiniInputDetails::AddGeometryInputUI(
 			if (GEditor)
 				GEditor->RedrawAllViewports();
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 		}
 	};
 
@@ -5790,8 +5826,7 @@ FHoudiniInputDetails::AddGeometryInputUI(
 			if (GEditor)
 				GEditor->RedrawAllViewports();
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputs);
 		}
 	};
 
@@ -5991,8 +6026,7 @@ FHoudiniInputDetails::AddWorldInputUI(
 		if (GEditor)
 			GEditor->RedrawAllViewports();
 
-		if (CategoryBuilder.IsParentLayoutValid())
-			CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+		RefreshInputWidgets(CategoryBuilder, InInputs);
 	};
 
 	TSharedRef<SVerticalBox> Inputs_VerticalBox = SNew(SVerticalBox);
@@ -6067,8 +6101,7 @@ FHoudiniInputDetails::AddWorldInputUI(
 				CurInput->MarkChanged(true);
 			}
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputs);
 		})
 	];
 
@@ -6207,8 +6240,7 @@ FHoudiniInputDetails::AddWorldInputUI(
 						CurInput->SetBoundSelectorObjectsNumber(0);
 						CurInput->UpdateWorldSelectionFromBoundSelectors();
 
-						if (CategoryBuilder.IsParentLayoutValid())
-							CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+						RefreshInputWidgets(CategoryBuilder, InInputs);
 					}
 					else
 					{
@@ -6340,8 +6372,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectCollapsed(
 			CurInput->SetInputObjectAt(EHoudiniInputType::Geometry, AtIndex, InObject);
 			CurInput->MarkChanged(true);
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 		}
 	};
 
@@ -6490,8 +6521,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 			CurInput->SetInputObjectAt(EHoudiniInputType::Geometry, AtIndex, InObject);
 			CurInput->MarkChanged(true);
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputsToUpdate);
 		}
 	};
 
@@ -6744,8 +6774,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 				CurInput->Modify();
 			}
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputs);
 
 			return FReply::Handled();
 		})
@@ -6781,8 +6810,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 					CurInput->InsertInputObjectAt(EHoudiniInputType::Geometry, InObjectIdx);
 				}
 
-				if (CategoryBuilder.IsParentLayoutValid())
-					CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+				RefreshInputWidgets(CategoryBuilder, InInputs);
 			}),
 			TAttribute<FText>(LOCTEXT("GeometryInputAdd", "Add a new geometry input object above.")))
 	];
@@ -6817,8 +6845,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 				CurInput->DuplicateInputObjectAt(EHoudiniInputType::Geometry, InObjectIdx);
 			}
 
-			if (CategoryBuilder.IsParentLayoutValid())
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+			RefreshInputWidgets(CategoryBuilder, InInputs);
 
 			return FReply::Handled();
 		})
@@ -6858,8 +6885,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 						GEditor->RedrawAllViewports();
 				}
 
-				if (CategoryBuilder.IsParentLayoutValid())
-					CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+				RefreshInputWidgets(CategoryBuilder, InInputs);
 			}),
 			TAttribute<FText>(LOCTEXT("GeometryInputDelete", "Delete this geometry input object.")))
 	];
@@ -6929,30 +6955,32 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 		}
 	};
 
-	// Get Visibility of reset buttons
-	bool bResetButtonVisiblePosition = false;
-	bool bResetButtonVisibleRotation = false;
-	bool bResetButtonVisibleScale = false;
-
-	for (auto& CurInput : InInputs)
+	// Get Visibility of reset buttons. This is evaluated from the current offsets, so resetting or editing
+	// an offset does not require rebuilding the details panel.
+	auto GetResetButtonVisibility = [InInputs, InObjectIdx](const int32& PosRotScaleIndex)
 	{
-		if (!IsValidWeakPointer(CurInput))
-			continue;
+		for (auto& CurInput : InInputs)
+		{
+			if (!IsValidWeakPointer(CurInput))
+				continue;
 
-		FTransform* CurTransform = CurInput->GetTransformOffset(InObjectIdx);
-		if (!CurTransform)
-			continue;
+			FTransform* CurTransform = CurInput->GetTransformOffset(InObjectIdx);
+			if (!CurTransform)
+				continue;
 
-		if (CurTransform->GetLocation() != FVector3d::ZeroVector)
-			bResetButtonVisiblePosition = true;
+			if (PosRotScaleIndex == 0 && CurTransform->GetLocation() != FVector3d::ZeroVector)
+				return EVisibility::Visible;
 
-		FRotator Rotator = CurTransform->Rotator();
-		if (Rotator.Roll != 0 || Rotator.Pitch != 0 || Rotator.Yaw != 0)
-			bResetButtonVisibleRotation = true;
+			FRotator Rotator = CurTransform->Rotator();
+			if (PosRotScaleIndex == 1 && (Rotator.Roll != 0 || Rotator.Pitch != 0 || Rotator.Yaw != 0))
+				return EVisibility::Visible;
 
-		if (CurTransform->GetScale3D() != FVector3d::OneVector)
-			bResetButtonVisibleScale = true;
-	}
+			if (PosRotScaleIndex == 2 && CurTransform->GetScale3D() != FVector3d::OneVector)
+				return EVisibility::Visible;
+		}
+
+		return EVisibility::Hidden;
+	};
 
 	auto ChangeTransformOffsetUniformlyAt = [InObjectIdx, InInputs, ChangeTransformOffsetAt](const float& Val, const int32& PosRotScaleIndex)
 	{
@@ -7028,17 +7056,14 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 				.ButtonStyle(_GetEditorStyle(), "NoBorder")
 				.ClickMethod(EButtonClickMethod::MouseDown)
 				.ToolTipText(LOCTEXT("GeoInputResetButtonToolTip", "Reset To Default"))
-				.Visibility(bResetButtonVisiblePosition ? EVisibility::Visible : EVisibility::Hidden)
+				.Visibility_Lambda([GetResetButtonVisibility]() { return GetResetButtonVisibility(0); })
 				[
 					SNew(SImage)
 					.Image(_GetEditorStyle().GetBrush("PropertyWindow.DiffersFromDefault"))
 				]
-				.OnClicked_Lambda([MainInput, ChangeTransformOffsetUniformlyAt, &CategoryBuilder]()
+				.OnClicked_Lambda([ChangeTransformOffsetUniformlyAt]()
 				{
 					ChangeTransformOffsetUniformlyAt(0.0f, 0);
-					if (CategoryBuilder.IsParentLayoutValid())
-						CategoryBuilder.GetParentLayout().ForceRefreshDetails();
-
 					return FReply::Handled();
 				})
 			]
@@ -7105,17 +7130,14 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 				.ButtonStyle(_GetEditorStyle(), "NoBorder")
 				.ClickMethod(EButtonClickMethod::MouseDown)
 				.ToolTipText(LOCTEXT("GeoInputResetButtonToolTip", "Reset To Default"))
-				.Visibility(bResetButtonVisibleRotation ? EVisibility::Visible : EVisibility::Hidden)
+				.Visibility_Lambda([GetResetButtonVisibility]() { return GetResetButtonVisibility(1); })
 				[
 					SNew(SImage)
 					.Image(_GetEditorStyle().GetBrush("PropertyWindow.DiffersFromDefault"))
 				]
-				.OnClicked_Lambda([ChangeTransformOffsetUniformlyAt, MainInput, &CategoryBuilder]()
+				.OnClicked_Lambda([ChangeTransformOffsetUniformlyAt]()
 				{
 					ChangeTransformOffsetUniformlyAt(0.0f, 1);
-					if (CategoryBuilder.IsParentLayoutValid())
-						CategoryBuilder.GetParentLayout().ForceRefreshDetails();
-
 					return FReply::Handled();
 				})
 			]
@@ -7215,8 +7237,7 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 
 					if (HoudiniInputObject)
 					{
-						if (CategoryBuilder.IsParentLayoutValid())
-							CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+						RefreshInputWidgets(CategoryBuilder, InInputs);
 					}
 
 					return FReply::Handled();
@@ -7232,17 +7253,14 @@ FHoudiniInputDetails::Helper_CreateGeometryInputObjectExpanded(
 				.ButtonStyle(_GetEditorStyle(), "NoBorder")
 				.ClickMethod(EButtonClickMethod::MouseDown)
 				.ToolTipText(LOCTEXT("GeoInputResetButtonToolTip", "Reset To Default"))
-				.Visibility(bResetButtonVisibleScale ? EVisibility::Visible : EVisibility::Hidden)
+				.Visibility_Lambda([GetResetButtonVisibility]() { return GetResetButtonVisibility(2); })
 				[
 					SNew(SImage)
 					.Image(_GetEditorStyle().GetBrush("PropertyWindow.DiffersFromDefault"))
 				]
-				.OnClicked_Lambda([ChangeTransformOffsetUniformlyAt, MainInput, &CategoryBuilder]()
+				.OnClicked_Lambda([ChangeTransformOffsetUniformlyAt]()
 				{
 					ChangeTransformOffsetUniformlyAt(1.0f, 2);
-					if (CategoryBuilder.IsParentLayoutValid())
-						CategoryBuilder.GetParentLayout().ForceRefreshDetails();
-
 					return FReply::Handled();
 				})
 			]
@@ -49,6 +49,17 @@ class FHoudiniInputDetails : public TSharedFromThis<FHoudiniInputDetails, ESPMod
 			IDetailCategoryBuilder& HouInputCategoryBuilder,
 			const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputs, FDetailWidgetRow* InputRow = nullptr);
 
+		// Creates the widgets shown in the value column of an input's row
+		static TSharedRef<SWidget> CreateInputWidgets(
+			IDetailCategoryBuilder& HouInputCategoryBuilder,
+			const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputs);
+
+		// Rebuilds the row of the edited inputs after a change to what they display.
+		// Only falls back to rebuilding the whole details panel if the inputs are not shown by an input row.
+		static void RefreshInputWidgets(
+			IDetailCategoryBuilder& CategoryBuilder,
+			const TArray<TWeakObjectPtr<UHoudiniInput>>& InInputs);
+
 		static void CreateNameWidget(
 			const TWeakObjectPtr<UHoudiniInput>& InParam,
 			FDetailWidgetRow & Row,
@@ -54,6 +54,7 @@
 #include "HoudiniEngineEditorPrivatePCH.h"
 #include "HoudiniEngineDetails.h"
 #include "SNewFilePathPicker.h"
+#include "SHoudiniDetailsRowContent.h"
 
 #include "DetailCategoryBuilder.h"
 #include "DetailLayoutBuilder.h"
@@ -1026,7 +1027,7 @@ SHoudiniFloatRampCurveEditor::OnMouseButtonUp(const FGeometry& MyGeometry, const
 
 	if (bNeedToRefreshEditor)
 	{
-		FHoudiniEngineUtils::UpdateEditorProperties(MainParam, true);
+		FHoudiniParameterDetails::RefreshParameterWidgets(MainParam);
 	}
 
 	return Reply;
@@ -1295,7 +1296,7 @@ UHoudiniFloatRampCurve::OnCurveChanged(const TArray<FRichCurveEditInfo>& Changed
 
 	if (bNeedUpdateEditor)
 	{
-		FHoudiniEngineUtils::UpdateEditorProperties(MainParam, true);
+		FHoudiniParameterDetails::RefreshParameterWidgets(MainParam);
 	}
 
 }
@@ -1781,7 +1782,7 @@ UHoudiniColorRampCurve::OnColorRampCurveChanged(bool bModificationOnly)
 
 	if (bNeedUpdateEditor)
 	{
-		FHoudiniEngineUtils::UpdateEditorProperties(MainParam, true);
+		FHoudiniParameterDetails::RefreshParameterWidgets(MainParam);
 	}
 }
 
@@ -2710,7 +2711,11 @@ FHoudiniParameterDetails::CreateWidgetFloat(
 					.Visibility(EVisibility::Visible)
 					[
 						SNew(SImage)
-						.Image(MainParam->IsUniformLocked() ? _GetEditorStyle().GetBrush("Genericlock") : _GetEditorStyle().GetBrush("GenericUnlock"))
+						.Image_Lambda([MainParam]()
+						{
+							const bool bLocked = IsValidWeakPointer(MainParam) && MainParam->IsUniformLocked();
+							return bLocked ? _GetEditorStyle().GetBrush("Genericlock") : _GetEditorStyle().GetBrush("GenericUnlock");
+						})
 					]
 					.OnClicked_Lambda([FloatParams, MainParam]()
 					{
@@ -2725,8 +2730,6 @@ FHoudiniParameterDetails::CreateWidgetFloat(
 							CurParam->SwitchUniformLock();
 						}
 
-						FHoudiniEngineUtils::UpdateEditorProperties(MainParam.Get(), true);
-
 						return FReply::Handled();
 					})
 				]
@@ -4309,8 +4312,7 @@ FHoudiniParameterDetails::CreateWidgetFloatRamp(IDetailCategoryBuilder & HouPara
 		if (FloatRampParameter) 
 		{
 			CurrentRampFloat = FloatRampParameter;
-			FDetailWidgetRow *Row = CreateWidgetRampCurveEditor(HouParameterCategory, InParams);
-			CreateWidgetRampPoints(HouParameterCategory, Row, FloatRampParameter, InParams);
+			CreateWidgetRampCurveEditor(HouParameterCategory, InParams);
 			//FloatRampParameter->SetDefaultValues();
 		}
 	}
@@ -4467,8 +4469,7 @@ FHoudiniParameterDetails::CreateWidgetColorRamp(IDetailCategoryBuilder & HouPara
 		if (RampColor) 
 		{
 			CurrentRampColor = RampColor;
-			FDetailWidgetRow *Row = CreateWidgetRampCurveEditor(HouParameterCategory, InParams);
-			CreateWidgetRampPoints(HouParameterCategory, Row, RampColor, InParams);
+			CreateWidgetRampCurveEditor(HouParameterCategory, InParams);
 			//RampColor->SetDefaultValues();
 		}
 	}
@@ -4491,17 +4492,46 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 	if (!Row)
 		return nullptr;
 
-	Row->ValueWidget.Widget->SetEnabled(!MainParam->IsDisabled());
-
 	// Create the standard parameter name widget with an added autoupdate checkbox.
 	CreateNameWidgetWithAutoUpdate(Row, InParams, true);
 
+	// The curve editor and the ramp points are rebuilt in place when the points are edited
+	TWeakPtr<FHoudiniParameterDetails, ESPMode::NotThreadSafe> WeakThis = AsShared();
+	Row->ValueWidget.Widget = SNew(SHoudiniDetailsRowContent)
+		.RowObject(MainParam)
+		.OnBuildContent_Lambda([WeakThis, &HouParameterCategory, InParams]() -> TSharedRef<SWidget>
+		{
+			TSharedPtr<FHoudiniParameterDetails, ESPMode::NotThreadSafe> ParameterDetails = WeakThis.Pin();
+			if (!ParameterDetails.IsValid() || !HouParameterCategory.IsParentLayoutValid())
+				return SNullWidget::NullWidget;
+
+			return ParameterDetails->CreateWidgetRampContent(HouParameterCategory, InParams);
+		});
+
+	Row->ValueWidget.Widget->SetEnabled(!MainParam->IsDisabled());
+	Row->ValueWidget.MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
+	Row->ValueWidget.MaxDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
+
+	return Row;
+}
+
+
+TSharedRef<SWidget>
+FHoudiniParameterDetails::CreateWidgetRampContent(IDetailCategoryBuilder & HouParameterCategory, const TArray<TWeakObjectPtr<UHoudiniParameter>> &InParams)
+{
+	if (InParams.Num() <= 0)
+		return SNullWidget::NullWidget;
+
+	const TWeakObjectPtr<UHoudiniParameter>& MainParam = InParams[0];
+	if (!IsValidWeakPointer(MainParam))
+		return SNullWidget::NullWidget;
+
 	TSharedRef<SVerticalBox> VerticalBox = SNew(SVerticalBox);	
 	if (MainParam->GetParameterType() == EHoudiniParameterType::ColorRamp)
 	{
 		UHoudiniParameterRampColor *RampColorParam = Cast<UHoudiniParameterRampColor>(MainParam);
 		if (!RampColorParam)
-			return nullptr;
+			return SNullWidget::NullWidget;
 		
 		TSharedPtr<SHoudiniColorRampCurveEditor> ColorGradientEditor;
 		VerticalBox->AddSlot()
@@ -4518,7 +4548,7 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 		];
 
 		if (!ColorGradientEditor.IsValid())
-			return nullptr;
+			return SNullWidget::NullWidget;
 
 		// Avoid showing tooltips inside of the curve editor
 		ColorGradientEditor->EnableToolTipForceField(true);
@@ -4527,7 +4557,7 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 				GetTransientPackage(), UHoudiniColorRampCurve::StaticClass(), NAME_None, RF_Transactional | RF_Public);
 
 		if (!CurrentRampParameterColorCurve)
-			return nullptr;
+			return SNullWidget::NullWidget;
 
 		CreatedColorRampCurves.Add(CurrentRampParameterColorCurve);
 
@@ -4557,7 +4587,7 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 	{
 		UHoudiniParameterRampFloat *RampFloatParam = Cast<UHoudiniParameterRampFloat>(MainParam);
 		if (!RampFloatParam)
-			return nullptr;
+			return SNullWidget::NullWidget;
 
 		TSharedPtr<SHoudiniFloatRampCurveEditor> FloatCurveEditor;
 		VerticalBox->AddSlot()
@@ -4591,7 +4621,7 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 		];
 
 		if (!FloatCurveEditor.IsValid())
-			return nullptr;
+			return SNullWidget::NullWidget;
 
 		// Avoid showing tooltips inside of the curve editor
 		FloatCurveEditor->EnableToolTipForceField(true);
@@ -4600,7 +4630,7 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 				GetTransientPackage(), UHoudiniFloatRampCurve::StaticClass(), NAME_None, RF_Transactional | RF_Public);
 
 		if (!CurrentRampParameterFloatCurve)
-			return nullptr;
+			return SNullWidget::NullWidget;
 
 		CreatedFloatRampCurves.Add(CurrentRampParameterFloatCurve);
 
@@ -4619,18 +4649,16 @@ FHoudiniParameterDetails::CreateWidgetRampCurveEditor(IDetailCategoryBuilder & H
 		CreatedFloatCurveEditors.Add(FloatCurveEditor);
 	}
 
-	Row->ValueWidget.Widget = VerticalBox;
-	Row->ValueWidget.MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
-	Row->ValueWidget.MaxDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
+	CreateWidgetRampPoints(HouParameterCategory, VerticalBox, MainParam.Get(), InParams);
 
-	return Row;
+	return VerticalBox;
 }
 
 
 void 
-FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& CategoryBuilder, FDetailWidgetRow* Row, UHoudiniParameter* InParameter, const TArray<TWeakObjectPtr<UHoudiniParameter>>& InParams) 
+FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& CategoryBuilder, TSharedRef<SVerticalBox> VerticalBox, UHoudiniParameter* InParameter, const TArray<TWeakObjectPtr<UHoudiniParameter>>& InParams) 
 {
-	if (!Row || !InParameter)
+	if (!InParameter)
 		return;
 
 	if (InParams.Num() < 1)
@@ -4879,7 +4907,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 	};
 	
 	int32 RowIndex = 0;
-	auto InsertRampPoint_Lambda = [GetInsertColorPointLambda, GetInsertFloatPointLambda, &CategoryBuilder, bCookingEnabled](
+	auto InsertRampPoint_Lambda = [GetInsertColorPointLambda, GetInsertFloatPointLambda, bCookingEnabled](
 		const TWeakObjectPtr<UHoudiniParameterRampFloat>& MainRampFloat, 
 		const TWeakObjectPtr<UHoudiniParameterRampColor>& MainRampColor, 
 		const TArray<TWeakObjectPtr<UHoudiniParameterRampFloat>> &RampFloatList,
@@ -4929,7 +4957,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 
 			if (!(MainRampFloat->IsAutoUpdate() && bCookingEnabled))
 			{
-				CategoryBuilder.GetParentLayout().ForceRefreshDetails();
+				RefreshParameterWidgets(MainRampFloat.Get());
 			}
 
 		}
@@ -4971,7 +4999,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 
 			if (!(MainRampColor->IsAutoUpdate() && bCookingEnabled))
 			{
-				FHoudiniEngineUtils::UpdateEditorProperties(MainRampColor.Get(), true);
+				RefreshParameterWidgets(MainRampColor.Get());
 			}
 		}
 	};
@@ -5032,7 +5060,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 
 			if (!(MainRampFloat->IsAutoUpdate() && bCookingEnabled))
 			{
-				FHoudiniEngineUtils::UpdateEditorProperties(MainRampFloat.Get(), true);
+				RefreshParameterWidgets(MainRampFloat.Get());
 			}
 		}
 		else
@@ -5085,14 +5113,12 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 
 			if (!(MainRampColor->IsAutoUpdate() && bCookingEnabled))
 			{
-				FHoudiniEngineUtils::UpdateEditorProperties(MainRampColor.Get(), true);
+				RefreshParameterWidgets(MainRampColor.Get());
 			}
 		}
 	};
 
 
-	TSharedRef<SVerticalBox> VerticalBox = StaticCastSharedRef<SVerticalBox>(Row->ValueWidget.Widget);
-
 	TSharedPtr<SUniformGridPanel> GridPanel;
 	VerticalBox->AddSlot()
 	.Padding(2, 2, 5, 2)
@@ -5309,7 +5335,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 				}
 
 				if (!(MainRampFloat->IsAutoUpdate() && bCookingEnabled))
-					FHoudiniEngineUtils::UpdateEditorProperties(MainRampFloat.Get(), true);
+					RefreshParameterWidgets(MainRampFloat.Get());
 			}
 		}
 		else if (MainRampColor.IsValid() && MainRampColorPoint.IsValid())
@@ -5414,7 +5440,7 @@ FHoudiniParameterDetails::CreateWidgetRampPoints(IDetailCategoryBuilder& Categor
 				}
 
 				if (!(MainRampColor->IsAutoUpdate() && bCookingEnabled))
-					FHoudiniEngineUtils::UpdateEditorProperties(MainRampColor.Get(), true);
+					RefreshParameterWidgets(MainRampColor.Get());
 			}
 		}
 	};
@@ -5998,9 +6024,8 @@ FHoudiniParameterDetails::CreateFolderHeaderUI(IDetailCategoryBuilder& HouParame
 				return FReply::Handled();
 			
 			MainParam->ExpandButtonClicked();
-			
-			FHoudiniEngineUtils::UpdateEditorProperties(MainParam.Get(), true);
 
+			// Rows are added / removed: rebuild the details once
 			HouParameterCategory.GetParentLayout().ForceRefreshDetails();
 
 			return FReply::Handled();
@@ -6237,7 +6262,6 @@ FHoudiniParameterDetails::CreateWidgetMultiParm(IDetailCategoryBuilder & HouPara
 	// Add multiparm UI.
 	TSharedRef<SHorizontalBox> HorizontalBox = SNew(SHorizontalBox);
 	TSharedPtr< SNumericEntryBox< int32 > > NumericEntryBox;
-	int32 NumericalCount = MainParam->MultiParmInstanceCount;
 	HorizontalBox->AddSlot().Padding(2, 2, 5, 2)
 		[
 			SAssignNew(NumericEntryBox, SNumericEntryBox< int32 >)
@@ -6247,7 +6271,14 @@ FHoudiniParameterDetails::CreateWidgetMultiParm(IDetailCategoryBuilder & HouPara
 		.OnValueChanged(SNumericEntryBox<int32>::FOnValueChanged::CreateLambda([OnInstanceValueChangedLambda](int32 InValue) {
 				OnInstanceValueChangedLambda(InValue);
 		}))
-		.Value(NumericalCount)
+		// Bound, so the count follows instances added / removed until the cook rebuilds the instance rows
+		.Value_Lambda([MainParam]()
+		{
+			if (!IsValidWeakPointer(MainParam))
+				return TOptional<int32>();
+
+			return TOptional<int32>(MainParam->GetNextInstanceCount());
+		})
 		];
 
 	HorizontalBox->AddSlot().AutoWidth().Padding(2.0f, 0.0f)
@@ -6535,6 +6566,13 @@ FHoudiniParameterDetails::PruneStack()
 	}
 }
 
+void
+FHoudiniParameterDetails::RefreshParameterWidgets(UHoudiniParameter* InParam)
+{
+	if (!SHoudiniDetailsRowContent::RequestRebuildFor(InParam))
+		FHoudiniEngineUtils::UpdateEditorProperties(InParam, true);
+}
+
 FText
 FHoudiniParameterDetails::GetParameterTooltip(const TWeakObjectPtr<UHoudiniParameter>& InParam)
 {
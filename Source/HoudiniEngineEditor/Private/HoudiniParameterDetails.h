@@ -352,6 +352,10 @@ class FHoudiniParameterDetails : public TSharedFromThis<FHoudiniParameterDetails
 
 		static FText GetParameterTooltip(const TWeakObjectPtr<UHoudiniParameter>& InParam);
 
+		// Rebuilds the row of the edited parameter after a change to what it displays.
+		// Only falls back to updating the whole details panel if the parameter is not shown by a rebuildable row.
+		static void RefreshParameterWidgets(UHoudiniParameter* InParam);
+
 		static FString GetParameterTypeString(const EHoudiniParameterType& InType, const int32& InTupleSize);
 
 		static void SyncCachedColorRampPoints(UHoudiniParameterRampColor* ColorRampParameter);
@@ -422,11 +426,14 @@ class FHoudiniParameterDetails : public TSharedFromThis<FHoudiniParameterDetails
 
 		void CreateWidgetMultiParmObjectButtons(TSharedPtr<SHorizontalBox> HorizontalBox, const TArray<TWeakObjectPtr<UHoudiniParameter>>& InParams); //
 	
-		// Create the UI for ramp's curve editor.
+		// Create the row for ramp's curve editor and stop points.
 		FDetailWidgetRow* CreateWidgetRampCurveEditor(IDetailCategoryBuilder & HouParameterCategory, const TArray<TWeakObjectPtr<UHoudiniParameter>> &InParams); //
 
+		// Create the ramp's curve editor and stop points shown in the value column of its row.
+		TSharedRef<SWidget> CreateWidgetRampContent(IDetailCategoryBuilder & HouParameterCategory, const TArray<TWeakObjectPtr<UHoudiniParameter>> &InParams);
+
 		// Create the UI for ramp's stop points.
-		void CreateWidgetRampPoints(IDetailCategoryBuilder& CategoryBuilder, FDetailWidgetRow* Row, UHoudiniParameter* InParameter,
+		void CreateWidgetRampPoints(IDetailCategoryBuilder& CategoryBuilder, TSharedRef<SVerticalBox> VerticalBox, UHoudiniParameter* InParameter,
 								    const TArray<TWeakObjectPtr<UHoudiniParameter>>& InParams); //
 
 		void PruneStack();
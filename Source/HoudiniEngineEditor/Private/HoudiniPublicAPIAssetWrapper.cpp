@@ -32,6 +32,7 @@
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniEngineCommands.h"
 #include "HoudiniEngineEditorUtils.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniOutputDetails.h"
 #include "HoudiniParameter.h"
@@ -686,6 +687,11 @@ UHoudiniPublicAPIAssetWrapper::SetCookOnParameterOrInputChanges_Implementation(c
 		return false;
 
 	HAC->bCookOnParameterChange = bInSetEnabled;
+
+	// Let the manager look for the changes made while cooking on change was disabled
+	if (bInSetEnabled && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(HAC);
+
 	return true;
 }
 
@@ -0,0 +1,130 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "SHoudiniDetailsRowContent.h"
+
+#include "Widgets/SNullWidget.h"
+
+TMultiMap<TWeakObjectPtr<UObject>, TWeakPtr<SHoudiniDetailsRowContent>> SHoudiniDetailsRowContent::RowsByObject;
+TArray<TWeakPtr<SHoudiniDetailsRowContent>> SHoudiniDetailsRowContent::PendingRows;
+FTSTicker::FDelegateHandle SHoudiniDetailsRowContent::RebuildTickerHandle;
+int32 SHoudiniDetailsRowContent::NumRebuilds = 0;
+
+void
+SHoudiniDetailsRowContent::Construct(const FArguments& InArgs)
+{
+	RowObject = InArgs._RowObject;
+	OnBuildContent = InArgs._OnBuildContent;
+
+	if (RowObject.IsValid())
+		RowsByObject.Add(RowObject, SharedThis(this));
+
+	ChildSlot
+	[
+		OnBuildContent.IsBound() ? OnBuildContent.Execute() : SNullWidget::NullWidget
+	];
+}
+
+void
+SHoudiniDetailsRowContent::Rebuild()
+{
+	bRebuildPending = false;
+
+	if (!OnBuildContent.IsBound())
+		return;
+
+	NumRebuilds++;
+
+	ChildSlot
+	[
+		OnBuildContent.Execute()
+	];
+}
+
+bool
+SHoudiniDetailsRowContent::RequestRebuildFor(UObject* InRowObject)
+{
+	if (!IsValid(InRowObject))
+		return false;
+
+	// Forget the rows that have been destroyed along with their details panel
+	for (auto It = RowsByObject.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || !It.Value().IsValid())
+			It.RemoveCurrent();
+	}
+
+	TArray<TWeakPtr<SHoudiniDetailsRowContent>> Rows;
+	RowsByObject.MultiFind(InRowObject, Rows);
+
+	bool bFoundRow = false;
+	for (const TWeakPtr<SHoudiniDetailsRowContent>& Row : Rows)
+	{
+		TSharedPtr<SHoudiniDetailsRowContent> PinnedRow = Row.Pin();
+		if (!PinnedRow.IsValid())
+			continue;
+
+		bFoundRow = true;
+		if (PinnedRow->bRebuildPending)
+			continue;
+
+		PinnedRow->bRebuildPending = true;
+		PendingRows.Add(PinnedRow);
+	}
+
+	if (PendingRows.Num() > 0 && !RebuildTickerHandle.IsValid())
+	{
+		RebuildTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+		{
+			RebuildTickerHandle.Reset();
+			RebuildPendingRows();
+			return false;
+		}));
+	}
+
+	return bFoundRow;
+}
+
+void
+SHoudiniDetailsRowContent::RebuildPendingRows()
+{
+	if (RebuildTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RebuildTickerHandle);
+		RebuildTickerHandle.Reset();
+	}
+
+	// Rebuilding a row can request new rebuilds, which will happen on the next tick
+	TArray<TWeakPtr<SHoudiniDetailsRowContent>> RowsToRebuild = MoveTemp(PendingRows);
+	PendingRows.Reset();
+
+	for (const TWeakPtr<SHoudiniDetailsRowContent>& Row : RowsToRebuild)
+	{
+		TSharedPtr<SHoudiniDetailsRowContent> PinnedRow = Row.Pin();
+		if (PinnedRow.IsValid())
+			PinnedRow->Rebuild();
+	}
+}
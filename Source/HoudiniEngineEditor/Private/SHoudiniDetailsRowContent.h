@@ -0,0 +1,96 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+
+DECLARE_DELEGATE_RetVal(TSharedRef<SWidget>, FOnBuildHoudiniDetailsRowContent);
+
+/**
+ * Holds the value widget of a Houdini details row (an input, a ramp...) and rebuilds it in place.
+ *
+ * Callbacks that only change what a single row displays request a rebuild of that row through
+ * RequestRebuildFor() instead of calling ForceRefreshDetails(), which tears down and rebuilds the
+ * whole Houdini details panel. Requests are deferred to the next tick, so several requests made
+ * during the same frame only rebuild the row once, and never destroy the widget sending them.
+ */
+class SHoudiniDetailsRowContent : public SCompoundWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SHoudiniDetailsRowContent)
+	{}
+
+	/** The input or parameter shown by the row. */
+	SLATE_ARGUMENT(TWeakObjectPtr<UObject>, RowObject)
+
+	/** Builds the row's widget, on construction and on every rebuild. */
+	SLATE_EVENT(FOnBuildHoudiniDetailsRowContent, OnBuildContent)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Rebuilds the content of this row now. */
+	void Rebuild();
+
+	/**
+	 * Schedules a rebuild of every row currently showing InRowObject.
+	 * Returns false if no row shows it, in which case the caller has to refresh the details itself.
+	 */
+	static bool RequestRebuildFor(UObject* InRowObject);
+
+	/** Rebuilds the rows whose rebuild has been requested. Called on the tick following a request. */
+	static void RebuildPendingRows();
+
+	/** Number of row rebuilds since the editor started. */
+	static int32 GetNumRebuilds() { return NumRebuilds; }
+
+private:
+
+	// Finds the row built for a stand-in input and clicks its widgets
+	friend class HoudiniEditorInputTest_DetailsRebuildCount;
+
+	TWeakObjectPtr<UObject> RowObject;
+
+	FOnBuildHoudiniDetailsRowContent OnBuildContent;
+
+	bool bRebuildPending = false;
+
+	/** Rows that have been built, by the object they show. */
+	static TMultiMap<TWeakObjectPtr<UObject>, TWeakPtr<SHoudiniDetailsRowContent>> RowsByObject;
+
+	/** Rows waiting for their rebuild. */
+	static TArray<TWeakPtr<SHoudiniDetailsRowContent>> PendingRows;
+
+	static FTSTicker::FDelegateHandle RebuildTickerHandle;
+
+	static int32 NumRebuilds;
+};
@@ -1932,6 +1932,20 @@ bool FHoudiniEditorEquivalenceUtils::IsEquivalent(const UHoudiniStaticMesh* A, c
 	Result &= TestExpressionError(A->bHasColors == B->bHasColors, Header, "bHasColors");
 	Result &= TestExpressionError(A->NumUVLayers == B->NumUVLayers, Header, "NumUVLayers");
 	Result &= TestExpressionError(A->bHasPerFaceMaterials == B->bHasPerFaceMaterials, Header, "bHasPerFaceMaterials");
+	Result &= TestExpressionError(A->bIsQuantized == B->bIsQuantized, Header, "bIsQuantized");
+	Result &= TestExpressionError(A->GetNumVertices() == B->GetNumVertices(), Header, "GetNumVertices");
+	for (uint32 i = 0; A->bIsQuantized && i < FMath::Min(A->GetNumVertices(), B->GetNumVertices()); i++)
+	{
+		Result &= TestExpressionError(IsEquivalent(A->GetVertexPosition(i), B->GetVertexPosition(i)), Header, "GetVertexPosition");
+	}
+	Result &= TestExpressionError(A->QuantizedVertexInstanceNormals == B->QuantizedVertexInstanceNormals, Header, "QuantizedVertexInstanceNormals");
+	Result &= TestExpressionError(A->QuantizedVertexInstanceUTangents == B->QuantizedVertexInstanceUTangents, Header, "QuantizedVertexInstanceUTangents");
+	Result &= TestExpressionError(A->QuantizedVertexInstanceVTangents == B->QuantizedVertexInstanceVTangents, Header, "QuantizedVertexInstanceVTangents");
+	Result &= TestExpressionError(A->QuantizedVertexInstanceUVs.Num() == B->QuantizedVertexInstanceUVs.Num(), Header, "QuantizedVertexInstanceUVs.Num");
+	for (int i = 0; i < FMath::Min(A->QuantizedVertexInstanceUVs.Num(), B->QuantizedVertexInstanceUVs.Num()); i++)
+	{
+		Result &= TestExpressionError(IsEquivalent(FVector2f(A->QuantizedVertexInstanceUVs[i]), FVector2f(B->QuantizedVertexInstanceUVs[i])), Header, "QuantizedVertexInstanceUVs");
+	}
 	Result &= TestExpressionError(A->VertexPositions.Num() == B->VertexPositions.Num(), Header, "VertexPositions.Num");
 	for (int i = 0; i < FMath::Min(A->VertexPositions.Num(), B->VertexPositions.Num()); i++)
 	{
@@ -29,15 +29,114 @@
 #include "HoudiniPublicAPIAssetWrapper.h"
 #include "HoudiniPublicAPIInputTypes.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniOutput.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
 
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniDataLayerUtils.h"
+#include "HoudiniInputDetails.h"
+#include "SHoudiniDetailsRowContent.h"
+#include "UnrealLandscapeSplineTranslator.h"
+
+#include "DetailCategoryBuilder.h"
+#include "DetailLayoutBuilder.h"
+#include "IDetailCustomization.h"
+#include "IDetailsView.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Modules/ModuleManager.h"
+#include "PropertyEditorModule.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Text/STextBlock.h"
 
 FString FHoudiniEditorInputTests::EquivalenceTestMapName = TEXT("Inputs");
 FString FHoudiniEditorInputTests::TestHDAPath = TEXT("/Game/TestHDAs/Inputs/");
 
+// Creates an input node holding a part of InNumTriangles separate triangles. Returns -1 on failure.
+static HAPI_NodeId CreateTestTrianglesInputNode(const FString& InLabel, const int32 InNumTriangles)
+{
+	HAPI_NodeId NodeId = -1;
+	if (FHoudiniEngineUtils::CreateInputNode(InLabel, NodeId) != HAPI_RESULT_SUCCESS)
+		return -1;
+
+	const int32 NumPoints = InNumTriangles * 3;
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	PartInfo.id = 0;
+	PartInfo.nameSH = 0;
+	PartInfo.type = HAPI_PARTTYPE_MESH;
+	PartInfo.pointCount = NumPoints;
+	PartInfo.vertexCount = NumPoints;
+	PartInfo.faceCount = InNumTriangles;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (FHoudiniApi::SetPartInfo(Session, NodeId, 0, &PartInfo) != HAPI_RESULT_SUCCESS)
+		return -1;
+
+	HAPI_AttributeInfo PositionInfo;
+	FHoudiniApi::AttributeInfo_Init(&PositionInfo);
+	PositionInfo.count = NumPoints;
+	PositionInfo.tupleSize = 3;
+	PositionInfo.exists = true;
+	PositionInfo.owner = HAPI_ATTROWNER_POINT;
+	PositionInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	PositionInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+	if (FHoudiniApi::AddAttribute(Session, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &PositionInfo) != HAPI_RESULT_SUCCESS)
+		return -1;
+
+	TArray<float> Positions;
+	Positions.Reserve(NumPoints * 3);
+	TArray<int32> VertexList;
+	VertexList.Reserve(NumPoints);
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		const int32 Corner = PointIdx % 3;
+		Positions.Add(static_cast<float>(PointIdx / 3));
+		Positions.Add(Corner == 1 ? 1.0f : 0.0f);
+		Positions.Add(Corner == 2 ? 1.0f : 0.0f);
+		VertexList.Add(PointIdx);
+	}
+
+	TArray<int32> FaceCounts;
+	FaceCounts.Init(3, InNumTriangles);
+
+	if (FHoudiniEngineUtils::HapiSetAttributeFloatData(Positions, NodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, PositionInfo) != HAPI_RESULT_SUCCESS
+		|| FHoudiniEngineUtils::HapiSetVertexList(VertexList, NodeId, 0) != HAPI_RESULT_SUCCESS
+		|| FHoudiniEngineUtils::HapiSetFaceCounts(FaceCounts, NodeId, 0) != HAPI_RESULT_SUCCESS)
+	{
+		return -1;
+	}
+
+	return NodeId;
+}
+
+// Commits the input node's geo and cooks it, so that its attributes and groups can be read back
+static bool CommitAndCookTestInputNode(const HAPI_NodeId InNodeId)
+{
+	if (FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), InNodeId) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+	return FHoudiniEngineUtils::HapiCookNode(InNodeId, &CookOptions, true);
+}
+
+// Deletes the input node created by CreateTestTrianglesInputNode, with its parent object node
+static void DeleteTestInputNode(const HAPI_NodeId InNodeId)
+{
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	if (FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), InNodeId, &NodeInfo) == HAPI_RESULT_SUCCESS)
+		FHoudiniEngineUtils::DeleteHoudiniNode(NodeInfo.parentId);
+}
+
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorInputTest_Mesh_Input, "Houdini.Editor.Inputs.Mesh_Input", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool HoudiniEditorInputTest_Mesh_Input::RunTest(const FString & Parameters)
@@ -276,6 +375,254 @@ bool HoudiniEditorInputTest_Curve_Input::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Sends the landscape spline string attributes as indexed strings, and checks that Houdini gets every value back
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorInputTest_LandscapeSpline_IndexedStrings, "Houdini.Editor.Inputs.LandscapeSpline_IndexedStrings", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorInputTest_LandscapeSpline_IndexedStrings::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this, [this]
+	{
+		const int32 NumTriangles = 8;
+		const HAPI_NodeId NodeId = CreateTestTrianglesInputNode(TEXT("LandscapeSpline_IndexedStrings"), NumTriangles);
+		if (NodeId < 0)
+		{
+			this->AddError(TEXT("Could not create the input node"));
+			return;
+		}
+		ON_SCOPE_EXIT
+		{
+			DeleteTestInputNode(NodeId);
+		};
+
+		// Mostly empty strings and the same couple of mesh paths, as on the control points of a landscape spline
+		const int32 NumPoints = NumTriangles * 3;
+		TArray<FString> Strings;
+		for (int32 Idx = 0; Idx < NumPoints; Idx++)
+		{
+			if (Idx % 3 == 0)
+				Strings.Add(TEXT("/Engine/BasicShapes/Cube.Cube"));
+			else if (Idx % 5 == 0)
+				Strings.Add(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+			else
+				Strings.Add(FString());
+		}
+
+		const char* AttributeName = "unreal_landscape_spline_mesh";
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		AttributeInfo.count = NumPoints;
+		AttributeInfo.tupleSize = 1;
+		AttributeInfo.exists = true;
+		AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+		if (!this->TestEqual(TEXT("Add the string attribute"),
+				FHoudiniApi::AddAttribute(Session, NodeId, 0, AttributeName, &AttributeInfo), HAPI_RESULT_SUCCESS))
+			return;
+
+		this->TestEqual(TEXT("Send the indexed strings"),
+			FUnrealLandscapeSplineTranslator::SetLandscapeSplineStringAttributeData(
+				Strings, NodeId, 0, UTF8_TO_TCHAR(AttributeName), AttributeInfo), HAPI_RESULT_SUCCESS);
+
+		if (!CommitAndCookTestInputNode(NodeId))
+		{
+			this->AddError(TEXT("Could not commit the input node"));
+			return;
+		}
+
+		HAPI_AttributeInfo ReadAttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&ReadAttributeInfo);
+		TArray<FString> ReadStrings;
+		this->TestTrue(TEXT("Read the string attribute back"),
+			FHoudiniEngineUtils::HapiGetAttributeDataAsString(NodeId, 0, AttributeName, ReadAttributeInfo, ReadStrings, 1, HAPI_ATTROWNER_POINT));
+		this->TestTrue(TEXT("Every point gets its own string back"), ReadStrings == Strings);
+	});
+
+	return true;
+}
+
+// Adds the data layer groups to a stand-in input node, and checks that every primitive is in each of them
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorInputTest_DataLayerGroups, "Houdini.Editor.Inputs.DataLayerGroups", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorInputTest_DataLayerGroups::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this, [this]
+	{
+		const int32 NumTriangles = 4;
+		const HAPI_NodeId NodeId = CreateTestTrianglesInputNode(TEXT("DataLayerGroups"), NumTriangles);
+		if (NodeId < 0)
+		{
+			this->AddError(TEXT("Could not create the input node"));
+			return;
+		}
+		ON_SCOPE_EXIT
+		{
+			DeleteTestInputNode(NodeId);
+		};
+
+		// The group names GetHoudiniGroupNames gives for an actor in the Ground and Props data layers
+		const TArray<FString> LayerNames = { TEXT("Ground"), TEXT("Props") };
+		TArray<FString> GroupNames;
+		for (const FString& LayerName : LayerNames)
+			GroupNames.Add(FString(HOUDINI_DATA_LAYER_PREFIX) + LayerName);
+
+		this->TestTrue(TEXT("Add the data layer groups"), FHoudiniDataLayerUtils::AddGroups(GroupNames, NodeId, 0, NumTriangles));
+
+		if (!CommitAndCookTestInputNode(NodeId))
+		{
+			this->AddError(TEXT("Could not commit the input node"));
+			return;
+		}
+
+		TArray<FString> ReadGroupNames;
+		this->TestTrue(TEXT("Read the group names back"),
+			FHoudiniEngineUtils::HapiGetGroupNames(NodeId, 0, HAPI_GROUPTYPE_PRIM, false, ReadGroupNames));
+
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), NodeId, 0, &PartInfo);
+
+		for (const FString& GroupName : GroupNames)
+		{
+			if (!this->TestTrue(FString::Printf(TEXT("%s is a primitive group"), *GroupName), ReadGroupNames.Contains(GroupName)))
+				continue;
+
+			TArray<int32> Membership;
+			bool bAllEquals = false;
+			this->TestTrue(FString::Printf(TEXT("Read the %s membership"), *GroupName),
+				FHoudiniEngineUtils::HapiGetGroupMembership(NodeId, PartInfo, HAPI_GROUPTYPE_PRIM, GroupName, Membership, bAllEquals));
+			this->TestEqual(FString::Printf(TEXT("%s membership size"), *GroupName), Membership.Num(), NumTriangles);
+			this->TestFalse(FString::Printf(TEXT("Every primitive is in %s"), *GroupName), Membership.Contains(0));
+		}
+
+#if HOUDINI_ENABLE_DATA_LAYERS
+		// The output side turns the groups back into the same data layers
+		TArray<FString> ReadLayerNames;
+		for (const FHoudiniDataLayer& Layer : FHoudiniDataLayerUtils::GetDataLayers(NodeId, 0))
+			ReadLayerNames.Add(Layer.Name);
+		ReadLayerNames.Sort();
+		this->TestTrue(TEXT("The groups give back the data layers"), ReadLayerNames == LayerNames);
+#endif
+	});
+
+	return true;
+}
+
+// Shows stand-in inputs with the input widgets, and counts how many times their details are built
+class FHoudiniEditorTestInputDetails : public IDetailCustomization
+{
+public:
+	FHoudiniEditorTestInputDetails(const TSharedRef<int32>& InNumCustomizeDetailsCalls)
+		: NumCustomizeDetailsCalls(InNumCustomizeDetailsCalls)
+	{}
+
+	virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override
+	{
+		(*NumCustomizeDetailsCalls)++;
+
+		TArray<TWeakObjectPtr<UObject>> ObjectsCustomized;
+		DetailBuilder.GetObjectsBeingCustomized(ObjectsCustomized);
+
+		TArray<TWeakObjectPtr<UHoudiniInput>> Inputs;
+		for (const TWeakObjectPtr<UObject>& Object : ObjectsCustomized)
+		{
+			if (UHoudiniInput* Input = Cast<UHoudiniInput>(Object.Get()))
+				Inputs.Add(Input);
+		}
+
+		IDetailCategoryBuilder& InputCategory = DetailBuilder.EditCategory(TEXT("HoudiniInputs"), FText::GetEmpty(), ECategoryPriority::Important);
+		FHoudiniInputDetails::CreateWidget(InputCategory, Inputs);
+	}
+
+	TSharedRef<int32> NumCustomizeDetailsCalls;
+};
+
+// Returns the first button under InWidget showing InLabel
+static TSharedPtr<SButton> FindTestButtonWithLabel(const TSharedRef<SWidget>& InWidget, const FText& InLabel)
+{
+	// Returns true if InWidget, or one of its children, is a text block showing InLabel
+	TFunction<bool(const TSharedRef<SWidget>&)> HasLabel = [&HasLabel, &InLabel](const TSharedRef<SWidget>& Widget)
+	{
+		if (Widget->GetType() == FName(TEXT("STextBlock")) && StaticCastSharedRef<STextBlock>(Widget)->GetText().EqualTo(InLabel))
+			return true;
+
+		FChildren* Children = Widget->GetChildren();
+		for (int32 Idx = 0; Children && Idx < Children->Num(); Idx++)
+		{
+			if (HasLabel(Children->GetChildAt(Idx)))
+				return true;
+		}
+
+		return false;
+	};
+
+	if (InWidget->GetType() == FName(TEXT("SButton")) && HasLabel(InWidget))
+		return StaticCastSharedRef<SButton>(InWidget);
+
+	FChildren* Children = InWidget->GetChildren();
+	for (int32 Idx = 0; Children && Idx < Children->Num(); Idx++)
+	{
+		TSharedPtr<SButton> Button = FindTestButtonWithLabel(Children->GetChildAt(Idx), InLabel);
+		if (Button.IsValid())
+			return Button;
+	}
+
+	return nullptr;
+}
+
+// Clicks the Add button of a geometry input, and checks that only the input's row is rebuilt, not the whole details panel
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorInputTest_DetailsRebuildCount, "Houdini.Editor.Inputs.DetailsRebuildCount", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorInputTest_DetailsRebuildCount::RunTest(const FString & Parameters)
+{
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>(GetTransientPackage());
+	UHoudiniInput* Input = NewObject<UHoudiniInput>(HAC);
+	bool bBlueprintStructureModified = false;
+	Input->SetInputType(EHoudiniInputType::Geometry, bBlueprintStructureModified);
+
+	TSharedRef<int32> NumCustomizeDetailsCalls = MakeShared<int32>(0);
+	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	FDetailsViewArgs DetailsViewArgs;
+	TSharedRef<IDetailsView> DetailsView = PropertyEditorModule.CreateDetailView(DetailsViewArgs);
+	DetailsView->RegisterInstancedCustomPropertyLayout(UHoudiniInput::StaticClass(),
+		FOnGetDetailCustomizationInstance::CreateLambda([NumCustomizeDetailsCalls]() -> TSharedRef<IDetailCustomization>
+		{
+			return MakeShared<FHoudiniEditorTestInputDetails>(NumCustomizeDetailsCalls);
+		}));
+
+	DetailsView->SetObject(Input);
+	ON_SCOPE_EXIT
+	{
+		DetailsView->SetObject(nullptr);
+	};
+
+	TestEqual(TEXT("Showing the input builds its details once"), *NumCustomizeDetailsCalls, 1);
+
+	TSharedPtr<SHoudiniDetailsRowContent> Row = SHoudiniDetailsRowContent::RowsByObject.FindRef(Input).Pin();
+	if (!TestTrue(TEXT("The input is shown by a row"), Row.IsValid()))
+		return true;
+
+	TSharedPtr<SButton> AddButton = FindTestButtonWithLabel(Row.ToSharedRef(), FText::FromString(TEXT("Add")));
+	if (!TestTrue(TEXT("The geometry input has an Add button"), AddButton.IsValid()))
+		return true;
+
+	// The Add button used to rebuild the whole details panel
+	const int32 NumInputObjects = Input->GetNumberOfInputObjects(EHoudiniInputType::Geometry);
+	const int32 NumRebuilds = SHoudiniDetailsRowContent::GetNumRebuilds();
+	AddButton->SimulateClick();
+	TestEqual(TEXT("Add inserts a geometry input object"), Input->GetNumberOfInputObjects(EHoudiniInputType::Geometry), NumInputObjects + 1);
+	TestEqual(TEXT("Add doesn't rebuild the details"), *NumCustomizeDetailsCalls, 1);
+
+	// The row is rebuilt on the next tick, once
+	SHoudiniDetailsRowContent::RebuildPendingRows();
+	TestEqual(TEXT("Add rebuilds the input's row once"), SHoudiniDetailsRowContent::GetNumRebuilds(), NumRebuilds + 1);
+	TestEqual(TEXT("Rebuilding the row doesn't rebuild the details"), *NumCustomizeDetailsCalls, 1);
+
+	return true;
+}
+
 
 #endif
 
@@ -1,4 +1,4 @@
-/*
+﻿/*
 * Copyright (c) <2021> Side Effects Software Inc.
 * All rights reserved.
 *
@@ -27,7 +27,9 @@
 #include "HoudiniEditorTests.h"
 
 #include "HoudiniEditorEquivalenceUtils.h"
+#include "HoudiniPublicAPI.h"
 #include "HoudiniPublicAPIAssetWrapper.h"
+#include "HoudiniPublicAPIBlueprintLib.h"
 
 #include "FileHelpers.h"
 
@@ -36,13 +38,21 @@
 #include "HoudiniEditorTestUtils.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniGeoImportCommandlet.h"
+#include "HoudiniApi.h"
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	#include "HAL/FileManager.h"
 #else
 	#include "Core/Public/HAL/FileManager.h"
 #endif
+#include "HAL/IConsoleManager.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/StrongObjectPtr.h"
 
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorEvergreenTest, "Houdini.Editor.Screenshots.EvergreenScreenshots", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
@@ -147,4 +157,293 @@ bool HoudiniEditorRandomEquivalenceTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Benchmark: time between placing an HDA and getting its first outputs, when the same HDA is placed repeatedly.
+// From the third placement on, the instantiation claims a node prewarmed after the second one.
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorPrewarmTimeToFirstOutputTest, "Houdini.Editor.Random.PrewarmTimeToFirstOutput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorPrewarmTimeToFirstOutputTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this, [this]
+	{
+		UHoudiniPublicAPI* HoudiniAPI = UHoudiniPublicAPIBlueprintLib::GetAPI();
+		UHoudiniAsset* HoudiniAsset = Cast<UHoudiniAsset>(FHoudiniEditorTestUtils::FindAssetUObject(this, TEXT("/Game/TestHDAs/Evergreen")));
+		if (!IsValid(HoudiniAPI) || !IsValid(HoudiniAsset))
+		{
+			this->AddError(TEXT("Could not instantiate /Game/TestHDAs/Evergreen"));
+			return;
+		}
+
+		struct FPlacementState
+		{
+			int32 NumPlacements = 0;
+			double StartTime = 0.0;
+			TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper> Wrapper;
+			TArray<TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper>> PlacedWrappers;
+			TArray<double> TimesToFirstOutput;
+		};
+		TSharedRef<FPlacementState> State = MakeShared<FPlacementState>();
+
+		const int32 NumPlacements = 4;
+		const double MaxPrewarmWaitTime = 30.0;
+
+		this->AddCommand(new FFunctionLatentCommand([this, HoudiniAPI, HoudiniAsset, State, NumPlacements, MaxPrewarmWaitTime]()
+		{
+			const double Now = FPlatformTime::Seconds();
+			if (!State->Wrapper.IsValid())
+			{
+				if (State->NumPlacements >= NumPlacements)
+				{
+					for (int32 Idx = 0; Idx < State->TimesToFirstOutput.Num(); Idx++)
+					{
+						this->AddInfo(FString::Printf(TEXT("Placement %d: first output after %.3fs"), Idx + 1, State->TimesToFirstOutput[Idx]));
+					}
+					return true;
+				}
+
+				// Once the HDA has been placed twice, let the scheduler prewarm a node before placing it again.
+				// The next placement would otherwise interrupt the prewarm.
+				if (State->NumPlacements >= 2
+					&& FHoudiniEngine::Get().GetNumPrewarmedNodes() <= 0
+					&& Now - State->StartTime < MaxPrewarmWaitTime)
+				{
+					return false;
+				}
+
+				State->Wrapper = TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper>(HoudiniAPI->InstantiateAsset(HoudiniAsset, FTransform::Identity));
+				State->StartTime = FPlatformTime::Seconds();
+				if (!State->Wrapper.IsValid())
+				{
+					this->AddError(TEXT("Instantiation failed!"));
+					return true;
+				}
+
+				return false;
+			}
+
+			UHoudiniAssetComponent* HAC = State->Wrapper->GetHoudiniAssetComponent();
+			if (!IsValid(HAC))
+			{
+				this->AddError(TEXT("The placed HDA has no component"));
+				return true;
+			}
+
+			if (HAC->GetAssetState() != EHoudiniAssetState::None || HAC->GetNumOutputs() <= 0)
+			{
+				if (Now - State->StartTime > FHoudiniEditorTestUtils::TimeoutTime)
+				{
+					this->AddError(FString::Printf(TEXT("Placement %d timed out"), State->NumPlacements + 1));
+					return true;
+				}
+
+				return false;
+			}
+
+			State->TimesToFirstOutput.Add(Now - State->StartTime);
+			State->PlacedWrappers.Add(State->Wrapper);
+			State->Wrapper.Reset();
+			State->StartTime = Now;
+			State->NumPlacements++;
+			return false;
+		}));
+	});
+
+	return true;
+}
+
+// Benchmark: wall time to place a batch of HDAs and get all their outputs, without and with the deferral of the
+// HDAs waiting on a cook in the manager's processing order. Prewarming is disabled so both rounds instantiate.
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorCookingTickDeferralWallTimeTest, "Houdini.Editor.Random.CookingTickDeferralWallTime", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorCookingTickDeferralWallTimeTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this, [this]
+	{
+		UHoudiniPublicAPI* HoudiniAPI = UHoudiniPublicAPIBlueprintLib::GetAPI();
+		UHoudiniAsset* HoudiniAsset = Cast<UHoudiniAsset>(FHoudiniEditorTestUtils::FindAssetUObject(this, TEXT("/Game/TestHDAs/Evergreen")));
+		IConsoleVariable* CookingTickDeferralCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.CookingTickDeferral"));
+		IConsoleVariable* PrewarmedNodePoolSizeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.PrewarmedNodePoolSize"));
+		if (!IsValid(HoudiniAPI) || !IsValid(HoudiniAsset) || !CookingTickDeferralCVar || !PrewarmedNodePoolSizeCVar)
+		{
+			this->AddError(TEXT("Could not instantiate /Game/TestHDAs/Evergreen"));
+			return;
+		}
+
+		struct FRoundState
+		{
+			int32 NumRounds = 0;
+			double StartTime = 0.0;
+			TArray<TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper>> Wrappers;
+			TArray<TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper>> PlacedWrappers;
+		};
+		TSharedRef<FRoundState> State = MakeShared<FRoundState>();
+
+		const float DefaultCookingTickDeferral = CookingTickDeferralCVar->GetFloat();
+		const int32 DefaultPrewarmedNodePoolSize = PrewarmedNodePoolSizeCVar->GetInt();
+		const TArray<float> CookingTickDeferrals = { 0.0f, DefaultCookingTickDeferral };
+		const int32 NumHDAsPerRound = 6;
+		PrewarmedNodePoolSizeCVar->Set(0);
+
+		this->AddCommand(new FFunctionLatentCommand([this, HoudiniAPI, HoudiniAsset, CookingTickDeferralCVar, PrewarmedNodePoolSizeCVar,
+			State, DefaultCookingTickDeferral, DefaultPrewarmedNodePoolSize, CookingTickDeferrals, NumHDAsPerRound]()
+		{
+			auto RestoreCVars = [CookingTickDeferralCVar, PrewarmedNodePoolSizeCVar, DefaultCookingTickDeferral, DefaultPrewarmedNodePoolSize]()
+			{
+				CookingTickDeferralCVar->Set(DefaultCookingTickDeferral);
+				PrewarmedNodePoolSizeCVar->Set(DefaultPrewarmedNodePoolSize);
+			};
+
+			const double Now = FPlatformTime::Seconds();
+			if (State->Wrappers.Num() <= 0)
+			{
+				if (State->NumRounds >= CookingTickDeferrals.Num())
+				{
+					RestoreCVars();
+					return true;
+				}
+
+				CookingTickDeferralCVar->Set(CookingTickDeferrals[State->NumRounds]);
+				State->StartTime = Now;
+				for (int32 Idx = 0; Idx < NumHDAsPerRound; Idx++)
+				{
+					const FTransform Transform(FVector(1000.0f * Idx, 1000.0f * State->NumRounds, 0.0f));
+					TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper> Wrapper(HoudiniAPI->InstantiateAsset(HoudiniAsset, Transform));
+					if (!Wrapper.IsValid())
+					{
+						this->AddError(TEXT("Instantiation failed!"));
+						RestoreCVars();
+						return true;
+					}
+					State->Wrappers.Add(Wrapper);
+				}
+
+				return false;
+			}
+
+			for (const TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper>& Wrapper : State->Wrappers)
+			{
+				UHoudiniAssetComponent* HAC = Wrapper->GetHoudiniAssetComponent();
+				if (!IsValid(HAC))
+				{
+					this->AddError(TEXT("A placed HDA has no component"));
+					RestoreCVars();
+					return true;
+				}
+
+				if (HAC->GetAssetState() != EHoudiniAssetState::None || HAC->GetNumOutputs() <= 0)
+				{
+					if (Now - State->StartTime > FHoudiniEditorTestUtils::TimeoutTime)
+					{
+						this->AddError(FString::Printf(TEXT("Round %d timed out"), State->NumRounds + 1));
+						RestoreCVars();
+						return true;
+					}
+
+					return false;
+				}
+			}
+
+			this->AddInfo(FString::Printf(TEXT("CookingTickDeferral %.2fs: %d HDAs placed and cooked in %.3fs"),
+				CookingTickDeferrals[State->NumRounds], NumHDAsPerRound, Now - State->StartTime));
+
+			State->PlacedWrappers.Append(State->Wrappers);
+			State->Wrappers.Empty();
+			State->NumRounds++;
+			return false;
+		}));
+	});
+
+	return true;
+}
+
+// Benchmark: throughput of the geo import commandlet in batch mode, then of incremental runs over the same files,
+// unchanged and with only their time stamps changed.
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(HoudiniEditorGeoImportThroughputTest, "Houdini.Editor.Random.GeoImportThroughput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorGeoImportThroughputTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this, [this]
+	{
+		const FString Directory = FPaths::ConvertRelativePathToFull(
+			FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("HoudiniEngine"), TEXT("GeoImportThroughput"), FGuid::NewGuid().ToString()));
+		const FString StateFilename = FPaths::Combine(Directory, TEXT("State.txt"));
+		IFileManager::Get().MakeDirectory(*Directory, true);
+		ON_SCOPE_EXIT
+		{
+			IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		};
+
+		// Write the files to import: the same box saved several times
+		HAPI_NodeId BoxNodeId = -1;
+		if (FHoudiniEngineUtils::CreateNode(-1, TEXT("SOP/box"), TEXT("GeoImportThroughput"), true, &BoxNodeId) != HAPI_RESULT_SUCCESS)
+		{
+			this->AddError(TEXT("Could not create the box node"));
+			return;
+		}
+
+		const int32 NumFiles = 16;
+		TArray<FString> Filenames;
+		for (int32 Idx = 0; Idx < NumFiles; Idx++)
+		{
+			const FString& Filename = Filenames.Add_GetRef(FPaths::Combine(Directory, FString::Printf(TEXT("box_%d.bgeo.sc"), Idx)));
+			if (FHoudiniApi::SaveGeoToFile(FHoudiniEngine::Get().GetSession(), BoxNodeId, TCHAR_TO_UTF8(*Filename)) != HAPI_RESULT_SUCCESS)
+				this->AddError(FString::Printf(TEXT("Could not write %s"), *Filename));
+		}
+
+		HAPI_NodeInfo BoxNodeInfo;
+		FHoudiniApi::NodeInfo_Init(&BoxNodeInfo);
+		if (FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), BoxNodeId, &BoxNodeInfo) == HAPI_RESULT_SUCCESS)
+			FHoudiniEngineUtils::DeleteHoudiniNode(BoxNodeInfo.parentId);
+
+		if (this->HasAnyErrors())
+			return;
+
+		auto LoadHashes = [&StateFilename]()
+		{
+			TArray<FString> Lines;
+			FFileHelper::LoadFileToStringArray(Lines, *StateFilename);
+
+			TArray<FString> Hashes;
+			for (const FString& Line : Lines)
+			{
+				TArray<FString> Fields;
+				if (Line.ParseIntoArray(Fields, TEXT("\t"), false) == 4)
+					Hashes.Add(Fields[2]);
+			}
+			return Hashes;
+		};
+
+		UHoudiniGeoImportCommandlet* Commandlet = NewObject<UHoudiniGeoImportCommandlet>(GetTransientPackage());
+		const FString CommandletParams = FString::Printf(TEXT("-dir=%s -incremental -statefile=%s"), *Directory, *StateFilename);
+		auto RunImport = [this, Commandlet, &CommandletParams, NumFiles](const TCHAR* InRunName)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const int32 Result = Commandlet->Main(CommandletParams);
+			const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+			this->TestEqual(FString::Printf(TEXT("%s: commandlet result"), InRunName), Result, 0);
+			this->AddInfo(FString::Printf(TEXT("%s: %d files in %.3fs (%.2f files/s)"),
+				InRunName, NumFiles, ElapsedSeconds, ElapsedSeconds > 0.0 ? NumFiles / ElapsedSeconds : 0.0));
+		};
+
+		RunImport(TEXT("First import"));
+
+		// The first import records the content hash of every file
+		const TArray<FString> Hashes = LoadHashes();
+		this->TestEqual(TEXT("Every imported file is recorded"), Hashes.Num(), NumFiles);
+		for (const FString& Hash : Hashes)
+			this->TestFalse(TEXT("Imported file has a hash"), Hash.IsEmpty());
+
+		RunImport(TEXT("Unchanged files"));
+
+		// Only the time stamps change: the hashes recorded by the first import let the files be skipped
+		const FDateTime TimeStamp = FDateTime::UtcNow();
+		for (const FString& Filename : Filenames)
+			IFileManager::Get().SetTimeStamp(*Filename, TimeStamp);
+
+		RunImport(TEXT("Touched files"));
+		this->TestTrue(TEXT("Touched files keep their hashes"), LoadHashes() == Hashes);
+	});
+
+	return true;
+}
+
 #endif
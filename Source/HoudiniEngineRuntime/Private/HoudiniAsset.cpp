@@ -34,6 +34,7 @@
 
 #include "Misc/Paths.h"
 #include "HAL/UnrealMemory.h"
+#include "Hash/CityHash.h"
 #include "UObject/ObjectSaveContext.h"
 
 UHoudiniAsset::UHoudiniAsset(const FObjectInitializer & ObjectInitializer)
@@ -43,6 +44,7 @@ UHoudiniAsset::UHoudiniAsset(const FObjectInitializer & ObjectInitializer)
 	, bAssetLimitedCommercial(false)
 	, bAssetNonCommercial(false)
 	, bAssetExpanded(false)
+	, AssetBytesHash(0)
 {}
 
 void
@@ -52,6 +54,7 @@ UHoudiniAsset::CreateAsset(const uint8 * BufferStart, const uint8 * BufferEnd, c
 
 	// Calculate buffer size.
 	AssetBytesCount = BufferEnd - BufferStart;
+	AssetBytesHash = 0;
 
 	if (AssetBytesCount)
 	{
@@ -114,6 +117,15 @@ UHoudiniAsset::GetAssetBytesCount() const
 	return AssetBytesCount;
 }
 
+uint64
+UHoudiniAsset::GetAssetBytesHash() const
+{
+	if (AssetBytesHash == 0 && AssetBytesCount > 0 && AssetBytes.Num() >= (int32)AssetBytesCount)
+		AssetBytesHash = CityHash64(reinterpret_cast<const char*>(AssetBytes.GetData()), AssetBytesCount);
+
+	return AssetBytesHash;
+}
+
 void
 UHoudiniAsset::Serialize(FArchive & Ar)
 {
@@ -124,6 +136,10 @@ UHoudiniAsset::Serialize(FArchive & Ar)
 	// Get the version
 	uint32 HoudiniAssetVersion = Ar.CustomVer(FHoudiniCustomSerializationVersion::GUID);
 
+	// The raw data may have changed, the hash will be recomputed when needed
+	if (Ar.IsLoading())
+		AssetBytesHash = 0;
+
 	// Only version 1 assets needs manual serialization
 	if ( HoudiniAssetVersion < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_BASE 
 		|| HoudiniAssetVersion > VER_HOUDINI_PLUGIN_SERIALIZATION_AUTOMATIC_VERSION )
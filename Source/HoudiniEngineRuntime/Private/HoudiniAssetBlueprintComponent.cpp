@@ -1797,6 +1797,8 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 			AssetState = EHoudiniAssetState::NeedInstantiation;
 			bForceNeedUpdate = true;
 			bHoudiniAssetChanged = false;
+			if (FHoudiniEngineRuntime::IsInitialized())
+				FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
 			// TODO: Make this better?
 			CachedTemplateComponent->bHoudiniAssetChanged = false;
 		}
@@ -2023,6 +2025,8 @@ UHoudiniAssetBlueprintComponent::OnTemplateParametersChangedHandler(UHoudiniAsse
 		// to trigger an HDA update) so we are going to force NeedUpdate() to return true
 		// in order to get an initial cook.
 		bForceNeedUpdate = true;
+		if (FHoudiniEngineRuntime::IsInitialized())
+			FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
 	}
 
 	bUpdatedFromTemplate = true;
@@ -468,6 +468,8 @@ UHoudiniAssetComponent::OnHoudiniAssetChanged()
 
 	// Force an update on the next tick
 	bForceNeedUpdate = true;
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
 }
 
 void UHoudiniAssetComponent::QueuePreCookCallback(const TFunction<void(UHoudiniAssetComponent*)>& CallbackFn)
@@ -877,6 +879,9 @@ UHoudiniAssetComponent::MarkAsNeedCook()
 	bRecookRequested = true;
 	bRebuildRequested = false;
 
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
+
 	//bEditorPropertiesNeedFullUpdate = true;
 
 	// We need to mark all our parameters as changed/trigger update
@@ -975,6 +980,9 @@ UHoudiniAssetComponent::MarkAsNeedRebuild()
 	bRebuildRequested = true;
 	bFullyLoaded = false;
 
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
+
 	//bEditorPropertiesNeedFullUpdate = true;
 
 	// We need to mark all our parameters as changed/trigger update
@@ -1994,6 +2002,9 @@ UHoudiniAssetComponent::SetHasComponentTransformChanged(const bool& InHasChanged
 	{
 		bHasComponentTransformChanged = InHasChanged;
 		LastComponentTransform = GetComponentTransform();
+
+		if (InHasChanged && FHoudiniEngineRuntime::IsInitialized())
+			FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
 	}
 }
 
@@ -2477,6 +2488,10 @@ UHoudiniAssetComponent::SetAssetState(EHoudiniAssetState InNewState)
 	const EHoudiniAssetState OldState = AssetState;
 	AssetState = InNewState;
 
+	// Make sure the manager processes us on its next tick
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
+
 #if WITH_EDITOR
 	IHoudiniEditorAssetStateSubsystemInterface* const EditorSubsystem = IHoudiniEditorAssetStateSubsystemInterface::Get(); 
 	if (EditorSubsystem)
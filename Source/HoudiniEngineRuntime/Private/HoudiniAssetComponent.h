@@ -92,6 +92,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
 	friend struct FHoudiniParameterTranslator;
 	friend struct FHoudiniPDGManager;
 	friend struct FHoudiniHandleTranslator;
+	friend class FHoudiniSessionSnapshot;
 
 #if WITH_EDITORONLY_DATA
 	friend class FHoudiniAssetComponentDetails;
@@ -172,6 +172,8 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 	{
 		FScopeLock ScopeLock(&CriticalSection);
 		RegisteredHoudiniComponents.Add(HAC);
+		RegisteredHoudiniComponentSet.Add(HAC);
+		DirtyHoudiniComponents.Add(HAC);
 	}
 
 	HAC->NotifyHoudiniRegisterCompleted();
@@ -218,6 +220,55 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(UHoudiniAssetComponent* HAC)
 }
 
 
+void
+FHoudiniEngineRuntime::MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC)
+{
+	if (!IsValid(HAC))
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	TWeakObjectPtr<UHoudiniAssetComponent> Ptr(HAC);
+	if (RegisteredHoudiniComponentSet.Contains(Ptr))
+		DirtyHoudiniComponents.Add(Ptr);
+}
+
+
+void
+FHoudiniEngineRuntime::MarkOuterHoudiniComponentDirty(const UObject* InObject)
+{
+	if (!IsValid(InObject))
+		return;
+
+	UHoudiniAssetComponent* HAC = InObject->GetTypedOuter<UHoudiniAssetComponent>();
+	if (!HAC)
+	{
+		// Editable curves are attached to their HAC
+		const USceneComponent* SceneComponent = Cast<USceneComponent>(InObject);
+		HAC = SceneComponent ? Cast<UHoudiniAssetComponent>(SceneComponent->GetAttachParent()) : nullptr;
+	}
+
+	MarkHoudiniComponentDirty(HAC);
+}
+
+
+TArray<UHoudiniAssetComponent*>
+FHoudiniEngineRuntime::ConsumeDirtyHoudiniComponents()
+{
+	TArray<UHoudiniAssetComponent*> DirtyComponents;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	DirtyComponents.Reserve(DirtyHoudiniComponents.Num());
+	for (const TWeakObjectPtr<UHoudiniAssetComponent>& Ptr : DirtyHoudiniComponents)
+	{
+		if (UHoudiniAssetComponent* HAC = Ptr.Get())
+			DirtyComponents.Add(HAC);
+	}
+	DirtyHoudiniComponents.Empty();
+
+	return DirtyComponents;
+}
+
+
 void
 FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 {
@@ -236,6 +287,8 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		}
 	}
 	
+	RegisteredHoudiniComponentSet.Remove(Ptr);
+	DirtyHoudiniComponents.Remove(Ptr);
 	RegisteredHoudiniComponents.RemoveAt(ValidIndex);
 }
 
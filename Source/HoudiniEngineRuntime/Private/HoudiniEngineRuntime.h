@@ -68,6 +68,14 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		UHoudiniAssetComponent* GetRegisteredHoudiniComponentAt(const int32& Index);
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
+
+		// Flags a registered component as needing to be processed by the manager on its next tick.
+		// Called when the component's state, parameters, inputs or editable curves change.
+		void MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC);
+		// Flags the component that owns InObject (a parameter, input, input object or curve) as dirty.
+		void MarkOuterHoudiniComponentDirty(const UObject* InObject);
+		// Returns the dirty components and clears the dirty set.
+		TArray<UHoudiniAssetComponent*> ConsumeDirtyHoudiniComponents();
 		
 		//
 		// Node deletion
@@ -107,6 +115,12 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		// 
 		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponents;
 
+		// Same as RegisteredHoudiniComponents, for fast lookups.
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponentSet;
+
+		// Registered components that need to be processed on the next manager tick.
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> DirtyHoudiniComponents;
+
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
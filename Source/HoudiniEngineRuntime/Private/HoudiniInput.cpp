@@ -2323,6 +2323,16 @@ UHoudiniInput::IsDataUploadNeeded()
 	return HasChanged();
 }
 
+void
+UHoudiniInput::SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate)
+{
+	bNeedsToTriggerUpdate = bInTriggersUpdate;
+
+	// Let the manager know our HAC needs to be updated
+	if (bInTriggersUpdate && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkOuterHoudiniComponentDirty(this);
+}
+
 // Indicates if this input has changed and should be updated
 bool 
 UHoudiniInput::HasChanged()
@@ -791,6 +791,16 @@ UHoudiniInputBlueprint::GetBlueprint() const
 // MARK CHANGED METHODS
 //-----------------------------------------------------------------------------------------------------------------------------
 
+void
+UHoudiniInputObject::SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate)
+{
+	bNeedsToTriggerUpdate = bInTriggersUpdate;
+
+	// Let the manager know our HAC needs to be updated
+	if (bInTriggersUpdate && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkOuterHoudiniComponentDirty(this);
+}
+
 void
 UHoudiniInputObject::MarkChanged(const bool& bInChanged)
 {
@@ -153,7 +153,7 @@ public:
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
 
 	virtual void MarkChanged(const bool& bInChanged);
-	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
+	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate);
 	virtual void MarkTransformChanged(const bool bInChanged) { bTransformChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
 
 	// Set the InputNodeId.
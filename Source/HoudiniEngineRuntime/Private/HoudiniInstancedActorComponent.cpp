@@ -45,6 +45,9 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
+// Outliner folder of the actors waiting in a pool, so that they are kept apart from the HDA outputs
+static const FName PooledActorsFolderPath(TEXT("HoudiniEngine_PooledActors"));
+
 UHoudiniInstancedActorComponent::UHoudiniInstancedActorComponent( const FObjectInitializer& ObjectInitializer )
 : Super( ObjectInitializer )
 , InstancedObject( nullptr )
@@ -115,6 +118,12 @@ UHoudiniInstancedActorComponent::AddReferencedObjects(UObject * InThis, FReferen
             Collector.AddReferencedObject( ThisHIAC->InstancedObject, ThisHIAC );
 
         Collector.AddReferencedObjects(ThisHIAC->InstancedActors, ThisHIAC );
+
+        for (auto& Pool : ThisHIAC->PooledActors)
+        {
+            for (FHoudiniPooledActor& PooledActor : Pool.Value.Actors)
+                Collector.AddReferencedObject(PooledActor.Actor, ThisHIAC);
+        }
     }
 }
 
@@ -175,21 +184,31 @@ UHoudiniInstancedActorComponent::ClearAllInstances()
         }
     }
     InstancedActors.Empty();
+
+    // Also destroy the pooled actors
+    TrimPool(0);
 }
 
 
 void
-UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNum)
+UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNum, bool bPoolExtraInstances)
 {
 	int32 OldInstanceNum = InstancedActors.Num();
 
 	// If we want less instances than we already have, destroy the extra properly
 	if (NewInstanceNum < OldInstanceNum)
 	{
-		for (int32 Idx = NewInstanceNum - 1; Idx < InstancedActors.Num(); Idx++)
+		for (int32 Idx = FMath::Max(NewInstanceNum, 0); Idx < InstancedActors.Num(); Idx++)
 		{
-			AActor* Instance = InstancedActors.IsValidIndex(Idx) ? InstancedActors[Idx] : nullptr;
-			if (IsValid(Instance))
+			AActor* Instance = InstancedActors[Idx];
+			if (!IsValid(Instance))
+				continue;
+
+			if (bPoolExtraInstances)
+			{
+				ReleaseActorToPool(Instance);
+			}
+			else
 			{
 				UWorld* const World = Instance->GetWorld();
 				if (IsValid(World))
@@ -203,6 +222,124 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 }
 
 
+void
+UHoudiniInstancedActorComponent::ReleaseActorToPool(AActor* InActor)
+{
+	if (!IsValid(InActor))
+		return;
+
+	// Keep the actor's state so it can be restored when the actor is reused
+	FHoudiniPooledActor PooledActor;
+	PooledActor.Actor = InActor;
+	PooledActor.bHiddenInGame = InActor->IsHidden();
+	PooledActor.bCollisionEnabled = InActor->GetActorEnableCollision();
+
+	InActor->SetActorHiddenInGame(true);
+	InActor->SetActorEnableCollision(false);
+	// Pooled actors are no longer outputs of the HDA: take them out of the HDA's hierarchy in the outliner
+	InActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+#if WITH_EDITOR
+	InActor->SetIsTemporarilyHiddenInEditor(true);
+	PooledActor.FolderPath = InActor->GetFolderPath();
+	InActor->SetFolderPath(PooledActorsFolderPath);
+#endif
+	// Pooled actors must not be saved with the level
+	InActor->SetFlags(RF_Transient);
+
+	PooledActors.FindOrAdd(InstancedObject).Actors.Add(PooledActor);
+}
+
+
+void
+UHoudiniInstancedActorComponent::ReleaseAllInstancesToPool()
+{
+	for (AActor* Instance : InstancedActors)
+		ReleaseActorToPool(Instance);
+
+	InstancedActors.Empty();
+}
+
+
+AActor*
+UHoudiniInstancedActorComponent::AcquirePooledActor()
+{
+	FHoudiniInstancedActorPool* Pool = PooledActors.Find(InstancedObject);
+	if (!Pool)
+		return nullptr;
+
+	while (Pool->Actors.Num() > 0)
+	{
+		const FHoudiniPooledActor PooledActor = Pool->Actors.Pop();
+		AActor* Actor = PooledActor.Actor;
+		if (!IsValid(Actor))
+			continue;
+
+		// Restore the state the actor had before it was pooled
+		Actor->ClearFlags(RF_Transient);
+		Actor->SetActorHiddenInGame(PooledActor.bHiddenInGame);
+		Actor->SetActorEnableCollision(PooledActor.bCollisionEnabled);
+#if WITH_EDITOR
+		Actor->SetIsTemporarilyHiddenInEditor(false);
+		Actor->SetFolderPath(PooledActor.FolderPath);
+#endif
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+
+void
+UHoudiniInstancedActorComponent::TrimPool(const int32& MaxPooledActors)
+{
+	int32 NumToRemove = GetNumPooledActors() - FMath::Max(MaxPooledActors, 0);
+	if (NumToRemove <= 0)
+		return;
+
+	auto DestroyPooledActors = [&NumToRemove](FHoudiniInstancedActorPool& Pool)
+	{
+		while (NumToRemove > 0 && Pool.Actors.Num() > 0)
+		{
+			AActor* Actor = Pool.Actors.Pop().Actor;
+			NumToRemove--;
+			if (!IsValid(Actor))
+				continue;
+
+			UWorld* const World = Actor->GetWorld();
+			if (IsValid(World))
+				World->DestroyActor(Actor);
+		}
+	};
+
+	// Destroy the actors that were spawned for other objects first
+	for (auto& Pool : PooledActors)
+	{
+		if (Pool.Key != InstancedObject)
+			DestroyPooledActors(Pool.Value);
+	}
+
+	if (FHoudiniInstancedActorPool* Pool = PooledActors.Find(InstancedObject))
+		DestroyPooledActors(*Pool);
+
+	for (auto It = PooledActors.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Actors.Num() <= 0)
+			It.RemoveCurrent();
+	}
+}
+
+
+int32
+UHoudiniInstancedActorComponent::GetNumPooledActors() const
+{
+	int32 NumPooledActors = 0;
+	for (const auto& Pool : PooledActors)
+		NumPooledActors += Pool.Value.Actors.Num();
+
+	return NumPooledActors;
+}
+
+
 void 
 UHoudiniInstancedActorComponent::OnComponentCreated()
 {
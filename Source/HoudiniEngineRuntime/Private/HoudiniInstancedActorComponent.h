@@ -30,6 +30,36 @@
 
 #include "HoudiniInstancedActorComponent.generated.h"
 
+// A pooled actor, and the state it had before being hidden in the pool.
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	AActor* Actor = nullptr;
+
+	UPROPERTY()
+	bool bHiddenInGame = false;
+
+	UPROPERTY()
+	bool bCollisionEnabled = true;
+
+	UPROPERTY()
+	FName FolderPath;
+};
+
+// Hidden actors that were spawned for a given instanced object, and can be reused by later cooks.
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniInstancedActorPool
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FHoudiniPooledActor> Actors;
+};
 
 UCLASS()//( config = Engine )
 class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneComponent
@@ -71,12 +101,25 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		// Updates the transform for a given actor. Transform is given in local space of this component.
 		bool SetInstanceTransformAt(const int32& Idx, const FTransform& InstanceTransform);
     
-		// Destroy all existing instances
+		// Destroy all existing instances, and the pooled actors
 		void ClearAllInstances();
 
 		// Sets the number of instances needed
-		// Properly deletes extras, new instance actors are nulled 
-		void SetNumberOfInstances(const int32& NewInstanceNum);
+		// Properly deletes extras (or moves them to the pool), new instance actors are nulled 
+		void SetNumberOfInstances(const int32& NewInstanceNum, bool bPoolExtraInstances = false);
+
+		// Hides all the existing instances and moves them to the pool of the current instanced object
+		void ReleaseAllInstancesToPool();
+
+		// Returns a pooled actor for the current instanced object, or null if the pool is empty.
+		// The actor gets back the visibility, collision and outliner folder it had when it was released to the pool.
+		AActor* AcquirePooledActor();
+
+		// Destroys the pooled actors in excess of the given number, starting with the other instanced objects' pools
+		void TrimPool(const int32& MaxPooledActors);
+
+		// Returns the number of actors currently in the pool
+		int32 GetNumPooledActors() const;
 
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
@@ -89,4 +132,13 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		UPROPERTY(VisibleInstanceOnly, Category = Instances )
 		TArray<AActor*> InstancedActors;
 
+		// Hides an instance actor, detaches it, moves it to the pool's outliner folder,
+		// and adds it to the pool of the current instanced object
+		void ReleaseActorToPool(AActor* InActor);
+
+		// Hidden actors kept for reuse, per instanced object. 
+		// Pooled actors are transient: they are not saved with the level.
+		UPROPERTY(Transient)
+		TMap<UObject*, FHoudiniInstancedActorPool> PooledActors;
+
 };
@@ -40,7 +40,10 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 void 
-FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(UHoudiniOutput* InOutput)
+FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(
+	UHoudiniOutput* InOutput,
+	const TSet<FString>* EditLayersToKeep,
+	bool bKeepLayerOutputs)
 {
 	TSet<ALandscape*> LandscapesToDelete;
 	TArray<FHoudiniOutputObjectIdentifier> OutputObjectsToDelete;
@@ -53,12 +56,16 @@ FHoudiniLandscapeRuntimeUtils::DeleteLandscapeCookedData(UHoudiniOutput* InOutpu
 			// Get the layer data stored during cooking
 			UHoudiniLandscapeTargetLayerOutput* OldLayer = Cast<UHoudiniLandscapeTargetLayerOutput>(PrevObj.OutputObject);
 
+			const bool bKeepEditLayer = EditLayersToKeep && EditLayersToKeep->Contains(OldLayer->CookedEditLayer);
+			if (bKeepEditLayer && bKeepLayerOutputs)
+				continue;
+
 			OutputObjectsToDelete.Add(OutputObjectPair.Key);
 
 			if (IsValid(OldLayer->Landscape))
 			{
 				// Delete the edit layers
-				if (OldLayer->BakedEditLayer != OldLayer->CookedEditLayer)
+				if (OldLayer->BakedEditLayer != OldLayer->CookedEditLayer && !bKeepEditLayer)
 				{
 					DeleteEditLayer(OldLayer->Landscape, FName(OldLayer->CookedEditLayer));
 				}
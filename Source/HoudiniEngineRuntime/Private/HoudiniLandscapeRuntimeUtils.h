@@ -47,7 +47,13 @@ class UHoudiniLandscapeSplinesOutput;
 
 struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeRuntimeUtils
 {
-    static void DeleteLandscapeCookedData(UHoudiniOutput* Output);
+    // Deletes the landscapes and temporary edit layers created by the output's last cook. Temporary edit layers
+    // listed in EditLayersToKeep are left in place so they can be rewritten by the next cook. If bKeepLayerOutputs
+    // is set, the output objects describing the kept edit layers are left in the output as well.
+    static void DeleteLandscapeCookedData(
+        UHoudiniOutput* Output,
+        const TSet<FString>* EditLayersToKeep = nullptr,
+        bool bKeepLayerOutputs = false);
 
     static void DeleteEditLayer(ALandscape* Landscape, const FName& LayerName);
 
@@ -120,6 +120,8 @@ bool
 UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms( 
     const TArray<FTransform>& InstanceTransforms)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms);
+
 	if (Instances.Num() <= 0 && InstanceTransforms.Num() <= 0)
 		return false;
 
@@ -153,6 +155,12 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 	if (InstanceTransforms.Num() != Instances.Num())
 		return false;
 
+	// Update the instances in place, and only call the setters for what actually changed:
+	// each of them marks the render state of a registered component dirty, to be recreated at the end of the frame.
+	TArray<UStaticMeshComponent*> ComponentsToRegister;
+	TArray<UStaticMeshComponent*> ComponentsWithNewMesh;
+	const bool bVisible = IsVisible();
+	const int32 MeshMaterialCount = InstancedMesh->GetStaticMaterials().Num();
     for (int32 iIns = 0; iIns < Instances.Num(); ++iIns)
     {
         UStaticMeshComponent* SMC = Instances[iIns];
@@ -161,14 +169,24 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         if (!IsValid(SMC))
             continue;
 
-        SMC->SetRelativeTransform(InstanceTransform);
-
         // Attach created static mesh component to this thing
-        SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+		if (SMC->GetAttachParent() != this)
+			SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
 
-        SMC->SetStaticMesh(InstancedMesh);
-        SMC->SetVisibility(IsVisible());
-        SMC->SetMobility(Mobility);
+		if (!SMC->GetRelativeTransform().Equals(InstanceTransform, 0.0))
+			SMC->SetRelativeTransform(InstanceTransform);
+
+		if (SMC->GetStaticMesh() != InstancedMesh)
+		{
+			SMC->SetStaticMesh(InstancedMesh);
+			ComponentsWithNewMesh.Add(SMC);
+		}
+
+		if (SMC->GetVisibleFlag() != bVisible)
+			SMC->SetVisibility(bVisible);
+
+		if (SMC->Mobility != Mobility)
+			SMC->SetMobility(Mobility);
 
 		// TODO: Revert to default if override is null??
 		UMaterialInterface* MI = nullptr;
@@ -182,27 +200,30 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 
 		if (IsValid(MI))
         {
-            int32 MeshMaterialCount = InstancedMesh->GetStaticMaterials().Num();
             for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
-                SMC->SetMaterial(Idx, MI);
+			{
+				if (!SMC->OverrideMaterials.IsValidIndex(Idx) || SMC->OverrideMaterials[Idx] != MI)
+					SMC->SetMaterial(Idx, MI);
+			}
         }
 
-        SMC->RegisterComponent();
+		if (!SMC->IsRegistered())
+			ComponentsToRegister.Add(SMC);
+	}
 
-		// UE5: Make sure we update/recreate the Component's render state
-		// after the update or the mesh component will not be rendered!
-		if (SMC->IsRenderStateCreated())
-		{
-			// Need to send this to render thread at some point
-			SMC->MarkRenderStateDirty();
-		}
-		else// if (SMC->ShouldCreateRenderState())
-		{
-			// If we didn't have a valid StaticMesh assigned before
-			// our render state might not have been created so
-			// do it now.
+	// Register the new instances once they are fully set up,
+	// so their render state is only created once, with the final mesh and materials.
+	for (UStaticMeshComponent* SMC : ComponentsToRegister)
+	{
+		SMC->RegisterComponent();
+	}
+
+	// UE5: If we didn't have a valid StaticMesh assigned before, our render state might not have been created,
+	// so do it now or the mesh component will not be rendered!
+	for (UStaticMeshComponent* SMC : ComponentsWithNewMesh)
+	{
+		if (SMC->IsRegistered() && !SMC->IsRenderStateCreated())
 			SMC->RecreateRenderState_Concurrent();
-		}
 	}
 
 	return true;
@@ -26,6 +26,8 @@
 
 #include "HoudiniParameter.h"
 
+#include "HoudiniEngineRuntime.h"
+
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, ParmType(EHoudiniParameterType::Invalid)
@@ -92,6 +94,16 @@ UHoudiniParameter::RevertToDefault(const int32& InAtTupleIndex)
 	MarkChanged(true);	
 }
 
+void
+UHoudiniParameter::SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate)
+{
+	bNeedsToTriggerUpdate = bInTriggersUpdate;
+
+	// Let the manager know our HAC needs to be updated
+	if (bInTriggersUpdate && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkOuterHoudiniComponentDirty(this);
+}
+
 void
 UHoudiniParameter::MarkDefault(const bool& bInDefault)
 {
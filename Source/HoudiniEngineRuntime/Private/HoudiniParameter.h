@@ -160,7 +160,7 @@ public:
 	virtual void SetValueIndex(const uint32& InValueIndex) { ValueIndex = InValueIndex; };
 
 	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
-	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
+	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate);
 	virtual void RevertToDefault();
 	virtual void RevertToDefault(const int32& TupleIndex);
 	virtual void MarkDefault(const bool& bInDefault);
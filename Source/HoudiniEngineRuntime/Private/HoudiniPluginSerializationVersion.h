@@ -81,6 +81,9 @@ enum EHoudiniPluginSerializationVersion
 	// from UHoudiniInput to a member FHoudiniInputObjectSettings struct: UHoudiniInput::InputSettings
 	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_INPUT_OBJECT_SETTINGS_STRUCT = 101,
 
+	// Added the optional quantized vertex data arrays to UHoudiniStaticMesh
+	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_QUANTIZED_STATIC_MESH = 102,
+
     // -----<new versions can be added before this line>-------------------------------------------------
     // - this needs to be the last line (see note below)
     VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE_PLUS_ONE,
@@ -114,6 +114,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
 	bEnableProxyStaticMeshRefinementOnPreSaveWorld = true;
 	bEnableProxyStaticMeshRefinementOnPreBeginPIE = true;
+	bQuantizeProxyStaticMeshes = false;
 
 	// Generated StaticMesh settings.
 	bDoubleSidedGeometry = false;
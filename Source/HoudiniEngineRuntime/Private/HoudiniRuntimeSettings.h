@@ -343,6 +343,12 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes On PIE", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementOnPreBeginPIE;
 
+		// Store proxy meshes with quantized positions (16 bits, relative to the mesh bounds), normals, tangents and UVs to reduce their memory and file size.
+		// Positions use a single 16-bit grid over the whole bounds, so the absolute error grows with the size of the mesh:
+		// the grid steps are 1/65535th of the bounds size, about 15 cm on a 10 km proxy.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Quantize Proxy Static Meshes", EditCondition = "bEnableProxyStaticMesh"))
+		bool bQuantizeProxyStaticMeshes;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Generated StaticMesh settings.
 		//-------------------------------------------------------------------------------------------------------------
@@ -529,6 +529,10 @@ UHoudiniSplineComponent::NeedsToTriggerUpdate() const
 void UHoudiniSplineComponent::SetNeedsToTriggerUpdate(const bool& NeedsToTriggerUpdate)
 {
 	 bNeedsToTriggerUpdate = NeedsToTriggerUpdate;
+
+	 // Let the manager know our HAC needs to be updated
+	 if (NeedsToTriggerUpdate && FHoudiniEngineRuntime::IsInitialized())
+		 FHoudiniEngineRuntime::Get().MarkOuterHoudiniComponentDirty(this);
 }
 
 void UHoudiniSplineComponent::SetCurveType(const EHoudiniCurveType & NewCurveType)
@@ -544,7 +548,7 @@ bool UHoudiniSplineComponent::HasChanged() const
 void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 {
 	bHasChanged = Changed;
-	bNeedsToTriggerUpdate = Changed;
+	SetNeedsToTriggerUpdate(Changed);
 }
 
 void UHoudiniSplineComponent::MarkInputNodesAsPendingKill()
@@ -26,6 +26,7 @@
 
 #include "HoudiniStaticMesh.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniPluginSerializationVersion.h"
 
 #include "Async/ParallelFor.h"
 #include "MeshUtilitiesCommon.h"
@@ -38,6 +39,9 @@ UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializ
 	bHasColors = false;
 	NumUVLayers = 0;
 	bHasPerFaceMaterials = false;
+	bIsQuantized = false;
+	QuantizationBoundsMin = FVector3f::ZeroVector;
+	QuantizationBoundsSize = FVector3f::ZeroVector;
 }
 
 void 
@@ -51,6 +55,14 @@ UHoudiniStaticMesh::Initialize(
 	bool bInHasColors,
 	bool bInHasPerFaceMaterials)
 {
+	// Discard any previously quantized data, the mesh is rebuilt at full precision
+	bIsQuantized = false;
+	QuantizedVertexPositions.Empty();
+	QuantizedVertexInstanceNormals.Empty();
+	QuantizedVertexInstanceUTangents.Empty();
+	QuantizedVertexInstanceVTangents.Empty();
+	QuantizedVertexInstanceUVs.Empty();
+
 	// Initialize the vertex positions and triangle indices arrays
 	VertexPositions.SetNumUninitialized(InNumVertices);
 	for(int32 n = 0; n < VertexPositions.Num(); n++)
@@ -405,8 +417,140 @@ void UHoudiniStaticMesh::Optimize()
 	StaticMaterials.Shrink();
 }
 
+void UHoudiniStaticMesh::Quantize()
+{
+	if (bIsQuantized)
+		return;
+
+	const int32 NumVertices = VertexPositions.Num();
+	if (NumVertices > 0)
+	{
+		const FBox Bounds = CalcBounds();
+		QuantizationBoundsMin = FVector3f(Bounds.Min);
+		QuantizationBoundsSize = FVector3f(Bounds.GetSize());
+	}
+	else
+	{
+		QuantizationBoundsMin = FVector3f::ZeroVector;
+		QuantizationBoundsSize = FVector3f::ZeroVector;
+	}
+
+	QuantizedVertexPositions.SetNumUninitialized(NumVertices * 3);
+	// for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	ParallelFor(NumVertices, [this](int32 VertexIndex)
+	{
+		const FVector3f& Position = VertexPositions[VertexIndex];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			QuantizedVertexPositions[VertexIndex * 3 + Axis] = QuantizeCoordinate(
+				Position[Axis], QuantizationBoundsMin[Axis], QuantizationBoundsSize[Axis]);
+		}
+	});
+
+	auto EncodeVectors = [](const TArray<FVector3f>& InVectors, TArray<uint32>& OutEncodedVectors)
+	{
+		OutEncodedVectors.SetNumUninitialized(InVectors.Num());
+		ParallelFor(InVectors.Num(), [&InVectors, &OutEncodedVectors](int32 Index)
+		{
+			OutEncodedVectors[Index] = EncodeOctahedral(InVectors[Index]);
+		});
+	};
+
+	EncodeVectors(VertexInstanceNormals, QuantizedVertexInstanceNormals);
+	EncodeVectors(VertexInstanceUTangents, QuantizedVertexInstanceUTangents);
+	EncodeVectors(VertexInstanceVTangents, QuantizedVertexInstanceVTangents);
+
+	QuantizedVertexInstanceUVs.SetNumUninitialized(VertexInstanceUVs.Num());
+	ParallelFor(VertexInstanceUVs.Num(), [this](int32 Index)
+	{
+		QuantizedVertexInstanceUVs[Index] = FVector2DHalf(VertexInstanceUVs[Index]);
+	});
+
+	VertexPositions.Empty();
+	VertexInstanceNormals.Empty();
+	VertexInstanceUTangents.Empty();
+	VertexInstanceVTangents.Empty();
+	VertexInstanceUVs.Empty();
+
+	bIsQuantized = true;
+}
+
+FVector3f UHoudiniStaticMesh::GetVertexPosition(uint32 InVertexIndex) const
+{
+	if (!bIsQuantized)
+		return VertexPositions[InVertexIndex];
+
+	const uint32 Offset = InVertexIndex * 3;
+	return FVector3f(
+		DequantizeCoordinate(QuantizedVertexPositions[Offset], QuantizationBoundsMin.X, QuantizationBoundsSize.X),
+		DequantizeCoordinate(QuantizedVertexPositions[Offset + 1], QuantizationBoundsMin.Y, QuantizationBoundsSize.Y),
+		DequantizeCoordinate(QuantizedVertexPositions[Offset + 2], QuantizationBoundsMin.Z, QuantizationBoundsSize.Z));
+}
+
+uint32 UHoudiniStaticMesh::EncodeOctahedral(const FVector3f& InVector)
+{
+	// Project the vector on the octahedron |x| + |y| + |z| = 1, then fold the lower half on the upper one
+	const float L1Norm = FMath::Abs(InVector.X) + FMath::Abs(InVector.Y) + FMath::Abs(InVector.Z);
+	float U = 0.0f;
+	float V = 0.0f;
+	if (L1Norm > SMALL_NUMBER)
+	{
+		U = InVector.X / L1Norm;
+		V = InVector.Y / L1Norm;
+		if (InVector.Z < 0.0f)
+		{
+			const float FoldedU = (1.0f - FMath::Abs(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+			V = (1.0f - FMath::Abs(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+			U = FoldedU;
+		}
+	}
+
+	auto ToUNorm16 = [](float InValue)
+	{
+		return (uint32)FMath::RoundToInt(FMath::Clamp(InValue * 0.5f + 0.5f, 0.0f, 1.0f) * 65535.0f);
+	};
+
+	return ToUNorm16(U) | (ToUNorm16(V) << 16);
+}
+
+FVector3f UHoudiniStaticMesh::DecodeOctahedral(uint32 InEncodedVector)
+{
+	const float U = (InEncodedVector & 0xFFFF) / 65535.0f * 2.0f - 1.0f;
+	const float V = (InEncodedVector >> 16) / 65535.0f * 2.0f - 1.0f;
+
+	FVector3f Vector(U, V, 1.0f - FMath::Abs(U) - FMath::Abs(V));
+	if (Vector.Z < 0.0f)
+	{
+		Vector.X = (1.0f - FMath::Abs(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+		Vector.Y = (1.0f - FMath::Abs(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	return Vector.GetSafeNormal();
+}
+
+uint16 UHoudiniStaticMesh::QuantizeCoordinate(float InValue, float InMin, float InSize)
+{
+	if (InSize <= 0.0f)
+		return 0;
+
+	return (uint16)FMath::RoundToInt(FMath::Clamp((InValue - InMin) / InSize, 0.0f, 1.0f) * 65535.0f);
+}
+
+float UHoudiniStaticMesh::DequantizeCoordinate(uint16 InQuantizedValue, float InMin, float InSize)
+{
+	return InMin + InSize * (InQuantizedValue / 65535.0f);
+}
+
 FBox UHoudiniStaticMesh::CalcBounds() const
 {
+	if (bIsQuantized)
+	{
+		if (QuantizedVertexPositions.Num() == 0)
+			return FBox();
+
+		return FBox(FVector(QuantizationBoundsMin), FVector(QuantizationBoundsMin + QuantizationBoundsSize));
+	}
+
 	const uint32 NumVertices = VertexPositions.Num();
 
 	if (NumVertices == 0)
@@ -459,17 +603,22 @@ bool UHoudiniStaticMesh::IsValid(bool bInSkipVertexIndicesCheck) const
 		return InArrayNum == 0 || InArrayNum == InExpectedSize;
 	};
 	
+	const int32 NumNormals = bIsQuantized ? QuantizedVertexInstanceNormals.Num() : VertexInstanceNormals.Num();
+	const int32 NumUTangents = bIsQuantized ? QuantizedVertexInstanceUTangents.Num() : VertexInstanceUTangents.Num();
+	const int32 NumVTangents = bIsQuantized ? QuantizedVertexInstanceVTangents.Num() : VertexInstanceVTangents.Num();
+	const int32 NumUVs = bIsQuantized ? QuantizedVertexInstanceUVs.Num() : VertexInstanceUVs.Num();
+
 	bool bValid = NumVertices > 0
 		&& NumVertexInstances > 0
 		&& NumTriangles > 0
 		&& (NumVertexInstances / 3) == NumTriangles
 		&& ValidateAttributeArraySize(MaterialIDsPerTriangle.Num(), NumTriangles)
-		&& ValidateAttributeArraySize(VertexInstanceNormals.Num(), NumVertexInstances)
-		&& ValidateAttributeArraySize(VertexInstanceUTangents.Num(), NumVertexInstances)
-		&& ValidateAttributeArraySize(VertexInstanceVTangents.Num(), NumVertexInstances)
+		&& ValidateAttributeArraySize(NumNormals, NumVertexInstances)
+		&& ValidateAttributeArraySize(NumUTangents, NumVertexInstances)
+		&& ValidateAttributeArraySize(NumVTangents, NumVertexInstances)
 		&& ValidateAttributeArraySize(VertexInstanceColors.Num(), NumVertexInstances)
 		&& NumUVLayers >= 0
-		&& VertexInstanceUVs.Num() == NumUVLayers * NumVertexInstances; 
+		&& NumUVs == NumUVLayers * NumVertexInstances; 
 
 	if (!bInSkipVertexIndicesCheck)
 	{
@@ -513,5 +662,36 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 
 	MaterialIDsPerTriangle.Shrink();
 	MaterialIDsPerTriangle.BulkSerialize(InArchive);
+
+	InArchive.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
+	if (InArchive.CustomVer(FHoudiniCustomSerializationVersion::GUID) < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_QUANTIZED_STATIC_MESH)
+		return;
+
+	// The full precision arrays above are empty if the mesh is quantized
+	QuantizedVertexPositions.BulkSerialize(InArchive);
+	QuantizedVertexInstanceNormals.BulkSerialize(InArchive);
+	QuantizedVertexInstanceUTangents.BulkSerialize(InArchive);
+	QuantizedVertexInstanceVTangents.BulkSerialize(InArchive);
+	QuantizedVertexInstanceUVs.BulkSerialize(InArchive);
+}
+
+void UHoudiniStaticMesh::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(
+		VertexPositions.GetAllocatedSize()
+		+ TriangleIndices.GetAllocatedSize()
+		+ VertexInstanceColors.GetAllocatedSize()
+		+ VertexInstanceNormals.GetAllocatedSize()
+		+ VertexInstanceUTangents.GetAllocatedSize()
+		+ VertexInstanceVTangents.GetAllocatedSize()
+		+ VertexInstanceUVs.GetAllocatedSize()
+		+ MaterialIDsPerTriangle.GetAllocatedSize()
+		+ QuantizedVertexPositions.GetAllocatedSize()
+		+ QuantizedVertexInstanceNormals.GetAllocatedSize()
+		+ QuantizedVertexInstanceUTangents.GetAllocatedSize()
+		+ QuantizedVertexInstanceVTangents.GetAllocatedSize()
+		+ QuantizedVertexInstanceUVs.GetAllocatedSize());
 }
 
@@ -28,6 +28,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
+#include "Math/Vector2DHalf.h"
 
 #include "HoudiniStaticMesh.generated.h"
 
@@ -88,7 +89,7 @@ public:
 	void SetNumStaticMaterials(uint32 InNumStaticMaterials);
 
 	UFUNCTION()
-	uint32 GetNumVertices() const { return VertexPositions.Num(); }
+	uint32 GetNumVertices() const { return bIsQuantized ? QuantizedVertexPositions.Num() / 3 : VertexPositions.Num(); }
 
 	UFUNCTION()
 	uint32 GetNumTriangles() const { return TriangleIndices.Num(); }
@@ -154,6 +155,19 @@ public:
 	UFUNCTION()
 	void Optimize();
 
+	/**
+	 * Replaces the full precision positions, normals, tangents and UVs by a compact representation: positions are
+	 * stored as 16 bit offsets in the mesh bounds, normals and tangents are octahedral encoded (16 bits per component)
+	 * and UVs are stored as half floats. Meant to be called once the mesh is fully built: the full precision arrays
+	 * are emptied, so the setters and CalculateNormals() / CalculateTangents() can no longer be used until the next
+	 * call to Initialize().
+	 */
+	UFUNCTION()
+	void Quantize();
+
+	UFUNCTION()
+	bool IsQuantized() const { return bIsQuantized; }
+
 	UFUNCTION()
 	FBox CalcBounds() const;
 
@@ -181,6 +195,32 @@ public:
 	UFUNCTION()
 	const TArray<int32>& GetMaterialIDsPerTriangle() const { return MaterialIDsPerTriangle; }
 
+	// The quantized arrays are only populated after Quantize() has been called
+	const TArray<uint16>& GetQuantizedVertexPositions() const { return QuantizedVertexPositions; }
+
+	const TArray<uint32>& GetQuantizedVertexInstanceNormals() const { return QuantizedVertexInstanceNormals; }
+
+	const TArray<uint32>& GetQuantizedVertexInstanceUTangents() const { return QuantizedVertexInstanceUTangents; }
+
+	const TArray<uint32>& GetQuantizedVertexInstanceVTangents() const { return QuantizedVertexInstanceVTangents; }
+
+	const TArray<FVector2DHalf>& GetQuantizedVertexInstanceUVs() const { return QuantizedVertexInstanceUVs; }
+
+	// Returns the position of the given vertex, decoding it if the mesh is quantized
+	FVector3f GetVertexPosition(uint32 InVertexIndex) const;
+
+	// Encodes a unit vector with an octahedral mapping, 16 bits per component
+	static uint32 EncodeOctahedral(const FVector3f& InVector);
+
+	// Decodes a unit vector encoded with EncodeOctahedral()
+	static FVector3f DecodeOctahedral(uint32 InEncodedVector);
+
+	// Quantizes InValue to 16 bits, relative to the [InMin, InMin + InSize] range
+	static uint16 QuantizeCoordinate(float InValue, float InMin, float InSize);
+
+	// Decodes a value quantized with QuantizeCoordinate()
+	static float DequantizeCoordinate(uint16 InQuantizedValue, float InMin, float InSize);
+
 	UFUNCTION()
 	const TArray<FStaticMaterial>& GetStaticMaterials() const { return StaticMaterials; }
 
@@ -201,6 +241,9 @@ public:
 	// Custom serialization: we use TArray::BulkSerialize to speed up array serialization
 	virtual void Serialize(FArchive &InArchive) override;
 
+	// Adds the memory used by the mesh data, full precision or quantized
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
 protected:
 
 	UPROPERTY()
@@ -219,6 +262,18 @@ protected:
 	UPROPERTY()
 	bool bHasPerFaceMaterials;
 
+	/** Whether the mesh data is stored in the Quantized arrays instead of the full precision ones. */
+	UPROPERTY()
+	bool bIsQuantized;
+
+	/** Min corner of the bounds that the quantized positions are relative to. */
+	UPROPERTY()
+	FVector3f QuantizationBoundsMin;
+
+	/** Size of the bounds that the quantized positions are relative to. */
+	UPROPERTY()
+	FVector3f QuantizationBoundsSize;
+
 	/** Vertex positions. The vertex id == vertex index => indexes into this array. */
 	UPROPERTY(SkipSerialization)
 	TArray<FVector3f> VertexPositions;
@@ -256,5 +311,22 @@ protected:
 	/** The materials of the mesh. Index by MaterialID (MaterialIndex). */
 	UPROPERTY()
 	TArray<FStaticMaterial> StaticMaterials;
+
+	// The quantized arrays are not UPROPERTYs (FVector2DHalf is not reflected), they are serialized in Serialize().
+
+	/** Quantized vertex positions, 3 components per vertex. Index 3 * VertexID + Axis. */
+	TArray<uint16> QuantizedVertexPositions;
+
+	/** Octahedral encoded normals per vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex. */
+	TArray<uint32> QuantizedVertexInstanceNormals;
+
+	/** Octahedral encoded U tangents per vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex. */
+	TArray<uint32> QuantizedVertexInstanceUTangents;
+
+	/** Octahedral encoded V tangents per vertex instance. Index 3 * TriangleID + LocalTriangleVertexIndex. */
+	TArray<uint32> QuantizedVertexInstanceVTangents;
+
+	/** Half precision UVs. Index: UVLayerIndex * (NumVertexInstances) + 3 * TriangleID + LocalTriangleVertexIndex. */
+	TArray<FVector2DHalf> QuantizedVertexInstanceUVs;
 };
 
@@ -416,6 +416,20 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	const bool bHasNormals = InMesh->HasNormals();
 	const bool bHasTangents = InMesh->HasTangents();
 
+	// Quantized meshes are read directly, without expanding them back to full precision arrays
+	const bool bIsQuantized = InMesh->IsQuantized();
+	const TArray<uint32>& QuantizedNormals = InMesh->GetQuantizedVertexInstanceNormals();
+	const TArray<uint32>& QuantizedUTangents = InMesh->GetQuantizedVertexInstanceUTangents();
+	const TArray<uint32>& QuantizedVTangents = InMesh->GetQuantizedVertexInstanceVTangents();
+	const TArray<FVector2DHalf>& QuantizedUVs = InMesh->GetQuantizedVertexInstanceUVs();
+	const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
+
+	// If the vertex buffer also uses half precision UVs, the quantized UVs can be copied as is
+	FVector2DHalf* HalfTexCoords = nullptr;
+	if (bIsQuantized && !InBuffers->StaticMeshVertexBuffer.GetUseFullPrecisionUVs())
+		HalfTexCoords = static_cast<FVector2DHalf*>(InBuffers->StaticMeshVertexBuffer.GetTexCoordData());
+	const uint32 NumTexCoords = InBuffers->StaticMeshVertexBuffer.GetNumTexCoords();
+
 	FThreadSafeCounter VertCounter(0);
 	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
 	ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
@@ -431,13 +445,29 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 			const uint32 MeshVtxIdx = TriIndices[TriVertIdx];
 			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
 
-			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
+			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = bIsQuantized
+				? InMesh->GetVertexPosition(MeshVtxIdx) : VertexPositions[MeshVtxIdx];
+
+			FVector3f Normal(0, 0, 1);
+			if (bHasNormals)
+			{
+				Normal = bIsQuantized
+					? UHoudiniStaticMesh::DecodeOctahedral(QuantizedNormals[MeshVtxInstanceIdx])
+					: VertexInstanceNormals[MeshVtxInstanceIdx];
+			}
 
-			FVector3f Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
 			if (bHasTangents)
 			{
-				TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
-				TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
+				if (bIsQuantized)
+				{
+					TangentU = UHoudiniStaticMesh::DecodeOctahedral(QuantizedUTangents[MeshVtxInstanceIdx]);
+					TangentV = UHoudiniStaticMesh::DecodeOctahedral(QuantizedVTangents[MeshVtxInstanceIdx]);
+				}
+				else
+				{
+					TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
+					TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
+				}
 			}
 			else
 			{
@@ -449,7 +479,13 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 			{
 				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
 				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
+					const uint32 MeshUVIdx = UVLayerIdx * NumVertexInstances + MeshVtxInstanceIdx;
+					if (HalfTexCoords)
+						HalfTexCoords[VertIdx * NumTexCoords + UVLayerIdx] = QuantizedUVs[MeshUVIdx];
+					else if (bIsQuantized)
+						InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, FVector2f(QuantizedUVs[MeshUVIdx]));
+					else
+						InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshUVIdx]);
 				}
 			}
 			else
@@ -308,6 +308,35 @@ public:
 	 */
 	virtual bool ClearDirtyFlag(const FUnrealObjectInputIdentifier& InIdentifier) = 0;
 
+	/**
+	 * Opens a batch. Batches can be nested, the deferred work is flushed when the outermost batch ends. While a batch
+	 * is open:
+	 *   - dirtying a node (and its referenced nodes) visits each node at most once,
+	 *   - the container (parent) nodes are validated at most once,
+	 *   - reconnecting the referenced nodes to the merge of a reference node is deferred to the end of the batch, see
+	 *     DeferReferenceNodeReconnect().
+	 * Prefer using FUnrealObjectInputBatchScope over calling BeginBatch() / EndBatch() directly.
+	 */
+	virtual void BeginBatch() = 0;
+
+	/**
+	 * Closes a batch opened with BeginBatch(). When the outermost batch is closed, the deferred reconnects are done
+	 * in one pass: each reference node is reconnected once, after the reference nodes it references.
+	 * @return The number of reference nodes that were successfully reconnected when flushing the batch.
+	 */
+	virtual int32 EndBatch() = 0;
+
+	/** Returns true if a batch is currently open. See BeginBatch(). */
+	virtual bool IsBatching() const = 0;
+
+	/**
+	 * Defers reconnecting the referenced nodes of a reference node to its merge node to the end of the current batch.
+	 * The caller must have validated the HAPI nodes of the reference node and of its referenced nodes.
+	 * @param InIdentifier The identifier of the reference node.
+	 * @return true if the reconnect was deferred, false if there is no open batch and the caller should reconnect now.
+	 */
+	virtual bool DeferReferenceNodeReconnect(const FUnrealObjectInputIdentifier& InIdentifier) = 0;
+
 	/** Clear the manager. This removes and destroys all input node entries. */
 	virtual bool Clear() = 0;
 
@@ -487,6 +516,11 @@ public:
 	virtual inline bool MarkAsDirty(const FUnrealObjectInputIdentifier& InIdentifier, bool bInAlsoDirtyReferencedNodes) override;
 	virtual inline bool ClearDirtyFlag(const FUnrealObjectInputIdentifier& InIdentifier) override;
 
+	virtual inline void BeginBatch() override;
+	virtual inline int32 EndBatch() override;
+	virtual inline bool IsBatching() const override;
+	virtual inline bool DeferReferenceNodeReconnect(const FUnrealObjectInputIdentifier& InIdentifier) override;
+
 	virtual inline bool Clear() override;
 
 	virtual inline FUnrealObjectInputHAPINodeId GetWorldOriginNodeId(const bool bInCreateIfMissingOrInvalid=true) override;
@@ -818,6 +852,37 @@ FUnrealObjectInputManager::ClearDirtyFlag(const FUnrealObjectInputIdentifier& In
 	return false;
 }
 
+void
+FUnrealObjectInputManager::BeginBatch()
+{
+	if (IUnrealObjectInputManager* const Impl = GetImplementation())
+		Impl->BeginBatch();
+}
+
+int32
+FUnrealObjectInputManager::EndBatch()
+{
+	if (IUnrealObjectInputManager* const Impl = GetImplementation())
+		return Impl->EndBatch();
+	return 0;
+}
+
+bool
+FUnrealObjectInputManager::IsBatching() const
+{
+	if (IUnrealObjectInputManager const* const Impl = GetImplementation())
+		return Impl->IsBatching();
+	return false;
+}
+
+bool
+FUnrealObjectInputManager::DeferReferenceNodeReconnect(const FUnrealObjectInputIdentifier& InIdentifier)
+{
+	if (IUnrealObjectInputManager* const Impl = GetImplementation())
+		return Impl->DeferReferenceNodeReconnect(InIdentifier);
+	return false;
+}
+
 bool 
 FUnrealObjectInputManager::Clear()
 {
@@ -1470,3 +1470,24 @@ void FUnrealObjectInputUpdateScope::OnNodeDestroyed(const FUnrealObjectInputIden
 	NodesCreatedOrUpdated.Remove(InIdentifier);
 	NodesDestroyed.Add(InIdentifier);
 }
+
+FUnrealObjectInputBatchScope::FUnrealObjectInputBatchScope()
+	: bBatchOpened(false)
+{
+	IUnrealObjectInputManager* const Manager = FUnrealObjectInputManager::Get();
+	if (Manager)
+	{
+		Manager->BeginBatch();
+		bBatchOpened = true;
+	}
+}
+
+FUnrealObjectInputBatchScope::~FUnrealObjectInputBatchScope()
+{
+	if (!bBatchOpened)
+		return;
+
+	IUnrealObjectInputManager* const Manager = FUnrealObjectInputManager::Get();
+	if (Manager)
+		Manager->EndBatch();
+}
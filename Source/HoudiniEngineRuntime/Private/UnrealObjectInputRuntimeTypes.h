@@ -974,6 +974,23 @@ private:
 	FDelegateHandle OnDestroyedHandle;
 };
 
+/**
+ * A batch scope: opens a batch on the manager on construction and closes it on destruction. Deferred work, such as
+ * reconnecting reference node merges, is flushed when the outermost scope is destroyed.
+ * See IUnrealObjectInputManager::BeginBatch().
+ */
+class HOUDINIENGINERUNTIME_API FUnrealObjectInputBatchScope
+{
+public:
+	FUnrealObjectInputBatchScope();
+
+	~FUnrealObjectInputBatchScope();
+
+private:
+	/** True if the batch was opened on the manager. */
+	bool bBatchOpened;
+};
+
 
 template <class T>
 void FUnrealObjectInputOptions::SetSelectedComponents(const TSet<T*>& InSelectedComponents)